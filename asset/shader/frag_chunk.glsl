@@ -20,17 +20,24 @@
 
 in vec2 out_coordinate;
 in float out_distance;
+in vec3 out_light;
 in vec3 out_normal;
 in vec3 out_normal_position;
 in vec3 out_vertex;
 
-uniform vec4 ambient;
-uniform vec3 ambient_position;
-uniform bool clouds;
-uniform float cycle;
-uniform vec3 position;
-uniform vec3 rotation;
-uniform bool underwater;
+layout(std140) uniform frame {
+	mat4 projection;
+	mat4 projection_orthogonal;
+	mat4 view;
+	vec4 ambient;
+	vec4 ambient_background;
+	vec3 ambient_position;
+	vec3 position;
+	vec3 rotation;
+	float cycle;
+	bool clouds;
+	bool underwater;
+};
 
 uniform sampler2D out_texture;
 
@@ -49,6 +56,12 @@ const vec4 FOG_COLOR_DEFAULT = vec4(0.34f, 0.71f, 0.88f, 1.f);
 const vec4 FOG_COLOR_MC = vec4(0.54f, 0.70f, 1.f, 1.f);
 const float FOG_FALLOFF = 0.004f;
 
+const float LIGHT_FALLOFF = 0.8f;
+const float LIGHT_LEVEL_MAX = 15.f;
+const float LIGHT_MIN = 0.1f;
+
+const float OCCLUSION_MIN = 0.45f;
+
 const vec4 WATER_COLOR = vec4(0.25f, 0.56f, 0.86f, 1.f);
 const float WATER_FALLOFF = 0.08f;
 
@@ -96,6 +109,15 @@ add_light_diffuse(
 	return (mix(diffuse, AMBIENT_DARK, clamp(scale, AMBIENT_DARK_MIN, AMBIENT_DARK_MAX)) * DIFFUSE_SCALE);
 }
 
+float 
+add_light_level(
+	in float level,
+	in float minimum
+	)
+{
+	return mix(minimum, 1.f, pow(LIGHT_FALLOFF, (1.f - level) * LIGHT_LEVEL_MAX));
+}
+
 vec4 
 add_fog_constant(
 	in vec4 color,
@@ -133,7 +155,11 @@ main(void)
 		discard;
 	}
 
-	color *= (add_light_ambient(cycle, ambient) + add_light_diffuse(cycle, out_normal, out_normal_position, ambient, ambient_position));
+	vec4 light = (add_light_ambient(cycle, ambient) + add_light_diffuse(cycle, out_normal, out_normal_position, ambient, ambient_position));
+
+	light.rgb = max(light.rgb * add_light_level(out_light.x, LIGHT_MIN), vec3(add_light_level(out_light.y, 0.f)));
+	light.rgb *= mix(OCCLUSION_MIN, 1.f, out_light.z);
+	color *= light;
 
 	if(!underwater) { // clouds/above water
 		color = add_fog_non_constant(color, add_light_ambient(cycle, FOG_COLOR_DEFAULT), FOG_FALLOFF, out_distance,
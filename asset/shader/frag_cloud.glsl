@@ -0,0 +1,88 @@
+/**
+ * Nomic
+ * Copyright (C) 2017 David Jolly
+ *
+ * Nomic is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Nomic is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#version 330 core
+
+in float out_distance;
+in vec3 out_normal;
+
+layout(std140) uniform frame {
+	mat4 projection;
+	mat4 projection_orthogonal;
+	mat4 view;
+	vec4 ambient;
+	vec4 ambient_background;
+	vec3 ambient_position;
+	vec3 position;
+	vec3 rotation;
+	float cycle;
+	bool clouds;
+	bool underwater;
+};
+
+const vec4 AMBIENT_DARK = vec4(0.f, 0.f, 0.f, 1.f);
+const float AMBIENT_DARK_END = 0.1f;
+const float AMBIENT_DARK_MIN = 0.0f;
+const float AMBIENT_DARK_MAX = 0.8f;
+const float AMBIENT_DARK_START = 0.9f;
+
+const vec4 CLOUD_COLOR = vec4(1.f, 1.f, 1.f, 0.8f);
+const float CLOUD_SHADE_BOTTOM = 0.7f;
+const float CLOUD_SHADE_SIDE = 0.85f;
+
+const vec4 FOG_COLOR_DEFAULT = vec4(0.34f, 0.71f, 0.88f, 1.f);
+const float FOG_FALLOFF = 0.004f;
+
+vec4 
+add_light_ambient(
+	in float cycle,
+	in vec4 ambient
+	)
+{
+	float scale;
+
+	if(cycle <= AMBIENT_DARK_END) {
+		scale = (1.f - (cycle / AMBIENT_DARK_END));
+	} else if((cycle > AMBIENT_DARK_END) && (cycle <= AMBIENT_DARK_START)) {
+		scale = 0.f;
+	} else {
+		scale = ((cycle - AMBIENT_DARK_START) / (1.f - AMBIENT_DARK_START));
+	}
+
+	return mix(ambient, AMBIENT_DARK, clamp(scale, AMBIENT_DARK_MIN, AMBIENT_DARK_MAX));
+}
+
+void
+main(void)
+{
+	float density, shade = 1.f;
+	vec4 color = CLOUD_COLOR;
+
+	if(out_normal.y < 0.f) {
+		shade = CLOUD_SHADE_BOTTOM;
+	} else if(out_normal.y == 0.f) {
+		shade = CLOUD_SHADE_SIDE;
+	}
+
+	color.rgb *= (add_light_ambient(cycle, ambient).rgb * shade);
+	density = (1.f - exp(-out_distance * FOG_FALLOFF));
+	color.rgb = mix(color.rgb, add_light_ambient(cycle, FOG_COLOR_DEFAULT).rgb, density);
+	color.a *= (1.f - density);
+
+	gl_FragColor = color;
+}
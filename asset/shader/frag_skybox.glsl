@@ -20,10 +20,19 @@
 
 in vec3 out_vertex;
 
-uniform vec4 ambient_background;
-uniform bool clouds;
-uniform float cycle;
-uniform bool underwater;
+layout(std140) uniform frame {
+	mat4 projection;
+	mat4 projection_orthogonal;
+	mat4 view;
+	vec4 ambient;
+	vec4 ambient_background;
+	vec3 ambient_position;
+	vec3 position;
+	vec3 rotation;
+	float cycle;
+	bool clouds;
+	bool underwater;
+};
 
 uniform samplerCube out_cube;
 
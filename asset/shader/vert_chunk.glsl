@@ -21,33 +21,54 @@
 layout(location = 0) in vec2 in_coordinate;
 layout(location = 1) in vec3 in_normal;
 layout(location = 2) in vec3 in_vertex;
+layout(location = 3) in vec4 in_instance;
+layout(location = 4) in vec3 in_light;
+
+layout(std140) uniform frame {
+	mat4 projection;
+	mat4 projection_orthogonal;
+	mat4 view;
+	vec4 ambient;
+	vec4 ambient_background;
+	vec3 ambient_position;
+	vec3 position;
+	vec3 rotation;
+	float cycle;
+	bool clouds;
+	bool underwater;
+};
 
-uniform vec4 ambient;
-uniform vec3 ambient_position;
-uniform bool clouds;
-uniform float cycle;
 uniform mat4 model;
-uniform vec3 position;
-uniform mat4 projection;
-uniform vec3 rotation;
-uniform bool underwater;
-uniform mat4 view;
 
 out vec2 out_coordinate;
 out float out_distance;
+out vec3 out_light;
 out vec3 out_normal;
 out vec3 out_normal_position;
 out vec3 out_vertex;
 
+const float DECORATION_THIN_END = 128.f;
+const float DECORATION_THIN_START = 48.f;
+
+const vec4 HIDDEN = vec4(2.f, 2.f, 2.f, 1.f);
+
 void
 main(void)
 {
-	vec4 position_relative = (view * model * vec4(in_vertex, 1.f));
+	vec3 vertex = (in_vertex + in_instance.xyz); // instance attribute defaults to (0, 0, 0, 1) for block faces
+	vec4 position_relative = (view * model * vec4(vertex, 1.f));
 
 	out_coordinate = in_coordinate;
 	out_distance = length(position_relative.xyz);
+	out_light = in_light;
 	out_normal = in_normal;
-	out_normal_position = in_vertex;
-	out_vertex = in_vertex;
-	gl_Position = (projection * position_relative);
+	out_normal_position = vertex;
+	out_vertex = vertex;
+
+	if(in_instance.w < clamp((length((view * model * vec4(in_instance.xyz, 1.f)).xyz) - DECORATION_THIN_START)
+			/ (DECORATION_THIN_END - DECORATION_THIN_START), 0.f, 1.f)) {
+		gl_Position = HIDDEN; // thin distant decorations
+	} else {
+		gl_Position = (projection * position_relative);
+	}
 }
@@ -0,0 +1,88 @@
+/**
+ * Nomic
+ * Copyright (C) 2017 David Jolly
+ *
+ * Nomic is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Nomic is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#version 330 core
+
+layout(location = 0) in vec4 in_instance;
+layout(location = 1) in vec3 in_normal;
+layout(location = 2) in float in_side;
+layout(location = 3) in vec3 in_vertex;
+
+layout(std140) uniform frame {
+	mat4 projection;
+	mat4 projection_orthogonal;
+	mat4 view;
+	vec4 ambient;
+	vec4 ambient_background;
+	vec3 ambient_position;
+	vec3 position;
+	vec3 rotation;
+	float cycle;
+	bool clouds;
+	bool underwater;
+};
+
+uniform mat4 model;
+
+out float out_distance;
+out vec3 out_normal;
+
+const int SIDE_RIGHT = 1;
+const int SIDE_LEFT = 2;
+const int SIDE_BACK = 4;
+const int SIDE_FRONT = 8;
+
+const vec4 SIDE_HIDDEN = vec4(2.f, 2.f, 2.f, 1.f);
+
+int 
+side(
+	in vec3 normal
+	)
+{
+	int result = 0;
+
+	if(normal.x > 0.f) {
+		result = SIDE_RIGHT;
+	} else if(normal.x < 0.f) {
+		result = SIDE_LEFT;
+	} else if(normal.z > 0.f) {
+		result = SIDE_BACK;
+	} else if(normal.z < 0.f) {
+		result = SIDE_FRONT;
+	}
+
+	return result;
+}
+
+void
+main(void)
+{
+	int mask = side(in_normal);
+	vec4 position_relative;
+
+	out_normal = in_normal;
+
+	if((mask != 0) && ((int(in_side) & mask) == 0)) { // face shared with a neighbouring cell
+		out_distance = 0.f;
+		gl_Position = SIDE_HIDDEN;
+	} else {
+		position_relative = (view * model * vec4(in_instance.xyz + (in_vertex * vec3(in_instance.w, 1.f, in_instance.w)), 1.f));
+		out_distance = length(position_relative.xyz);
+		gl_Position = (projection * position_relative);
+	}
+}
@@ -22,9 +22,21 @@ layout(location = 0) in vec3 in_color;
 layout(location = 1) in vec2 in_coordinate;
 layout(location = 2) in vec3 in_vertex;
 
+layout(std140) uniform frame {
+	mat4 projection;
+	mat4 projection_orthogonal;
+	mat4 view;
+	vec4 ambient;
+	vec4 ambient_background;
+	vec3 ambient_position;
+	vec3 position;
+	vec3 rotation;
+	float cycle;
+	bool clouds;
+	bool underwater;
+};
+
 uniform mat4 model;
-uniform mat4 projection;
-uniform mat4 view;
 
 out vec2 out_coordinate;
 
@@ -20,13 +20,21 @@
 
 layout(location = 0) in vec3 in_vertex;
 
-uniform vec4 ambient_background;
-uniform bool clouds;
-uniform float cycle;
+layout(std140) uniform frame {
+	mat4 projection;
+	mat4 projection_orthogonal;
+	mat4 view;
+	vec4 ambient;
+	vec4 ambient_background;
+	vec3 ambient_position;
+	vec3 position;
+	vec3 rotation;
+	float cycle;
+	bool clouds;
+	bool underwater;
+};
+
 uniform mat4 model;
-uniform mat4 projection;
-uniform bool underwater;
-uniform mat4 view;
 
 out vec3 out_vertex;
 
@@ -20,9 +20,21 @@
 
 layout(location = 0) in vec4 in_vertex;
 
+layout(std140) uniform frame {
+	mat4 projection;
+	mat4 projection_orthogonal;
+	mat4 view;
+	vec4 ambient;
+	vec4 ambient_background;
+	vec3 ambient_position;
+	vec3 position;
+	vec3 rotation;
+	float cycle;
+	bool clouds;
+	bool underwater;
+};
+
 uniform mat4 model;
-uniform mat4 projection;
-uniform mat4 view;
 
 out vec2 out_coordinate;
 
@@ -30,5 +42,5 @@ void
 main(void)
 {
 	out_coordinate = in_vertex.zw;
-	gl_Position = (projection * vec4(in_vertex.xy, 0.f, 1.f));
+	gl_Position = (projection_orthogonal * vec4(in_vertex.xy, 0.f, 1.f));
 }
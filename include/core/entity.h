@@ -20,6 +20,8 @@
 #define NOMIC_CORE_ENTITY_H_
 
 #include <set>
+#include <tuple>
+#include <vector>
 #include "./id.h"
 #include "./object.h"
 #include "./renderer.h"
@@ -29,6 +31,14 @@ namespace nomic {
 
 	namespace core {
 
+		enum {
+			ENTITY_LAYER_PASS = 0,
+			ENTITY_LAYER_TEXTURE,
+			ENTITY_LAYER_DEPTH,
+		};
+
+		typedef std::tuple<uint32_t, uint8_t, float> entity_layer;
+
 		class entity :
 				public nomic::core::id,
 				public nomic::core::object,
@@ -60,12 +70,26 @@ namespace nomic {
 
 				bool enabled(void) const;
 
+				virtual void on_queue(
+					__in nomic::core::renderer &renderer,
+					__in const glm::vec3 &position,
+					__inout std::vector<nomic::core::entity_layer> &layer
+					);
+
 				virtual void on_render(
 					__in nomic::core::renderer &renderer,
 					__in void *textures,
 					__in float delta
 					);
 
+				virtual void on_render_layer(
+					__in nomic::core::renderer &renderer,
+					__in void *textures,
+					__in float delta,
+					__in uint32_t pass,
+					__in uint8_t texture
+					);
+
 				virtual void on_update(
 					__in void *runtime,
 					__in void *camera
@@ -60,6 +60,11 @@ namespace nomic {
 
 				bool loaded(void) const;
 
+				void rasterize(
+					__inout nomic::graphic::cache_entry &output,
+					__in char value
+					);
+
 				uint32_t size(void) const;
 
 				virtual std::string to_string(
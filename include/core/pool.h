@@ -0,0 +1,181 @@
+/**
+ * Nomic
+ * Copyright (C) 2017 David Jolly
+ *
+ * Nomic is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Nomic is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NOMIC_CORE_POOL_H_
+#define NOMIC_CORE_POOL_H_
+
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../define.h"
+#include "./pool_type.h"
+
+namespace nomic {
+
+	namespace core {
+
+		template <class T> class pool {
+
+			public:
+
+				explicit pool(
+					__in_opt size_t count = POOL_SLAB_COUNT_DEFAULT
+					) :
+						m_count(count),
+						m_used(0)
+				{
+
+					if(!m_count) {
+						THROW_NOMIC_CORE_POOL_EXCEPTION_FORMAT(NOMIC_CORE_POOL_EXCEPTION_SLAB_INVALID, "Count=%u", m_count);
+					}
+				}
+
+				~pool(void)
+				{
+
+					for(typename std::vector<storage *>::iterator iter = m_slab.begin(); iter != m_slab.end(); ++iter) {
+						delete[] *iter;
+					}
+				}
+
+				template <class... A> T *allocate(
+					__in A &&... arguments
+					)
+				{
+					T *result;
+					storage *entry;
+
+					if(m_free.empty()) {
+						grow();
+					}
+
+					entry = m_free.back();
+					m_free.pop_back();
+
+					try {
+						result = new (entry) T(std::forward<A>(arguments)...);
+					} catch(...) {
+						m_free.push_back(entry);
+						throw;
+					}
+
+					++m_used;
+
+					return result;
+				}
+
+				size_t capacity(void) const
+				{
+					return (m_slab.size() * m_count);
+				}
+
+				void clear(void)
+				{
+
+					if(m_used) {
+						THROW_NOMIC_CORE_POOL_EXCEPTION_FORMAT(NOMIC_CORE_POOL_EXCEPTION_IN_USE, "Used=%u", m_used);
+					}
+
+					for(typename std::vector<storage *>::iterator iter = m_slab.begin(); iter != m_slab.end(); ++iter) {
+						delete[] *iter;
+					}
+
+					m_free.clear();
+					m_slab.clear();
+				}
+
+				void release(
+					__in T *entry
+					)
+				{
+
+					if(entry) {
+						entry->~T();
+						m_free.push_back((storage *) entry);
+						--m_used;
+					}
+				}
+
+				size_t slabs(void) const
+				{
+					return m_slab.size();
+				}
+
+				virtual std::string to_string(
+					__in_opt bool verbose = false
+					) const
+				{
+					std::stringstream result;
+
+					result << NOMIC_CORE_POOL_HEADER << "(" << SCALAR_AS_HEX(uintptr_t, this) << ")";
+
+					if(verbose) {
+						result << " Slab[" << m_slab.size() << "]=" << m_count << "x" << sizeof(T)
+							<< ", Used=" << m_used << "/" << capacity();
+					}
+
+					return result.str();
+				}
+
+				size_t used(void) const
+				{
+					return m_used;
+				}
+
+			protected:
+
+				typedef typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type storage;
+
+				pool(
+					__in const pool &other
+					) = delete;
+
+				pool &operator=(
+					__in const pool &other
+					) = delete;
+
+				void grow(void)
+				{
+					storage *slab = new (std::nothrow) storage[m_count];
+
+					if(!slab) {
+						THROW_NOMIC_CORE_POOL_EXCEPTION_FORMAT(NOMIC_CORE_POOL_EXCEPTION_ALLOCATE, "Count=%u, Size=%u", m_count,
+							sizeof(T));
+					}
+
+					m_slab.push_back(slab);
+					m_free.reserve(capacity());
+
+					for(size_t iter = m_count; iter > 0; --iter) {
+						m_free.push_back(&slab[iter - 1]);
+					}
+				}
+
+				size_t m_count;
+
+				std::vector<storage *> m_free;
+
+				std::vector<storage *> m_slab;
+
+				size_t m_used;
+		};
+	}
+}
+
+#endif // NOMIC_CORE_POOL_H_
@@ -63,6 +63,10 @@ namespace nomic {
 
 				void regenerate(void);
 
+				void set_size(
+					__in size_t size
+					);
+
 				GLuint m_handle;
 		};
 	}
@@ -59,37 +59,17 @@ namespace nomic {
 
 				uint32_t mode(void) const;
 
-				void set_ambient(
-					__in const glm::vec4 &ambient
-					);
-
-				void set_ambient_background(
-					__in const glm::vec4 &ambient_background
-					);
-
-				void set_ambient_position(
-					__in const glm::vec3 &ambient_position
-					);
-
 				void set_blend(
 					__in bool blend,
 					__in_opt GLenum sfactor = RENDERER_BLEND_SFACTOR_DEFAULT,
 					__in_opt GLenum dfactor = RENDERER_BLEND_DFACTOR_DEFAULT
 					);
 
-				void set_clouds(
-					__in const GLboolean clouds
-					);
-
 				void set_cull(
 					__in bool cull,
 					__in_opt GLenum mode = RENDERER_CULL_MODE_DEFAULT
 					);
 
-				void set_cycle(
-					__in GLfloat cycle
-					);
-
 				void set_depth(
 					__in bool depth,
 					__in_opt GLenum mode = RENDERER_DEPTH_MODE_DEFAULT
@@ -107,26 +87,6 @@ namespace nomic {
 					__in const glm::mat4 &model
 					);
 
-				void set_position(
-					__in const glm::vec3 &position
-					);
-
-				void set_projection(
-					__in const glm::mat4 &projection
-					);
-
-				void set_rotation(
-					__in const glm::vec3 &rotation
-					);
-
-				void set_underwater(
-					__in const GLboolean underwater
-					);
-
-				void set_view(
-					__in const glm::mat4 &view
-					);
-
 				void set_shaders(
 					__in const std::string &vertex,
 					__in const std::string &fragment
@@ -140,45 +100,6 @@ namespace nomic {
 
 				void use(void);
 
-				void use(
-					__in const glm::vec3 &position,
-					__in const glm::vec3 &rotation,
-					__in GLfloat cycle,
-					__in const glm::vec4 &ambient,
-					__in const glm::vec4 &ambient_background,
-					__in const glm::vec3 &ambient_position,
-					__in GLboolean clouds,
-					__in GLboolean underwater,
-					__in const glm::mat4 &projection
-					);
-
-				void use(
-					__in const glm::vec3 &position,
-					__in const glm::vec3 &rotation,
-					__in GLfloat cycle,
-					__in const glm::vec4 &ambient,
-					__in const glm::vec4 &ambient_background,
-					__in const glm::vec3 &ambient_position,
-					__in GLboolean clouds,
-					__in GLboolean underwater,
-					__in const glm::mat4 &projection,
-					__in const glm::mat4 &view
-					);
-
-				void use(
-					__in const glm::vec3 &position,
-					__in const glm::vec3 &rotation,
-					__in GLfloat cycle,
-					__in const glm::vec4 &ambient,
-					__in const glm::vec4 &ambient_background,
-					__in const glm::vec3 &ambient_position,
-					__in GLboolean clouds,
-					__in GLboolean underwater,
-					__in const glm::mat4 &projection,
-					__in const glm::mat4 &view,
-					__in const glm::mat4 &model
-					);
-
 			protected:
 
 				void add(void);
@@ -205,29 +126,11 @@ namespace nomic {
 
 				uint32_t m_type;
 
-				GLint m_uniform_ambient;
-
-				GLint m_uniform_ambient_background;
-
-				GLint m_uniform_ambient_position;
-
-				GLint m_uniform_clouds;
-
-				GLint m_uniform_cycle;
+				GLuint m_uniform_block_frame;
 
 				GLint m_uniform_depth_matrix;
 
 				GLint m_uniform_model;
-
-				GLint m_uniform_position;
-
-				GLint m_uniform_projection;
-
-				GLint m_uniform_rotation;
-
-				GLint m_uniform_underwater;
-
-				GLint m_uniform_view;
 		};
 	}
 }
@@ -19,6 +19,7 @@
 #ifndef NOMIC_CORE_SINGLETON_H_
 #define NOMIC_CORE_SINGLETON_H_
 
+#include <atomic>
 #include "../define.h"
 #include "./singleton_type.h"
 
@@ -160,7 +161,7 @@ namespace nomic {
 					return;
 				}
 
-				bool m_initialized;
+				std::atomic<bool> m_initialized;
 
 				std::mutex m_mutex_singleton;
 
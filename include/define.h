@@ -67,9 +67,6 @@ namespace nomic {
 	#define BLOCK_ATTRIBUTES_DEFAULT (BLOCK_ATTRIBUTE_STATIC | BLOCK_ATTRIBUTE_BREAKABLE)
 	#define BLOCK_CACTUS_MAX 2
 	#define BLOCK_CACTUS_AVERAGE 1
-	#define BLOCK_CLOUD_THICKNESS 1
-	#define BLOCK_CLOUD_THRESHOLD 0.48f
-	#define BLOCK_CLOUD_THRESHOLD_STEP 0.04f
 	#define BLOCK_COLOR_DEFAULT glm::vec4(BLOCK_COLOR_RGBA_DEFAULT)
 	#define BLOCK_COLOR_RGBA_DEFAULT 1.f, 1.f, 1.f, 1.f
 	#define BLOCK_CORAL_REEF_PAD 2
@@ -88,7 +85,6 @@ namespace nomic {
 	#define BLOCK_HEIGHT_ORE_IRON 80
 	#define BLOCK_HEIGHT_ORE_MIN 3
 	#define BLOCK_HEIGHT_BOUNDARY 1
-	#define BLOCK_HEIGHT_CLOUD (CHUNK_HEIGHT - 1)
 	#define BLOCK_HEIGHT_MAX 120
 	#define BLOCK_HEIGHT_MIN 20
 	#define BLOCK_HEIGHT_WATER (BLOCK_LEVEL_BEACH_SAND - 1)
@@ -130,12 +126,18 @@ namespace nomic {
 	#define BLOCK_TREE_SPRUCE_RADIUS_DEFAULT 3
 	#define BLOCK_UNDERWATER_PAD 1
 	#define BLOCK_WIDTH 1.f
-	#define BLOCK_WIDTH_CLOUD 4
 	#define BLOCK_WRAP_S_DEFAULT GL_CLAMP_TO_EDGE
 	#define BLOCK_WRAP_T_DEFAULT GL_CLAMP_TO_EDGE
 
+	#define CACHE_KEY_INVALID 0
+	#define CACHE_PATH_DEFAULT "./asset/cache/"
+	#define CACHE_VERSION 1
+
 	#define CAMERA_CLIP_MAX 1000.f
 	#define CAMERA_CLIP_MIN 0.1f
+	#define CAMERA_COLLISION_EYE 1.5f
+	#define CAMERA_COLLISION_HEIGHT 1.8f
+	#define CAMERA_COLLISION_WIDTH 0.3f
 	#define CAMERA_DRAG_NORMAL 0.02f
 	#define CAMERA_DRAG_UNDERWATER 0.04f
 	//#define CAMERA_FOV_CONFIGURABLE
@@ -179,13 +181,40 @@ namespace nomic {
 
 	#define CHUNK_ADJOIN_MIN 3
 	#define CHUNK_BLOCK_COUNT (CHUNK_WIDTH * CHUNK_HEIGHT * CHUNK_WIDTH)
+	#define CHUNK_BLOCK_INDEX(_X_, _Y_, _Z_) (((((_X_) * CHUNK_HEIGHT) + (_Y_)) * CHUNK_WIDTH) + (_Z_))
 	#define CHUNK_BLOCK_SURFACE_COUNT (CHUNK_WIDTH * CHUNK_WIDTH)
+	#define CHUNK_COLUMN_INDEX(_X_, _Z_) (((_Z_) * CHUNK_WIDTH) + (_X_))
+	#define CHUNK_DECORATION_DISTANCE 144.f
+	#define CHUNK_MASK_BIT_HIGHEST(_WORD_) ((CHUNK_MASK_WORD_WIDTH - 1) - __builtin_clzll(_WORD_))
+	#define CHUNK_MASK_WORD_COUNT (CHUNK_HEIGHT / CHUNK_MASK_WORD_WIDTH)
+	#define CHUNK_MASK_WORD_WIDTH 64
 	#define CHUNK_MAX_DEFAULT 64
+	#define CHUNK_POOL_SLAB_COUNT 32
 	#define CHUNK_HEIGHT 128
 	#define CHUNK_RADIUS (CHUNK_WIDTH / 2.f)
-	#define CHUNK_SPAWN_DEFERRED_TIMEOUT 60
+	#define CHUNK_SNAPSHOT_COUNT (CHUNK_SNAPSHOT_WIDTH * CHUNK_HEIGHT * CHUNK_SNAPSHOT_WIDTH)
+	#define CHUNK_SNAPSHOT_INDEX(_X_, _Y_, _Z_) \
+		((((((_X_) + 1) * CHUNK_HEIGHT) + (_Y_)) * CHUNK_SNAPSHOT_WIDTH) + ((_Z_) + 1))
+	#define CHUNK_SNAPSHOT_MASK_COUNT (CHUNK_MASK_COUNT * CHUNK_SNAPSHOT_WIDTH * CHUNK_SNAPSHOT_WIDTH * CHUNK_MASK_WORD_COUNT)
+	#define CHUNK_SNAPSHOT_MASK_INDEX(_MASK_, _X_, _Z_) \
+		((((((_MASK_) * CHUNK_SNAPSHOT_WIDTH) + ((_X_) + 1)) * CHUNK_SNAPSHOT_WIDTH) + ((_Z_) + 1)) * CHUNK_MASK_WORD_COUNT)
+	#define CHUNK_SNAPSHOT_WIDTH (CHUNK_WIDTH + 2)
 	#define CHUNK_WIDTH 16
 
+	#define CLOUD_HEIGHT (CHUNK_HEIGHT - 1)
+	#define CLOUD_INSTANCE_MAX 4096
+	#define CLOUD_LOD_COUNT 3
+	#define CLOUD_LOD_RADIUS 64
+	#define CLOUD_RADIUS (VIEW_RADIUS_DEFAULT * CHUNK_WIDTH)
+	#define CLOUD_SPEED 0.02f
+	#define CLOUD_THICKNESS 1
+	#define CLOUD_THRESHOLD 0.48f
+	#define CLOUD_WIDTH 4
+
+	#define COLLISION_EPSILON 0.001f
+	#define COLLISION_RADIUS 3
+	#define COLLISION_WIDTH ((COLLISION_RADIUS * 2) + 1)
+
 	#define CUBEMAP_FILTER_MAG_DEFAULT GL_LINEAR
 	#define CUBEMAP_FILTER_MIN_DEFAULT GL_LINEAR
 	#define CUBEMAP_SCALE_DEFAULT 1.f
@@ -218,6 +247,10 @@ namespace nomic {
 
 	#define EXCEPTION_UNKNOWN "Unknown exception"
 
+	#define FLOOR_DIVIDE(_VALUE_, _DIVISOR_) \
+		(((_VALUE_) >= 0) ? ((_VALUE_) / (_DIVISOR_)) : ((((_VALUE_) + 1) / (_DIVISOR_)) - 1))
+
+	#define FONT_CHARACTER_COUNT ((FONT_CHARACTER_MAX - FONT_CHARACTER_MIN) + 1)
 	#define FONT_CHARACTER_MIN 0
 	#define FONT_CHARACTER_MAX 127
 	#define FONT_SIZE_DEFAULT 12
@@ -251,8 +284,32 @@ namespace nomic {
 	#define HANDLE_COUNT 1
 	#define HANDLE_INVALID 0
 
+	#define HASH_SEED_DEFAULT 0xcbf29ce484222325ULL
+
 	#define INPUT_EVENT_QUEUING
 
+	#define JOB_IDLE_TIMEOUT 10
+	#define JOB_INVALID 0
+	#define JOB_MAIN_LIMIT 64
+	#define JOB_WORKER_MIN 1
+	#define JOB_WORKER_NONE UINT32_MAX
+
+	#define KILOBYTE 1024
+
+	#define LIGHT_ATTENUATION_DEFAULT 1
+	#define LIGHT_ATTENUATION_LEAVES 2
+	#define LIGHT_ATTENUATION_OPAQUE LIGHT_LEVEL_MAX
+	#define LIGHT_ATTENUATION_WATER 3
+	#define LIGHT_BLOCK(_LIGHT_) ((_LIGHT_) & 0xf)
+	#define LIGHT_EMISSION_LAMP (LIGHT_LEVEL_MAX - 1)
+	#define LIGHT_EMISSION_NONE LIGHT_LEVEL_MIN
+	#define LIGHT_LEVEL_MAX 15
+	#define LIGHT_LEVEL_MIN 0
+	#define LIGHT_PACK(_SKY_, _BLOCK_) ((((_SKY_) & 0xf) << 4) | ((_BLOCK_) & 0xf))
+	#define LIGHT_SKY(_LIGHT_) (((_LIGHT_) >> 4) & 0xf)
+	#define LIGHT_SKY_DEFAULT LIGHT_PACK(LIGHT_LEVEL_MAX, LIGHT_LEVEL_MIN)
+	#define LIGHT_UPDATE_INCREMENTAL_MAX 512
+
 	#define MESSAGE_POSITION_DEFAULT glm::uvec2(MESSAGE_POSITION_LEFT_DEFAULT, MESSAGE_POSITION_TOP_DEFAULT)
 	#define MESSAGE_POSITION_LEFT_DEFAULT 10
 	#define MESSAGE_POSITION_TOP_DEFAULT 10
@@ -296,12 +353,20 @@ namespace nomic {
 
 	#define PLAYER_HEIGHT 2.f
 
+	#define POOL_SLAB_COUNT_DEFAULT 16
+
 	#define RANDOM_SEED_DEFAULT 0
 
 	#define QUEUE_MAX 0x1000
 
 	#define REFERENCE_INIT 1
 
+	#define REGION_DEBUG_EXTENT 4
+	#define REGION_DEBUG_RADIUS 4
+	#define REGION_EXTENT_MAX 32
+
+	#define RENDER_TEXTURE_NONE UINT8_MAX
+
 	#define RENDERER_BLEND_DEFAULT true
 	#define RENDERER_BLEND_DFACTOR_DEFAULT GL_ONE_MINUS_SRC_ALPHA
 	#define RENDERER_BLEND_SFACTOR_DEFAULT GL_SRC_ALPHA
@@ -317,6 +382,9 @@ namespace nomic {
 	#define RETICLE_LINE_WIDTH 2.f
 	#define RETICLE_WIDTH 0.025f
 
+	#define RUNTIME_ARGUMENT_VIEW "--view"
+	#define RUNTIME_ARGUMENT_VIEW_GOVERNOR "--view-governor"
+
 	#define RUNTIME_DELAY_PAUSE 200
 	#define RUNTIME_DELAY_RENDER 10
 	//#define RUNTIME_DELAY_RENDERING
@@ -336,9 +404,7 @@ namespace nomic {
 	//#define SELECTOR_BOUNDS_DEBUG_CONTROL
 	#define SELECTOR_COLOR_ALPHA 0.0f
 	#define SELECTOR_COLOR_DEFAULT glm::vec4(0.2f, 0.2f, 0.2f, 0.9f)
-	#define SELECTOR_DISTANCE_MAX 60.f
-	#define SELECTOR_DISTANCE_STEP 0.1f
-	#define SELECTOR_DISTANCE_SCALE glm::vec3(SELECTOR_DISTANCE_STEP, SELECTOR_DISTANCE_STEP, SELECTOR_DISTANCE_STEP)
+	#define SELECTOR_DISTANCE_MAX 6.f
 	#define SELECTOR_SCALE_DEFAULT 1.f
 	#define SELECTOR_SHOW_BOUNDS
 
@@ -359,7 +425,17 @@ namespace nomic {
 
 	#define SPAWN_RADIUS 6
 	#define SPAWN_RANDOM
-	#define SPAWN_TIMEOUT_DEFAULT 0
+
+	#define STREAM_CHUNK_RADIUS (CHUNK_WIDTH * 0.7071f)
+	#define STREAM_EVICT_MARGIN 2
+	#define STREAM_HEADING_THRESHOLD 0.9f
+	#define STREAM_INFLIGHT_MAX 32
+	#define STREAM_PREFETCH_DELTA_MAX CHUNK_WIDTH
+	#define STREAM_PREFETCH_PRIORITY 1000.f
+	#define STREAM_PREFETCH_SMOOTHING 0.25f
+	#define STREAM_PREFETCH_TIME 2.f
+	#define STREAM_WEIGHT_ALIGNMENT 1.f
+	#define STREAM_WEIGHT_HIDDEN 4.f
 
 	#define STRING_EMPTY "<EMPTY>"
 	#define STRING_INVALID "<INVALID>"
@@ -392,7 +468,8 @@ namespace nomic {
 	#define SUN_DELTA_MIN 0.f
 	#define SUN_DELTA_MAX 1.f
 	#define SUN_PATH_DEFAULT "./asset/texture/default/sun.bmp"
-	#define SUN_RADIUS_DEFAULT (VIEW_RADIUS_RUNTIME * CHUNK_WIDTH) + (16 * CHUNK_WIDTH)
+	#define SUN_RADIUS(_VIEW_) (((_VIEW_) * CHUNK_WIDTH) + (16 * CHUNK_WIDTH))
+	#define SUN_RADIUS_DEFAULT SUN_RADIUS(VIEW_RADIUS_DEFAULT)
 	#define SUN_RISE 0.2f
 	#define SUN_SCALE_DEFAULT 240.f
 	#define SUN_SET 0.8f
@@ -445,29 +522,49 @@ namespace nomic {
 	#define TRANSFORM_ROTATION_DEFAULT glm::vec3(0.f, 0.f, glm::pi<GLfloat>())
 	#define TRANSFORM_UP_DEFAULT glm::vec3(0.f, 1.f, 0.f)
 
+	#define UID_GENERATION_BITS 8
+	#define UID_GENERATION_INIT 1
+	#define UID_GENERATION_MASK ((1 << UID_GENERATION_BITS) - 1)
+	#define UID_INDEX_BITS (32 - UID_GENERATION_BITS - UID_SHARD_BITS)
+	#define UID_INDEX_MASK ((1 << UID_INDEX_BITS) - 1)
 	#define UID_INVALID 0
+	#define UID_SHARD_BITS 4
+	#define UID_SHARD_COUNT (1 << UID_SHARD_BITS)
+	#define UID_SHARD_MASK (UID_SHARD_COUNT - 1)
+	#define UID_SLOT_NONE UINT32_MAX
 
 	#define UNIFORM_MATRIX_DEFAULT glm::mat4(1.f)
 
-	#define UNIFORM_AMBIENT "ambient"
-	#define UNIFORM_AMBIENT_BACKGROUND "ambient_background"
-	#define UNIFORM_AMBIENT_POSITION "ambient_position"
-	#define UNIFORM_CLOUDS "clouds"
+	#define UNIFORM_BLOCK_FRAME "frame"
+	#define UNIFORM_BLOCK_FRAME_BINDING 0
+	#define UNIFORM_BLOCK_FRAME_SIZE 288
 	#define UNIFORM_COLOR "color"
-	#define UNIFORM_CYCLE "cycle"
 	#define UNIFORM_DEPTH_MATRIX "depth_matrix"
 	#define UNIFORM_MODEL "model"
-	#define UNIFORM_POSITION "position"
-	#define UNIFORM_PROJECTION "projection"
-	#define UNIFORM_ROTATION "rotation"
-	#define UNIFORM_UNDERWATER "underwater"
-	#define UNIFORM_VIEW "view"
-
-	#define VIEW_RADIUS_RUNTIME (VIEW_WIDTH / 2)
-	#define VIEW_RADIUS_SPAWN (VIEW_WIDTH / 2)
+
+	#define VIEW_GOVERNOR_DEFAULT false
+	#define VIEW_GOVERNOR_HYSTERESIS 0.2f
+	#define VIEW_GOVERNOR_INTERVAL RUNTIME_TICKS_PER_SECOND
+	#define VIEW_GOVERNOR_SMOOTHING 0.1f
+	#define VIEW_GOVERNOR_TARGET_DEFAULT 10.f
+
+	#define VIEW_RADIUS_DEFAULT (VIEW_WIDTH / 2)
+	#define VIEW_RADIUS_MAX 32
+	#define VIEW_RADIUS_MIN 4
+	#define VIEW_RADIUS_SPAWN (SPAWN_RADIUS + 4)
 	#define VIEW_SELECTIVE_SHOW
 	#define VIEW_WIDTH 38
 
+	#define WATER_ATTRIBUTES (BLOCK_ATTRIBUTES_DEFAULT & ~BLOCK_ATTRIBUTE_BREAKABLE)
+	#define WATER_LEVEL(_ATTRIBUTES_) (((_ATTRIBUTES_) >> 4) & 0xf)
+	#define WATER_LEVEL_ATTRIBUTES(_ATTRIBUTES_, _LEVEL_) (((_ATTRIBUTES_) & 0xf) | (((_LEVEL_) & 0xf) << 4))
+	#define WATER_LEVEL_FALLING 1
+	#define WATER_LEVEL_MAX 7
+	#define WATER_LEVEL_SOURCE 0
+	#define WATER_SOURCE_MIN 2
+	#define WATER_UPDATE_BUDGET 512
+	#define WATER_UPDATE_INTERVAL 4
+
 	enum {
 		BITMAP_DEPTH_8 = 1,
 		BITMAP_DEPTH_16,
@@ -476,71 +573,114 @@ namespace nomic {
 	};
 
 	enum {
-		BLOCK_AIR = 0,
-		BLOCK_CLOUD,
-		BLOCK_BOUNDARY,
-		BLOCK_DIRT,
-		BLOCK_DIRT_GRASS_SIDE,
-		BLOCK_GRASS,
-		BLOCK_STONE,
-		BLOCK_STONE_SNOW_SIDE,
-		BLOCK_SNOW,
-		BLOCK_GRAVEL,
-		BLOCK_SAND,
-		BLOCK_SANDSTONE,
-		BLOCK_SANDSTONE_SIDE,
-		BLOCK_COBBLESTONE,
-		BLOCK_COBBLESTONE_MOSSY,
-		BLOCK_OBSIDIAN,
-		BLOCK_ORE_GOLD,
-		BLOCK_ORE_IRON,
-		BLOCK_ORE_COAL,
-		BLOCK_ORE_DIAMOND,
-		BLOCK_CLAY,
-		BLOCK_BRICK,
-		BLOCK_GLASS,
-		BLOCK_WOOD_OAK,
-		BLOCK_WOOD_OAK_SIDE,
-		BLOCK_PLANK_OAK,
-		BLOCK_WOOD_SPRUCE,
-		BLOCK_WOOD_SPRUCE_SIDE,
-		BLOCK_PLANK_SPRUCE,
-		BLOCK_LEAVES_OAK,
-		BLOCK_LEAVES_SPRUCE,
-		BLOCK_GRASS_SHORT,
-		BLOCK_GRASS_TALL,
-		BLOCK_FLOWER_RED,
-		BLOCK_FLOWER_YELLOW,
-		BLOCK_SHRUB,
-		BLOCK_CACTUS,
-		BLOCK_CACTUS_BOTTOM,
-		BLOCK_CACTUS_SIDE,
-		BLOCK_SUGAR_CANE,
-		BLOCK_SEAGRASS_GREEN,
-		BLOCK_SEAGRASS_BROWN,
-		BLOCK_CORAL_ORANGE,
-		BLOCK_CORAL_PINK,
-		BLOCK_CORAL_PURPLE,
-		BLOCK_CORAL_BLUE,
-		BLOCK_CORAL_BROWN,
-		BLOCK_WATER,
+		BLOCK_FLAG_DECORATION = 1,
+		BLOCK_FLAG_PASSABLE = 2,
+		BLOCK_FLAG_ROTATABLE = 4,
+		BLOCK_FLAG_SELECTABLE = 8,
+		BLOCK_FLAG_SMALL = 16,
+		BLOCK_FLAG_TEXTURE = 32,
+		BLOCK_FLAG_TRANSPARENT = 64,
 	};
 
-	#define BLOCK_MAX BLOCK_WATER
+	#define BLOCK_FLAGS_CLEAR (BLOCK_FLAG_SELECTABLE | BLOCK_FLAG_TRANSPARENT)
+	#define BLOCK_FLAGS_DECORATION (BLOCK_FLAG_DECORATION | BLOCK_FLAG_PASSABLE | BLOCK_FLAGS_CLEAR)
+	#define BLOCK_FLAGS_EMPTY (BLOCK_FLAG_PASSABLE | BLOCK_FLAG_TRANSPARENT)
+	#define BLOCK_FLAGS_LOG (BLOCK_FLAG_ROTATABLE | BLOCK_FLAG_SELECTABLE)
+	#define BLOCK_FLAGS_SMALL (BLOCK_FLAG_SMALL | BLOCK_FLAGS_CLEAR)
+	#define BLOCK_FLAGS_SOLID BLOCK_FLAG_SELECTABLE
+	#define BLOCK_FLAGS_TEXTURE (BLOCK_FLAG_SELECTABLE | BLOCK_FLAG_TEXTURE)
+
+	// (type, string, flags, top, bottom, side, attenuation, emission), in block id order
+	#define BLOCK_REGISTRY(_ENTRY_) \
+		_ENTRY_(AIR, "Air", EMPTY, AIR, AIR, AIR, DEFAULT, NONE) \
+		_ENTRY_(CLOUD, "Cloud", EMPTY, CLOUD, CLOUD, CLOUD, DEFAULT, NONE) \
+		_ENTRY_(BOUNDARY, "Boundary", SOLID, BOUNDARY, BOUNDARY, BOUNDARY, OPAQUE, NONE) \
+		_ENTRY_(DIRT, "Dirt", SOLID, DIRT, DIRT, DIRT, OPAQUE, NONE) \
+		_ENTRY_(DIRT_GRASS_SIDE, "Dirt-Grass-Side", TEXTURE, DIRT_GRASS_SIDE, DIRT_GRASS_SIDE, DIRT_GRASS_SIDE, OPAQUE, NONE) \
+		_ENTRY_(GRASS, "Grass", SOLID, GRASS, DIRT, DIRT_GRASS_SIDE, OPAQUE, NONE) \
+		_ENTRY_(STONE, "Stone", SOLID, STONE, STONE, STONE, OPAQUE, NONE) \
+		_ENTRY_(STONE_SNOW_SIDE, "Stone-Snow-Side", TEXTURE, STONE_SNOW_SIDE, STONE_SNOW_SIDE, STONE_SNOW_SIDE, OPAQUE, NONE) \
+		_ENTRY_(SNOW, "Snow", SOLID, SNOW, STONE, STONE_SNOW_SIDE, OPAQUE, NONE) \
+		_ENTRY_(GRAVEL, "Gravel", SOLID, GRAVEL, GRAVEL, GRAVEL, OPAQUE, NONE) \
+		_ENTRY_(SAND, "Sand", SOLID, SAND, SAND, SAND, OPAQUE, NONE) \
+		_ENTRY_(SANDSTONE, "Sandstone", SOLID, SANDSTONE, SANDSTONE, SANDSTONE_SIDE, OPAQUE, NONE) \
+		_ENTRY_(SANDSTONE_SIDE, "Sandstone-Side", TEXTURE, SANDSTONE_SIDE, SANDSTONE_SIDE, SANDSTONE_SIDE, OPAQUE, NONE) \
+		_ENTRY_(COBBLESTONE, "Cobblestone", SOLID, COBBLESTONE, COBBLESTONE, COBBLESTONE, OPAQUE, NONE) \
+		_ENTRY_(COBBLESTONE_MOSSY, "Cobblestone-Mossy", SOLID, COBBLESTONE_MOSSY, COBBLESTONE_MOSSY, COBBLESTONE_MOSSY, OPAQUE, NONE) \
+		_ENTRY_(OBSIDIAN, "Obsidian", SOLID, OBSIDIAN, OBSIDIAN, OBSIDIAN, OPAQUE, NONE) \
+		_ENTRY_(ORE_GOLD, "Ore-Gold", SOLID, ORE_GOLD, ORE_GOLD, ORE_GOLD, OPAQUE, NONE) \
+		_ENTRY_(ORE_IRON, "Ore-Iron", SOLID, ORE_IRON, ORE_IRON, ORE_IRON, OPAQUE, NONE) \
+		_ENTRY_(ORE_COAL, "Ore-Coal", SOLID, ORE_COAL, ORE_COAL, ORE_COAL, OPAQUE, NONE) \
+		_ENTRY_(ORE_DIAMOND, "Ore-Diamond", SOLID, ORE_DIAMOND, ORE_DIAMOND, ORE_DIAMOND, OPAQUE, NONE) \
+		_ENTRY_(CLAY, "Clay", SOLID, CLAY, CLAY, CLAY, OPAQUE, NONE) \
+		_ENTRY_(BRICK, "Brick", SOLID, BRICK, BRICK, BRICK, OPAQUE, NONE) \
+		_ENTRY_(GLASS, "Glass", CLEAR, GLASS, GLASS, GLASS, DEFAULT, NONE) \
+		_ENTRY_(WOOD_OAK, "Wood-Oak", LOG, WOOD_OAK, WOOD_OAK, WOOD_OAK_SIDE, OPAQUE, NONE) \
+		_ENTRY_(WOOD_OAK_SIDE, "Wood-Oak-Side", TEXTURE, WOOD_OAK_SIDE, WOOD_OAK_SIDE, WOOD_OAK_SIDE, OPAQUE, NONE) \
+		_ENTRY_(PLANK_OAK, "Plank-Oak", SOLID, PLANK_OAK, PLANK_OAK, PLANK_OAK, OPAQUE, NONE) \
+		_ENTRY_(WOOD_SPRUCE, "Wood-Spruce", LOG, WOOD_SPRUCE, WOOD_SPRUCE, WOOD_SPRUCE_SIDE, OPAQUE, NONE) \
+		_ENTRY_(WOOD_SPRUCE_SIDE, "Wood-Spruce-Side", TEXTURE, WOOD_SPRUCE_SIDE, WOOD_SPRUCE_SIDE, WOOD_SPRUCE_SIDE, OPAQUE, NONE) \
+		_ENTRY_(PLANK_SPRUCE, "Plank-Spruce", SOLID, PLANK_SPRUCE, PLANK_SPRUCE, PLANK_SPRUCE, OPAQUE, NONE) \
+		_ENTRY_(LEAVES_OAK, "Leaves-Oak", CLEAR, LEAVES_OAK, LEAVES_OAK, LEAVES_OAK, LEAVES, NONE) \
+		_ENTRY_(LEAVES_SPRUCE, "Leaves-Spruce", CLEAR, LEAVES_SPRUCE, LEAVES_SPRUCE, LEAVES_SPRUCE, LEAVES, NONE) \
+		_ENTRY_(GRASS_SHORT, "Grass-Short", DECORATION, GRASS_SHORT, GRASS_SHORT, GRASS_SHORT, DEFAULT, NONE) \
+		_ENTRY_(GRASS_TALL, "Grass-Tall", DECORATION, GRASS_TALL, GRASS_TALL, GRASS_TALL, DEFAULT, NONE) \
+		_ENTRY_(FLOWER_RED, "Flower-Red", DECORATION, FLOWER_RED, FLOWER_RED, FLOWER_RED, DEFAULT, NONE) \
+		_ENTRY_(FLOWER_YELLOW, "Flower-Yellow", DECORATION, FLOWER_YELLOW, FLOWER_YELLOW, FLOWER_YELLOW, DEFAULT, NONE) \
+		_ENTRY_(SHRUB, "Shrub", DECORATION, SHRUB, SHRUB, SHRUB, DEFAULT, NONE) \
+		_ENTRY_(CACTUS, "Cactus", SMALL, CACTUS, CACTUS_BOTTOM, CACTUS_SIDE, DEFAULT, NONE) \
+		_ENTRY_(CACTUS_BOTTOM, "Cactus-Bottom", TEXTURE, CACTUS_BOTTOM, CACTUS_BOTTOM, CACTUS_BOTTOM, OPAQUE, NONE) \
+		_ENTRY_(CACTUS_SIDE, "Cactus-Side", TEXTURE, CACTUS_SIDE, CACTUS_SIDE, CACTUS_SIDE, OPAQUE, NONE) \
+		_ENTRY_(SUGAR_CANE, "Sugar-Cane", DECORATION, SUGAR_CANE, SUGAR_CANE, SUGAR_CANE, DEFAULT, NONE) \
+		_ENTRY_(SEAGRASS_GREEN, "Seagrass-Green", DECORATION, SEAGRASS_GREEN, SEAGRASS_GREEN, SEAGRASS_GREEN, DEFAULT, NONE) \
+		_ENTRY_(SEAGRASS_BROWN, "Seagrass-Brown", DECORATION, SEAGRASS_BROWN, SEAGRASS_BROWN, SEAGRASS_BROWN, DEFAULT, NONE) \
+		_ENTRY_(CORAL_ORANGE, "Coral-Orange", DECORATION, CORAL_ORANGE, CORAL_ORANGE, CORAL_ORANGE, DEFAULT, NONE) \
+		_ENTRY_(CORAL_PINK, "Coral-Pink", DECORATION, CORAL_PINK, CORAL_PINK, CORAL_PINK, DEFAULT, NONE) \
+		_ENTRY_(CORAL_PURPLE, "Coral-Purple", DECORATION, CORAL_PURPLE, CORAL_PURPLE, CORAL_PURPLE, DEFAULT, NONE) \
+		_ENTRY_(CORAL_BLUE, "Coral-Blue", DECORATION, CORAL_BLUE, CORAL_BLUE, CORAL_BLUE, DEFAULT, NONE) \
+		_ENTRY_(CORAL_BROWN, "Coral-Brown", DECORATION, CORAL_BROWN, CORAL_BROWN, CORAL_BROWN, DEFAULT, NONE) \
+		_ENTRY_(WATER, "Water", EMPTY, WATER, WATER, WATER, WATER, NONE) \
+		_ENTRY_(LAMP, "Lamp", SOLID, LAMP, LAMP, LAMP, OPAQUE, LAMP)
+
+	#define BLOCK_REGISTRY_ATTENUATION(_TYPE_, _STRING_, _FLAGS_, _TOP_, _BOTTOM_, _SIDE_, _ATTENUATION_, _EMISSION_) \
+		LIGHT_ATTENUATION_##_ATTENUATION_,
+	#define BLOCK_REGISTRY_EMISSION(_TYPE_, _STRING_, _FLAGS_, _TOP_, _BOTTOM_, _SIDE_, _ATTENUATION_, _EMISSION_) \
+		LIGHT_EMISSION_##_EMISSION_,
+	#define BLOCK_REGISTRY_FACE(_TYPE_, _STRING_, _FLAGS_, _TOP_, _BOTTOM_, _SIDE_, _ATTENUATION_, _EMISSION_) \
+		{ BLOCK_##_SIDE_, BLOCK_##_SIDE_, BLOCK_##_TOP_, BLOCK_##_BOTTOM_, BLOCK_##_SIDE_, BLOCK_##_SIDE_ },
+	#define BLOCK_REGISTRY_FLAGS(_TYPE_, _STRING_, _FLAGS_, _TOP_, _BOTTOM_, _SIDE_, _ATTENUATION_, _EMISSION_) \
+		BLOCK_FLAGS_##_FLAGS_,
+	#define BLOCK_REGISTRY_STRING(_TYPE_, _STRING_, _FLAGS_, _TOP_, _BOTTOM_, _SIDE_, _ATTENUATION_, _EMISSION_) \
+		_STRING_,
+	#define BLOCK_REGISTRY_TYPE(_TYPE_, _STRING_, _FLAGS_, _TOP_, _BOTTOM_, _SIDE_, _ATTENUATION_, _EMISSION_) \
+		BLOCK_##_TYPE_,
+
+	enum {
+		BLOCK_REGISTRY(BLOCK_REGISTRY_TYPE)
+	};
 
 	static const std::string BLOCK_STR[] = {
-		"Air", "Cloud", "Boundary", "Dirt", "Dirt-Grass-Side", "Grass", "Stone", "Stone-Snow-Side", "Snow",
-		"Gravel", "Sand", "Sandstone", "Sandstone-Side", "Cobblestone", "Cobblestone-Mossy", "Obsidian",
-		"Ore-Gold", "Ore-Iron", "Ore-Coal", "Ore-Diamond", "Clay", "Brick", "Glass", "Wood-Oak", "Wood-Oak-Side",
-		"Plank-Oak", "Wood-Spruce", "Wood-Spruce-Side", "Plank-Spruce", "Leaves-Oak", "Leaves-Spruce", "Grass-Short",
-		"Grass-Tall", "Flower-Red", "Flower-Yellow", "Shrub", "Cactus", "Cactus-Bottom", "Cactus-Side",
-		"Sugar-Cane", "Seagrass-Green", "Seagrass-Brown", "Coral-Orange", "Coral-Pink", "Coral-Purple",
-		"Coral-Blue", "Coral-Brown", "Water",
+		BLOCK_REGISTRY(BLOCK_REGISTRY_STRING)
 		};
 
+	#define BLOCK_COUNT (sizeof(BLOCK_STR) / sizeof(BLOCK_STR[0]))
+	#define BLOCK_MAX (BLOCK_COUNT - 1)
+
 	#define BLOCK_STRING(_TYPE_) \
 		(((_TYPE_) > BLOCK_MAX) ? STRING_UNKNOWN : STRING_CHECK(BLOCK_STR[_TYPE_]))
 
+	static constexpr uint8_t BLOCK_FLAG[] = {
+		BLOCK_REGISTRY(BLOCK_REGISTRY_FLAGS)
+		};
+
+	static constexpr uint8_t BLOCK_LIGHT_ATTENUATION[] = {
+		BLOCK_REGISTRY(BLOCK_REGISTRY_ATTENUATION)
+		};
+
+	static constexpr uint8_t BLOCK_LIGHT_EMISSION[] = {
+		BLOCK_REGISTRY(BLOCK_REGISTRY_EMISSION)
+		};
+
 	enum {
 		BLOCK_ATTRIBUTE_STATIC = 1,
 		BLOCK_ATTRIBUTE_BREAKABLE = 2,
@@ -573,6 +713,10 @@ namespace nomic {
 	#define BLOCK_FACE_STRING(_TYPE_) \
 		(((_TYPE_) > BLOCK_FACE_MAX) ? STRING_UNKNOWN : STRING_CHECK(BLOCK_FACE_STR[_TYPE_]))
 
+	static constexpr uint8_t BLOCK_FACE_TEXTURE[][BLOCK_FACE_COUNT] = {
+		BLOCK_REGISTRY(BLOCK_REGISTRY_FACE)
+		};
+
 	enum {
 		BLOCK_ZONE_ALPINE = 0,
 		BLOCK_ZONE_BEACH,
@@ -582,6 +726,31 @@ namespace nomic {
 		BLOCK_ZONE_SEA,
 	};
 
+	enum {
+		CHARACTER_ATTRIBUTE_WIDTH = 0,
+		CHARACTER_ATTRIBUTE_HEIGHT,
+		CHARACTER_ATTRIBUTE_LEFT,
+		CHARACTER_ATTRIBUTE_TOP,
+		CHARACTER_ATTRIBUTE_ADVANCE,
+	};
+
+	#define CHARACTER_ATTRIBUTE_COUNT (CHARACTER_ATTRIBUTE_MAX + 1)
+	#define CHARACTER_ATTRIBUTE_MAX CHARACTER_ATTRIBUTE_ADVANCE
+
+	enum {
+		CHUNK_MASK_AIR = 0,
+		CHUNK_MASK_CLOUD,
+		CHUNK_MASK_DECORATION,
+		CHUNK_MASK_PASSABLE,
+		CHUNK_MASK_SELECTABLE,
+		CHUNK_MASK_TRANSPARENT,
+		CHUNK_MASK_VISIBLE,
+		CHUNK_MASK_WATER,
+	};
+
+	#define CHUNK_MASK_COUNT (CHUNK_MASK_MAX + 1)
+	#define CHUNK_MASK_MAX CHUNK_MASK_WATER
+
 	enum {
 		ENTITY_CAMERA = 0,
 		ENTITY_SKYBOX,
@@ -595,6 +764,7 @@ namespace nomic {
 		ENTITY_RETICLE,
 		ENTITY_SELECTOR,
 		ENTITY_PANEL,
+		ENTITY_CLOUD,
 	};
 
 	enum {
@@ -610,9 +780,17 @@ namespace nomic {
 		KEY_FORWARD = SDL_SCANCODE_W,
 		KEY_LEFT = SDL_SCANCODE_A,
 		KEY_LEFT_STRAFE = SDL_SCANCODE_Q,
+		KEY_REGION_CLEAR = SDL_SCANCODE_F6,
+		KEY_REGION_COPY = SDL_SCANCODE_F7,
+		KEY_REGION_FILL = SDL_SCANCODE_F5,
+		KEY_REGION_PASTE = SDL_SCANCODE_F8,
+		KEY_REGION_REPLACE = SDL_SCANCODE_F9,
 		KEY_RIGHT = SDL_SCANCODE_D,
 		KEY_RIGHT_STRAFE = SDL_SCANCODE_E,
 		KEY_SPRINT = SDL_SCANCODE_LSHIFT,
+		KEY_VIEW_DECREASE = SDL_SCANCODE_MINUS,
+		KEY_VIEW_GOVERNOR = SDL_SCANCODE_F10,
+		KEY_VIEW_INCREASE = SDL_SCANCODE_EQUALS,
 	};
 
 	enum {
@@ -622,6 +800,21 @@ namespace nomic {
 		INPUT_WHEEL,
 	};
 
+	enum {
+		JOB_AFFINITY_ANY = 0,
+		JOB_AFFINITY_MAIN,
+	};
+
+	#define JOB_AFFINITY_MAX JOB_AFFINITY_MAIN
+
+	enum {
+		JOB_PRIORITY_HIGH = 0,
+		JOB_PRIORITY_NORMAL,
+		JOB_PRIORITY_LOW,
+	};
+
+	#define JOB_PRIORITY_MAX JOB_PRIORITY_LOW
+
 	enum {
 		PRIMITIVE_CHARACTER = 0,
 		PRIMITIVE_CUBEMAP,
@@ -633,9 +826,12 @@ namespace nomic {
 		PRIMITIVE_VBO,
 	};
 
+	#define PRIMITIVE_MAX PRIMITIVE_VBO
+
 	enum {
 		RENDERER_BACKGROUND_SKYBOX = 0,
 		RENDERER_BACKGROUND_SUN,
+		RENDERER_BACKGROUND_CLOUD,
 		RENDERER_CHUNK,
 		RENDERER_CHUNK_SHADOWMAP,
 		RENDERER_DEBUG_AXIS,
@@ -652,9 +848,9 @@ namespace nomic {
 	#define RENDERER_MAX RENDERER_SPAWN_MESSAGE
 
 	static const std::string RENDERER_STR[] = {
-		"Background-Skybox", "Background-Sun", "Chunk", "Chunk-Shadowmap", "Debug-Axis", "Debug-Block", "Debug-Diagnostic",
-		"Foreground-Reticle", "Foreground-Selector", "Foreground-Panel", "Spawn-Backdrop", "Spawn-Diagnostic",
-		"Spawn-Message",
+		"Background-Skybox", "Background-Sun", "Background-Cloud", "Chunk", "Chunk-Shadowmap", "Debug-Axis", "Debug-Block",
+		"Debug-Diagnostic", "Foreground-Reticle", "Foreground-Selector", "Foreground-Panel", "Spawn-Backdrop",
+		"Spawn-Diagnostic", "Spawn-Message",
 	};
 
 	#define RENDERER_STRING(_TYPE_) \
@@ -665,6 +861,39 @@ namespace nomic {
 		RENDER_ORTHOGONAL,
 	};
 
+	enum {
+		RENDER_PASS_BACKGROUND = 0,
+		RENDER_PASS_OPAQUE,
+		RENDER_PASS_DECORATION,
+		RENDER_PASS_TRANSPARENT,
+		RENDER_PASS_FOREGROUND,
+	};
+
+	#define RENDER_PASS_MAX RENDER_PASS_FOREGROUND
+
+	static const std::string RENDER_PASS_STR[] = {
+		"Background", "Opaque", "Decoration", "Transparent", "Foreground",
+	};
+
+	#define RENDER_PASS_STRING(_TYPE_) \
+		(((_TYPE_) > RENDER_PASS_MAX) ? STRING_UNKNOWN : STRING_CHECK(RENDER_PASS_STR[_TYPE_]))
+
+	enum {
+		RENDER_STATE_CULL = 0,
+		RENDER_STATE_MODEL,
+		RENDER_STATE_PROGRAM,
+		RENDER_STATE_TEXTURE,
+	};
+
+	#define RENDER_STATE_MAX RENDER_STATE_TEXTURE
+
+	static const std::string RENDER_STATE_STR[] = {
+		"Cull", "Model", "Program", "Texture",
+	};
+
+	#define RENDER_STATE_STRING(_TYPE_) \
+		(((_TYPE_) > RENDER_STATE_MAX) ? STRING_UNKNOWN : STRING_CHECK(RENDER_STATE_STR[_TYPE_]))
+
 	class utility {
 
 		public:
@@ -674,9 +903,12 @@ namespace nomic {
 				__in const glm::uvec3 &block
 				);
 
-			static bool block_decoration(
+			static inline bool block_decoration(
 				__in uint8_t type
-				);
+				)
+			{
+				return ((type <= BLOCK_MAX) && (BLOCK_FLAG[type] & BLOCK_FLAG_DECORATION));
+			}
 
 			static uint8_t block_face_type(
 				__in uint8_t type,
@@ -692,27 +924,59 @@ namespace nomic {
 				__in uint8_t type_side
 				);
 
-			static bool block_passable(
+			static inline uint8_t block_light(
 				__in uint8_t type
-				);
+				)
+			{
+				return ((type <= BLOCK_MAX) ? BLOCK_LIGHT_EMISSION[type] : LIGHT_LEVEL_MIN);
+			}
 
-			static bool block_selectable(
+			static inline uint8_t block_light_attenuation(
 				__in uint8_t type
-				);
+				)
+			{
+				return ((type <= BLOCK_MAX) ? BLOCK_LIGHT_ATTENUATION[type] : LIGHT_ATTENUATION_OPAQUE);
+			}
 
-			static bool block_small(
+			static inline bool block_passable(
 				__in uint8_t type
-				);
+				)
+			{
+				return ((type <= BLOCK_MAX) && (BLOCK_FLAG[type] & BLOCK_FLAG_PASSABLE));
+			}
 
-			static bool block_transparent(
+			static inline bool block_selectable(
 				__in uint8_t type
-				);
+				)
+			{
+				return ((type > BLOCK_MAX) || (BLOCK_FLAG[type] & BLOCK_FLAG_SELECTABLE));
+			}
+
+			static inline bool block_small(
+				__in uint8_t type
+				)
+			{
+				return ((type <= BLOCK_MAX) && (BLOCK_FLAG[type] & BLOCK_FLAG_SMALL));
+			}
+
+			static inline bool block_transparent(
+				__in uint8_t type
+				)
+			{
+				return ((type <= BLOCK_MAX) && (BLOCK_FLAG[type] & BLOCK_FLAG_TRANSPARENT));
+			}
 
 			static std::string format_as_string(
 				__in const char *format,
 				...
 				);
 
+			static uint64_t hash(
+				__in const void *data,
+				__in size_t length,
+				__in_opt uint64_t seed = HASH_SEED_DEFAULT
+				);
+
 			static void position_as_block(
 				__in const glm::vec3 &position,
 				__inout glm::ivec2 &chunk,
@@ -22,7 +22,7 @@
 #include <map>
 #include "./object.h"
 #include "../event/input.h"
-#include "../terrain/manager.h"
+#include "../terrain/collision.h"
 
 namespace nomic {
 
@@ -98,6 +98,10 @@ namespace nomic {
 					__in float fov
 					);
 
+				void set_view_radius(
+					__in uint32_t radius
+					);
+
 				virtual std::string to_string(
 					__in_opt bool verbose = false
 					) const;
@@ -106,6 +110,8 @@ namespace nomic {
 
 				glm::mat4 &view(void);
 
+				uint32_t view_radius(void) const;
+
 				void wheel(
 					__in uint32_t direction,
 					__in int32_t x,
@@ -118,6 +124,8 @@ namespace nomic {
 
 				void update_perspective(void);
 
+				nomic::terrain::collision m_collision;
+
 				glm::uvec2 m_dimensions;
 
 				bool m_falling;
@@ -144,6 +152,8 @@ namespace nomic {
 
 				glm::vec3 m_velocity;
 
+				uint32_t m_view_radius;
+
 				int32_t m_wheel;
 		};
 	}
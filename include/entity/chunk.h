@@ -22,6 +22,7 @@
 #include <map>
 #include <tuple>
 #include "../terrain/chunk.h"
+#include "../job/manager.h"
 #include "../terrain/generator.h"
 #include "./object.h"
 
@@ -29,7 +30,14 @@ namespace nomic {
 
 	namespace entity {
 
-		typedef std::tuple<std::vector<glm::vec2>, std::vector<glm::vec3>, std::vector<glm::vec3>, uint32_t, uint32_t> chunk_data;
+		typedef std::tuple<std::vector<glm::vec2>, std::vector<glm::vec3>, std::vector<glm::vec3>, std::vector<glm::vec3>> chunk_data;
+
+		typedef std::tuple<std::vector<glm::vec4>, std::vector<glm::vec3>> chunk_decoration;
+
+		typedef std::tuple<std::vector<glm::vec2>, std::vector<glm::vec3>, std::vector<glm::vec3>, std::vector<glm::vec3>,
+			std::vector<glm::vec4>, std::vector<glm::vec3>> chunk_mesh;
+
+		typedef std::tuple<uint32_t, uint32_t> chunk_range;
 
 		class chunk :
 				public nomic::entity::object,
@@ -42,6 +50,10 @@ namespace nomic {
 					__in nomic::terrain::generator &generator
 					);
 
+				explicit chunk(
+					__in const nomic::terrain::chunk &other
+					);
+
 				chunk(
 					__in const chunk &other
 					);
@@ -60,22 +72,33 @@ namespace nomic {
 					__in const glm::uvec2 &position
 					) const;
 
+				uint8_t block_light(
+					__in const glm::uvec3 &position
+					) const;
+
+				bool block_mask(
+					__in uint32_t type,
+					__in const glm::uvec3 &position
+					) const;
+
 				uint8_t block_type(
 					__in const glm::uvec3 &position
 					) const;
 
-				glm::ivec2 position(void) const;
+				std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>> edits(void) const;
 
-				virtual void on_render(
+				virtual void on_queue(
 					__in nomic::core::renderer &renderer,
-					__in void *textures,
-					__in float delta
+					__in const glm::vec3 &position,
+					__inout std::vector<nomic::core::entity_layer> &layer
 					);
 
-				virtual void on_render_transparent(
+				virtual void on_render_layer(
 					__in nomic::core::renderer &renderer,
 					__in void *textures,
-					__in float delta
+					__in float delta,
+					__in uint32_t pass,
+					__in uint8_t texture
 					);
 
 				virtual void on_update(
@@ -83,6 +106,10 @@ namespace nomic {
 					__in void *camera
 					);
 
+				std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>> pending(void);
+
+				glm::ivec2 position(void) const;
+
 				void rebuild(
 					__in_opt nomic::entity::chunk *right = nullptr,
 					__in_opt nomic::entity::chunk *left = nullptr,
@@ -104,6 +131,11 @@ namespace nomic {
 					__in_opt bool insert = false
 					);
 
+				void set_blocks(
+					__in const std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>> &blocks,
+					__in_opt bool edit = true
+					);
+
 				void teardown(void);
 
 				virtual std::string to_string(
@@ -121,15 +153,16 @@ namespace nomic {
 
 			protected:
 
-				void add_face(
+				void add_decoration(
 					__in const glm::vec3 &position,
-					__in uint32_t face,
-					__in uint32_t attributes,
-					__in std::map<uint8_t, chunk_data>::iterator entry
+					__in const glm::vec3 &block,
+					__in uint8_t type,
+					__in uint8_t attributes
 					);
 
-				void add_face_decoration(
+				void add_face(
 					__in const glm::vec3 &position,
+					__in const glm::vec3 &block,
 					__in uint32_t face,
 					__in uint32_t attributes,
 					__in std::map<uint8_t, chunk_data>::iterator entry
@@ -137,6 +170,7 @@ namespace nomic {
 
 				void add_face_small(
 					__in const glm::vec3 &position,
+					__in const glm::vec3 &block,
 					__in uint32_t face,
 					__in uint32_t attributes,
 					__in std::map<uint8_t, chunk_data>::iterator entry
@@ -148,10 +182,59 @@ namespace nomic {
 					__inout uint8_t &attributes
 					);
 
-				void add_tree(
-					__in const glm::uvec3 &position,
-					__in uint8_t type,
-					__in uint32_t attributes
+				const nomic::entity::chunk *adjacent(
+					__inout glm::ivec3 &position
+					) const;
+
+				void build(void);
+
+				void build_mask(
+					__in const glm::uvec2 &column,
+					__inout uint64_t (&face)[BLOCK_FACE_COUNT][CHUNK_MASK_WORD_COUNT],
+					__inout uint64_t (&decoration)[CHUNK_MASK_WORD_COUNT]
+					) const;
+
+				void build_mesh(void);
+
+				void build_mesh_dirty(
+					__in const nomic::terrain::chunk_column &column
+					);
+
+				void build_occlusion(void);
+
+				void build_snapshot(void);
+
+				bool building(
+					__in nomic::job::manager &instance
+					) const;
+
+				bool face_occlusion(
+					__in const glm::vec3 &block,
+					__in uint32_t face,
+					__inout float *occlusion
+					);
+
+				glm::vec2 light_adjacent(
+					__in const glm::ivec3 &position
+					) const;
+
+				void set_edited(
+					__in const glm::uvec3 &position
+					);
+
+				void synchronize(void);
+
+				void update_edge(void);
+
+				void upload(void);
+
+				void upload_buffer(
+					__in nomic::graphic::vao &arr,
+					__in GLuint index,
+					__in GLint width,
+					__in const GLvoid *data,
+					__in uint32_t count,
+					__in uint32_t capacity
 					);
 
 				bool m_changed;
@@ -164,7 +247,31 @@ namespace nomic {
 
 				nomic::entity::chunk *m_chunk_right;
 
-				std::map<uint8_t, chunk_data> m_face;
+				std::map<uint8_t, chunk_range> m_decoration;
+
+				nomic::graphic::vao *m_decoration_array;
+
+				std::map<uint8_t, chunk_range> m_decoration_build;
+
+				std::vector<bool> m_edited;
+
+				std::map<uint8_t, chunk_range> m_face;
+
+				std::map<uint8_t, chunk_range> m_face_build;
+
+				std::map<uint8_t, std::vector<uint32_t>> m_face_column;
+
+				std::map<uint8_t, std::vector<uint32_t>> m_face_column_build;
+
+				uint32_t m_job;
+
+				chunk_mesh m_mesh;
+
+				uint32_t m_mesh_capacity;
+
+				std::vector<chunk_range> m_mesh_dirty;
+
+				bool m_mesh_retain;
 		};
 	}
 }
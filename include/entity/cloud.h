@@ -0,0 +1,107 @@
+/**
+ * Nomic
+ * Copyright (C) 2017 David Jolly
+ *
+ * Nomic is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Nomic is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NOMIC_ENTITY_CLOUD_H_
+#define NOMIC_ENTITY_CLOUD_H_
+
+#include "../core/noise.h"
+#include "./object.h"
+
+namespace nomic {
+
+	namespace entity {
+
+		class cloud :
+				public nomic::entity::object {
+
+			public:
+
+				cloud(
+					__in_opt uint32_t seed = NOISE_SEED_DEFAULT,
+					__in_opt uint32_t octaves = NOISE_OCTAVES_DEFAULT,
+					__in_opt double amplitude = NOISE_AMPLITUDE_DEFAULT
+					);
+
+				cloud(
+					__in const cloud &other
+					);
+
+				virtual ~cloud(void);
+
+				cloud &operator=(
+					__in const cloud &other
+					);
+
+				bool contains(
+					__in const glm::vec3 &position
+					);
+
+				uint32_t count(void) const;
+
+				virtual void on_queue(
+					__in nomic::core::renderer &renderer,
+					__in const glm::vec3 &position,
+					__inout std::vector<nomic::core::entity_layer> &layer
+					);
+
+				virtual void on_render(
+					__in nomic::core::renderer &renderer,
+					__in void *textures,
+					__in float delta
+					);
+
+				virtual void on_update(
+					__in void *runtime,
+					__in void *camera
+					);
+
+				void set_seed(
+					__in uint32_t seed,
+					__in_opt uint32_t octaves = NOISE_OCTAVES_DEFAULT,
+					__in_opt double amplitude = NOISE_AMPLITUDE_DEFAULT
+					);
+
+				virtual std::string to_string(
+					__in_opt bool verbose = false
+					) const;
+
+			protected:
+
+				void build(
+					__in const glm::ivec2 &position
+					);
+
+				bool sample(
+					__in int32_t x,
+					__in int32_t z
+					);
+
+				void setup(void);
+
+				uint32_t m_count;
+
+				bool m_dirty;
+
+				glm::ivec2 m_field;
+
+				nomic::core::noise m_noise;
+		};
+	}
+}
+
+#endif // NOMIC_ENTITY_CLOUD_H_
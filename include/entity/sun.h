@@ -74,6 +74,10 @@ namespace nomic {
 					__in float delta
 					);
 
+				void set_radius(
+					__in float radius
+					);
+
 				virtual std::string to_string(
 					__in_opt bool verbose = false
 					) const;
@@ -23,7 +23,7 @@
 #include <queue>
 #include <set>
 #include "../core/singleton.h"
-#include "../core/thread.h"
+#include "../job/manager.h"
 #include "./queue.h"
 
 namespace nomic {
@@ -31,8 +31,7 @@ namespace nomic {
 	namespace event {
 
 		class manager :
-				public SINGLETON_CLASS(nomic::event::manager),
-				protected nomic::core::thread {
+				public SINGLETON_CLASS(nomic::event::manager) {
 
 			public:
 
@@ -81,16 +80,14 @@ namespace nomic {
 					__in const manager &other
 					) = delete;
 
+				void dispatch(void);
+
 				std::map<uint32_t, std::set<nomic::event::queue *>>::iterator find_id(
 					__in uint32_t id
 					);
 
 				bool on_initialize(void);
 
-				bool on_run(void);
-
-				void on_stop(void);
-
 				void on_uninitialize(void);
 
 				bool poll_event(
@@ -101,8 +98,14 @@ namespace nomic {
 					__in nomic::core::event &event
 					);
 
+				bool m_dispatch;
+
+				uint32_t m_dispatch_id;
+
 				std::map<uint32_t, std::set<nomic::event::queue *>> m_id;
 
+				nomic::job::manager &m_manager_job;
+
 				std::mutex m_mutex;
 
 				std::queue<nomic::core::event> m_queue;
@@ -21,6 +21,7 @@
 
 #include <vector>
 #include "./bitmap.h"
+#include "./cache.h"
 #include "./texture.h"
 
 namespace nomic {
@@ -69,6 +70,16 @@ namespace nomic {
 
 			protected:
 
+				void decode(
+					__in const std::string &path,
+					__inout std::vector<nomic::graphic::cache_entry> &entry
+					);
+
+				void decode_row(
+					__in uint32_t z,
+					__inout std::vector<nomic::graphic::cache_entry> &entry
+					);
+
 				void destroy(void);
 
 				nomic::graphic::bitmap m_bitmap;
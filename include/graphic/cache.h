@@ -0,0 +1,89 @@
+/**
+ * Nomic
+ * Copyright (C) 2017 David Jolly
+ *
+ * Nomic is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Nomic is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NOMIC_GRAPHIC_CACHE_H_
+#define NOMIC_GRAPHIC_CACHE_H_
+
+#include <tuple>
+#include <vector>
+#include "../define.h"
+
+namespace nomic {
+
+	namespace graphic {
+
+		enum {
+			CACHE_ENTRY_ATTRIBUTE = 0,
+			CACHE_ENTRY_LEVEL,
+		};
+
+		typedef std::tuple<std::vector<int32_t>, std::vector<std::vector<uint8_t>>> cache_entry;
+
+		class cache {
+
+			public:
+
+				cache(void);
+
+				cache(
+					__in const cache &other
+					);
+
+				virtual ~cache(void);
+
+				cache &operator=(
+					__in const cache &other
+					);
+
+				void clear(void);
+
+				std::vector<nomic::graphic::cache_entry> &entries(void);
+
+				uint64_t key(void) const;
+
+				bool load(
+					__in uint64_t key
+					);
+
+				static std::string path(
+					__in uint64_t key
+					);
+
+				bool save(void);
+
+				virtual std::string to_string(
+					__in_opt bool verbose = false
+					) const;
+
+			protected:
+
+				static bool read(
+					__in const std::string &data,
+					__inout size_t &offset,
+					__inout void *output,
+					__in size_t length
+					);
+
+				std::vector<nomic::graphic::cache_entry> m_entry;
+
+				uint64_t m_key;
+		};
+	}
+}
+
+#endif // NOMIC_GRAPHIC_CACHE_H_
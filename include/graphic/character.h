@@ -20,6 +20,7 @@
 #define NOMIC_GRAPHIC_CHARACTER_H_
 
 #include "../core/primitive.h"
+#include "./cache.h"
 
 namespace nomic {
 
@@ -74,6 +75,14 @@ namespace nomic {
 					__in_opt GLenum filter_mag = CHARACTER_FILTER_MAG_DEFAULT
 					);
 
+				void set(
+					__in const nomic::graphic::cache_entry &entry,
+					__in_opt GLenum wrap_s = CHARACTER_WRAP_S_DEFAULT,
+					__in_opt GLenum wrap_t = CHARACTER_WRAP_T_DEFAULT,
+					__in_opt GLenum filter_min = CHARACTER_FILTER_MIN_DEFAULT,
+					__in_opt GLenum filter_mag = CHARACTER_FILTER_MAG_DEFAULT
+					);
+
 				virtual std::string to_string(
 					__in_opt bool verbose = false
 					) const;
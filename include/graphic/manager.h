@@ -19,13 +19,22 @@
 #ifndef NOMIC_GRAPHIC_MANAGER_H_
 #define NOMIC_GRAPHIC_MANAGER_H_
 
-#include <map>
+#include <tuple>
+#include <vector>
 #include "../core/singleton.h"
 
 namespace nomic {
 
 	namespace graphic {
 
+		enum {
+			GRAPHIC_HANDLE_REFERENCE = 0,
+			GRAPHIC_HANDLE_SUBTYPE,
+			GRAPHIC_HANDLE_SIZE,
+		};
+
+		typedef std::tuple<size_t, GLenum, size_t> graphic_handle;
+
 		class manager :
 				public SINGLETON_CLASS(nomic::graphic::manager) {
 
@@ -38,11 +47,17 @@ namespace nomic {
 					__in GLuint handle
 					);
 
+				size_t count(
+					__in uint32_t type
+					);
+
 				size_t decrement(
 					__in uint32_t type,
 					__in GLuint handle
 					);
 
+				void flush(void);
+
 				GLuint generate(
 					__in uint32_t type,
 					__in_opt GLenum subtype = SUBTYPE_UNDEFINED
@@ -64,6 +79,16 @@ namespace nomic {
 					__in_opt GLuint handle = HANDLE_INVALID
 					);
 
+				void set_size(
+					__in uint32_t type,
+					__in GLuint handle,
+					__in size_t size
+					);
+
+				size_t size(
+					__in uint32_t type
+					);
+
 				std::string to_string(
 					__in_opt bool verbose = false
 					) const;
@@ -84,10 +109,12 @@ namespace nomic {
 
 				void destroy(
 					__in uint32_t type,
-					__in std::map<GLuint, std::pair<size_t, GLenum>>::iterator iter
+					__in GLuint handle
 					);
 
-				std::map<GLuint, std::pair<size_t, GLenum>>::iterator find(
+				void destroy_pending(void);
+
+				nomic::graphic::graphic_handle &find(
 					__in uint32_t type,
 					__in GLuint handle
 					);
@@ -96,9 +123,15 @@ namespace nomic {
 
 				void on_uninitialize(void);
 
-				std::map<uint32_t, std::map<GLuint, std::pair<size_t, GLenum>>> m_handle;
+				size_t m_count[PRIMITIVE_MAX + 1];
+
+				std::vector<nomic::graphic::graphic_handle> m_handle[PRIMITIVE_MAX + 1];
 
 				std::mutex m_mutex;
+
+				std::vector<GLuint> m_pending[PRIMITIVE_MAX + 1];
+
+				size_t m_size[PRIMITIVE_MAX + 1];
 		};
 	}
 }
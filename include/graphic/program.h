@@ -146,12 +146,21 @@ namespace nomic {
 					__in const glm::mat4 &value
 					);
 
+				void set_uniform_block(
+					__in GLuint index,
+					__in GLuint binding
+					);
+
 				size_t shader_count(void);
 
 				virtual std::string to_string(
 					__in_opt bool verbose = false
 					) const;
 
+				GLuint uniform_block_index(
+					__in const std::string &name
+					);
+
 				GLint uniform_location(
 					__in const std::string &name
 					);
@@ -85,6 +85,12 @@ namespace nomic {
 
 				void enable(void);
 
+				static void generate_levels(
+					__inout std::vector<std::vector<uint8_t>> &level,
+					__in const glm::uvec2 &dimensions,
+					__in uint32_t depth
+					);
+
 				uint32_t height(void) const;
 
 				GLenum mode(void) const;
@@ -107,6 +113,16 @@ namespace nomic {
 					__in_opt GLenum filter_mag = TEXTURE_FILTER_MAG_DEFAULT
 					);
 
+				void set(
+					__in const std::vector<std::vector<uint8_t>> &level,
+					__in const glm::uvec2 &dimensions,
+					__in uint32_t depth,
+					__in_opt GLenum wrap_s = TEXTURE_WRAP_S_DEFAULT,
+					__in_opt GLenum wrap_t = TEXTURE_WRAP_T_DEFAULT,
+					__in_opt GLenum filter_min = TEXTURE_FILTER_MIN_DEFAULT,
+					__in_opt GLenum filter_mag = TEXTURE_FILTER_MAG_DEFAULT
+					);
+
 				void set(
 					__in GLenum target,
 					__in GLint level,
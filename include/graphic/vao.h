@@ -81,6 +81,20 @@ namespace nomic {
 
 				void remove_all(void);
 
+				void set_divisor(
+					__in GLuint index,
+					__in GLuint divisor
+					);
+
+				void set_pointer(
+					__in GLuint index,
+					__in GLint size,
+					__in GLenum type,
+					__in_opt GLboolean normalized = GL_FALSE,
+					__in_opt GLsizei stride = 0,
+					__in_opt const GLvoid *pointer = nullptr
+					);
+
 				void set_subdata(
 					__in GLuint index,
 					__in GLintptr offset,
@@ -47,6 +47,13 @@ namespace nomic {
 					__in GLenum usage
 					);
 
+				vbo(
+					__in GLenum target,
+					__in const GLvoid *data,
+					__in uint32_t size,
+					__in GLenum usage
+					);
+
 				vbo(
 					__in const vbo &other
 					);
@@ -59,6 +66,10 @@ namespace nomic {
 
 				void bind(void) const;
 
+				void bind_base(
+					__in GLuint index
+					) const;
+
 				void set(
 					__in uint32_t size,
 					__in GLenum usage
@@ -69,6 +80,12 @@ namespace nomic {
 					__in GLenum usage
 					);
 
+				void set(
+					__in const GLvoid *data,
+					__in uint32_t size,
+					__in GLenum usage
+					);
+
 				void set_subdata(
 					__in GLintptr offset,
 					__in GLsizeiptr size,
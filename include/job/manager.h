@@ -0,0 +1,159 @@
+/**
+ * Nomic
+ * Copyright (C) 2017 David Jolly
+ *
+ * Nomic is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Nomic is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NOMIC_JOB_MANAGER_H_
+#define NOMIC_JOB_MANAGER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include "../core/singleton.h"
+#include "./worker.h"
+
+namespace nomic {
+
+	namespace job {
+
+		enum {
+			JOB_ENTRY_TASK = 0,
+			JOB_ENTRY_PRIORITY,
+			JOB_ENTRY_AFFINITY,
+			JOB_ENTRY_DEPENDENCY,
+			JOB_ENTRY_DEPENDENT,
+		};
+
+		typedef std::tuple<std::function<void(void)>, uint32_t, uint32_t, uint32_t, std::vector<uint32_t>> job_entry;
+
+		class manager :
+				public SINGLETON_CLASS(nomic::job::manager) {
+
+			public:
+
+				~manager(void);
+
+				uint32_t add(
+					__in const std::function<void(void)> &task,
+					__in_opt uint32_t priority = JOB_PRIORITY_NORMAL,
+					__in_opt uint32_t affinity = JOB_AFFINITY_ANY,
+					__in_opt const std::vector<uint32_t> &dependency = std::vector<uint32_t>()
+					);
+
+				bool complete(
+					__in uint32_t id
+					);
+
+				size_t pending(void);
+
+				void run_main(
+					__in_opt uint32_t limit = JOB_MAIN_LIMIT
+					);
+
+				void set_main(void);
+
+				std::string to_string(
+					__in_opt bool verbose = false
+					) const;
+
+				void wait(
+					__in uint32_t id
+					);
+
+				uint32_t workers(void) const;
+
+			protected:
+
+				SINGLETON_CLASS_BASE(nomic::job::manager);
+
+				friend class nomic::job::worker;
+
+				manager(void);
+
+				manager(
+					__in const manager &other
+					) = delete;
+
+				manager &operator=(
+					__in const manager &other
+					) = delete;
+
+				bool acquire_any(
+					__in uint32_t index,
+					__inout uint32_t &id
+					);
+
+				bool acquire_main(
+					__inout uint32_t &id
+					);
+
+				void execute(
+					__in uint32_t id
+					);
+
+				void finish(
+					__in uint32_t id
+					);
+
+				bool on_initialize(void);
+
+				void on_uninitialize(void);
+
+				void raise(void);
+
+				void run_worker(
+					__in uint32_t index
+					);
+
+				void schedule(
+					__in uint32_t id,
+					__in uint32_t priority,
+					__in uint32_t affinity
+					);
+
+				std::condition_variable m_condition;
+
+				std::condition_variable m_condition_complete;
+
+				nomic::exception m_exception;
+
+				std::map<uint32_t, nomic::job::job_entry> m_job;
+
+				uint32_t m_job_next;
+
+				std::thread::id m_main;
+
+				std::mutex m_mutex;
+
+				std::mutex m_mutex_queue;
+
+				std::deque<uint32_t> m_queue[JOB_PRIORITY_MAX + 1];
+
+				std::deque<uint32_t> m_queue_main[JOB_PRIORITY_MAX + 1];
+
+				std::atomic<uint32_t> m_ready;
+
+				std::vector<nomic::job::worker *> m_worker;
+		};
+	}
+}
+
+#endif // NOMIC_JOB_MANAGER_H_
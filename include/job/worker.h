@@ -0,0 +1,89 @@
+/**
+ * Nomic
+ * Copyright (C) 2017 David Jolly
+ *
+ * Nomic is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Nomic is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NOMIC_JOB_WORKER_H_
+#define NOMIC_JOB_WORKER_H_
+
+#include <deque>
+#include "../core/thread.h"
+
+namespace nomic {
+
+	namespace job {
+
+		class worker :
+				protected nomic::core::thread {
+
+			public:
+
+				worker(
+					__in uint32_t index,
+					__in void *owner
+					);
+
+				virtual ~worker(void);
+
+				uint32_t index(void) const;
+
+				bool pop(
+					__inout uint32_t &id
+					);
+
+				void push(
+					__in uint32_t id,
+					__in uint32_t priority
+					);
+
+				size_t size(void);
+
+				void start(void);
+
+				bool steal(
+					__inout uint32_t &id
+					);
+
+				void stop(void);
+
+				virtual std::string to_string(
+					__in_opt bool verbose = false
+					) const;
+
+			protected:
+
+				worker(
+					__in const worker &other
+					) = delete;
+
+				worker &operator=(
+					__in const worker &other
+					) = delete;
+
+				bool on_run(void);
+
+				uint32_t m_index;
+
+				std::mutex m_mutex;
+
+				void *m_owner;
+
+				std::deque<uint32_t> m_queue[JOB_PRIORITY_MAX + 1];
+		};
+	}
+}
+
+#endif // NOMIC_JOB_WORKER_H_
@@ -21,15 +21,20 @@
 
 #include <map>
 #include <set>
+#include <tuple>
+#include <vector>
 #include "../core/entity.h"
 #include "../core/renderer.h"
 #include "../core/singleton.h"
 #include "../graphic/atlas.h"
+#include "../graphic/vbo.h"
 
 namespace nomic {
 
 	namespace render {
 
+		typedef std::tuple<uint64_t, nomic::core::renderer *, nomic::core::entity *, uint32_t, uint8_t> render_item;
+
 		class manager :
 				public SINGLETON_CLASS(nomic::render::manager) {
 
@@ -75,6 +80,16 @@ namespace nomic {
 					__in bool underwater
 					);
 
+				size_t queued(void);
+
+				uint32_t state_changes(
+					__in uint32_t state
+					);
+
+				uint32_t state_changes_avoided(
+					__in uint32_t state
+					);
+
 				std::string to_string(
 					__in_opt bool verbose = false
 					) const;
@@ -110,9 +125,43 @@ namespace nomic {
 
 				void on_uninitialize(void);
 
+				void queue(
+					__in const glm::vec3 &position
+					);
+
+				void queue_sort(void);
+
+				void update_frame(
+					__in const glm::vec3 &position,
+					__in const glm::vec3 &rotation,
+					__in const glm::mat4 &projection,
+					__in const glm::mat4 &projection_orthogonal,
+					__in const glm::mat4 &view,
+					__in float cycle,
+					__in const glm::vec4 &ambient,
+					__in const glm::vec4 &ambient_background,
+					__in const glm::vec3 &ambient_position,
+					__in bool clouds,
+					__in bool underwater
+					);
+
 				std::map<uint32_t, std::pair<nomic::core::renderer *, std::set<nomic::core::entity *>>> m_entry;
 
+				nomic::graphic::vbo *m_frame;
+
+				std::vector<uint8_t> m_frame_data;
+
+				std::vector<nomic::core::entity_layer> m_layer;
+
 				std::mutex m_mutex;
+
+				std::vector<nomic::render::render_item> m_queue;
+
+				std::vector<nomic::render::render_item> m_queue_sorted;
+
+				uint32_t m_state_changes[RENDER_STATE_MAX + 1];
+
+				uint32_t m_state_changes_avoided[RENDER_STATE_MAX + 1];
 		};
 	}
 }
@@ -20,6 +20,7 @@
 #define NOMIC_RUNTIME_H_
 
 #include "./event/manager.h"
+#include "./job/manager.h"
 #include "./session/manager.h"
 #include "./uuid/manager.h"
 #include "./trace.h"
@@ -127,6 +128,8 @@ namespace nomic {
 
 			nomic::event::manager &m_manager_event;
 
+			nomic::job::manager &m_manager_job;
+
 			nomic::session::manager &m_manager_session;
 
 			nomic::trace &m_manager_trace;
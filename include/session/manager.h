@@ -19,8 +19,12 @@
 #ifndef NOMIC_SESSION_MANAGER_H_
 #define NOMIC_SESSION_MANAGER_H_
 
+#include <functional>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <set>
 #include <vector>
-#include "../core/thread.h"
 #include "../entity/camera.h"
 #include "../entity/chunk.h"
 #include "../entity/manager.h"
@@ -28,8 +32,10 @@
 #include "../graphic/atlas.h"
 #include "../graphic/display.h"
 #include "../graphic/manager.h"
+#include "../job/manager.h"
 #include "../render/manager.h"
 #include "../terrain/manager.h"
+#include "../terrain/water.h"
 
 namespace nomic {
 
@@ -37,13 +43,16 @@ namespace nomic {
 
 		class manager :
 				public SINGLETON_CLASS(nomic::session::manager),
-				protected nomic::event::input,
-				protected nomic::core::thread {
+				protected nomic::event::input {
 
 			public:
 
 				~manager(void);
 
+				void add_view_cost(
+					__in float cost
+					);
+
 				glm::vec3 ambient_position(void);
 
 				bool block_selected(void);
@@ -103,6 +112,15 @@ namespace nomic {
 					__in const std::string &title
 					);
 
+				void set_view_governor(
+					__in bool governor,
+					__in_opt float target = VIEW_GOVERNOR_TARGET_DEFAULT
+					);
+
+				void set_view_radius(
+					__in uint32_t radius
+					);
+
 				void set_vsync(
 					__in bool vsync
 					);
@@ -123,6 +141,10 @@ namespace nomic {
 
 				void update(void);
 
+				bool view_governor(void) const;
+
+				uint32_t view_radius(void) const;
+
 			protected:
 
 				SINGLETON_CLASS_BASE(nomic::session::manager);
@@ -137,6 +159,20 @@ namespace nomic {
 					__in const manager &other
 					) = delete;
 
+				void generate_chunk(
+					__in const glm::ivec2 &position,
+					__in nomic::terrain::generator &generator
+					);
+
+				float generate_chunk_priority(
+					__in const glm::ivec2 &position,
+					__inout bool &visible
+					);
+
+				void generate_chunks_join(void);
+
+				void generate_chunks_queue(void);
+
 				void generate_chunks_runtime(void);
 
 				void generate_chunks_spawn(void);
@@ -169,8 +205,6 @@ namespace nomic {
 					__in int32_t y_relative
 					);
 
-				bool on_run(void);
-
 				void on_uninitialize(void);
 
 				void on_wheel(
@@ -183,6 +217,10 @@ namespace nomic {
 
 				void panel_move_right(void);
 
+				void region_edit(
+					__in uint16_t scancode
+					);
+
 				bool selected_block_add(void);
 
 				void selected_block_remove(void);
@@ -195,6 +233,10 @@ namespace nomic {
 
 				void update_underwater(void);
 
+				void update_view(
+					__in float cost
+					);
+
 				nomic::graphic::atlas *m_atlas;
 
 				bool m_block_selected;
@@ -207,8 +249,29 @@ namespace nomic {
 
 				nomic::entity::camera *m_camera;
 
+				std::map<std::pair<int32_t, int32_t>, nomic::terrain::chunk> m_chunk_generated;
+
+				glm::vec2 m_chunk_heading;
+
+				uint32_t m_chunk_inflight;
+
+				glm::ivec2 m_chunk_predicted;
+
+				glm::vec3 m_chunk_previous;
+
+				std::vector<uint32_t> m_chunk_job;
+
+				std::mutex m_chunk_mutex;
+
+				std::set<std::pair<int32_t, int32_t>> m_chunk_pending;
+
+				std::priority_queue<std::pair<float, std::pair<int32_t, int32_t>>, std::vector<std::pair<float,
+					std::pair<int32_t, int32_t>>>, std::greater<std::pair<float, std::pair<int32_t, int32_t>>>> m_chunk_queue;
+
 				nomic::core::renderer *m_chunk_renderer;
 
+				glm::vec3 m_chunk_velocity;
+
 				bool m_clouds;
 
 				bool m_debug;
@@ -233,6 +296,8 @@ namespace nomic {
 
 				nomic::graphic::manager &m_manager_graphic;
 
+				nomic::job::manager &m_manager_job;
+
 				nomic::render::manager &m_manager_render;
 
 				nomic::terrain::manager &m_manager_terrain;
@@ -241,11 +306,29 @@ namespace nomic {
 
 				nomic::core::random<int32_t> m_random_integer;
 
+				nomic::terrain::region m_region;
+
 				void *m_runtime;
 
 				glm::vec3 m_spawn;
 
 				bool m_underwater;
+
+				bool m_view_changed;
+
+				float m_view_cost;
+
+				float m_view_cost_update;
+
+				uint32_t m_view_frame;
+
+				bool m_view_governor;
+
+				float m_view_governor_target;
+
+				uint32_t m_view_radius;
+
+				nomic::terrain::water m_water;
 		};
 	}
 }
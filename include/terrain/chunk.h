@@ -19,6 +19,8 @@
 #ifndef NOMIC_TERRAIN_CHUNK_H_
 #define NOMIC_TERRAIN_CHUNK_H_
 
+#include <bitset>
+#include <map>
 #include <queue>
 #include <tuple>
 #include <vector>
@@ -28,6 +30,22 @@ namespace nomic {
 
 	namespace terrain {
 
+		enum {
+			SNAPSHOT_ATTRIBUTES = 0,
+			SNAPSHOT_BLOCK,
+			SNAPSHOT_LIGHT,
+			SNAPSHOT_MASK,
+			SNAPSHOT_LIGHT_CHANGED,
+			SNAPSHOT_LIGHT_VALID,
+			SNAPSHOT_COLUMN_CHANGED,
+			SNAPSHOT_LIGHT_BORDER,
+		};
+
+		typedef std::bitset<CHUNK_BLOCK_SURFACE_COUNT> chunk_column;
+
+		typedef std::tuple<std::vector<uint8_t>, std::vector<uint8_t>, std::vector<uint8_t>, std::vector<uint64_t>,
+			std::vector<glm::uvec3>, bool, chunk_column, uint32_t> chunk_snapshot;
+
 		class chunk {
 
 			public:
@@ -54,6 +72,17 @@ namespace nomic {
 					__in const glm::uvec2 &position
 					) const;
 
+				uint8_t light(
+					__in const glm::uvec3 &position
+					) const;
+
+				bool mask(
+					__in uint32_t type,
+					__in const glm::uvec3 &position
+					) const;
+
+				std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>> pending(void);
+
 				glm::ivec2 position(void) const;
 
 				void set(
@@ -68,18 +97,21 @@ namespace nomic {
 					__in_opt uint8_t attributes = BLOCK_ATTRIBUTES_DEFAULT
 					);
 
-				void set_spawn(
+				void set_blocks(
+					__in const std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>> &blocks
+					);
+
+				void set_pending(
+					__in const glm::ivec2 &chunk,
 					__in const glm::uvec3 &position,
 					__in uint8_t type,
-					__in_opt uint32_t timeout = SPAWN_TIMEOUT_DEFAULT
+					__in_opt uint8_t attributes = BLOCK_ATTRIBUTES_DEFAULT
 					);
 
 				void set_position(
 					__in const glm::ivec2 &position
 					);
 
-				std::vector<std::pair<glm::uvec3, uint8_t>> spawn(void);
-
 				virtual std::string to_string(
 					__in_opt bool verbose = false
 					) const;
@@ -98,19 +130,74 @@ namespace nomic {
 					__in const chunk &other
 					);
 
+				void light_border(
+					__inout std::queue<glm::uvec3> &queue,
+					__in bool sky
+					);
+
+				uint8_t light_level(
+					__in const glm::uvec3 &position,
+					__in bool sky
+					) const;
+
+				void light_propagate(
+					__inout std::queue<glm::uvec3> &queue,
+					__in bool sky
+					);
+
+				void light_remove(
+					__in const glm::uvec3 &position,
+					__inout std::queue<glm::uvec3> &queue,
+					__in bool sky
+					);
+
+				uint8_t set_height(
+					__in const glm::uvec2 &position
+					);
+
+				void set_light_level(
+					__in const glm::uvec3 &position,
+					__in uint8_t level,
+					__in bool sky
+					);
+
+				void set_mask(
+					__in const glm::uvec3 &position
+					);
+
+				void snapshot(void);
+
+				uint32_t snapshot_commit(
+					__inout nomic::terrain::chunk_column &column
+					);
+
+				void update_light(void);
+
 				bool m_active = false;
 
 				uint8_t m_block[CHUNK_WIDTH][CHUNK_HEIGHT][CHUNK_WIDTH];
 
 				uint8_t m_block_attributes[CHUNK_WIDTH][CHUNK_HEIGHT][CHUNK_WIDTH];
 
+				nomic::terrain::chunk_column m_column_changed;
+
 				uint8_t m_height[CHUNK_WIDTH][CHUNK_WIDTH];
 
+				uint8_t m_light[CHUNK_WIDTH][CHUNK_HEIGHT][CHUNK_WIDTH];
+
+				std::vector<glm::uvec3> m_light_changed;
+
+				bool m_light_valid;
+
+				uint64_t m_mask[CHUNK_MASK_COUNT][CHUNK_WIDTH][CHUNK_WIDTH][CHUNK_MASK_WORD_COUNT];
+
+				std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>> m_pending;
+
 				glm::ivec2 m_position;
 
 				std::queue<std::tuple<glm::uvec3, uint8_t, uint8_t>> m_queue;
 
-				std::vector<std::tuple<glm::uvec3, uint32_t, uint8_t>> m_spawn;
+				nomic::terrain::chunk_snapshot m_snapshot;
 		};
 	}
 }
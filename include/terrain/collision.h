@@ -0,0 +1,75 @@
+/**
+ * Nomic
+ * Copyright (C) 2017 David Jolly
+ *
+ * Nomic is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Nomic is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NOMIC_TERRAIN_COLLISION_H_
+#define NOMIC_TERRAIN_COLLISION_H_
+
+#include "./manager.h"
+
+namespace nomic {
+
+	namespace terrain {
+
+		class collision {
+
+			public:
+
+				collision(void);
+
+				collision(
+					__in const collision &other
+					);
+
+				virtual ~collision(void);
+
+				collision &operator=(
+					__in const collision &other
+					);
+
+				glm::vec3 move(
+					__in const glm::vec3 &minimum,
+					__in const glm::vec3 &maximum,
+					__in const glm::vec3 &motion,
+					__inout glm::bvec3 &contact
+					) const;
+
+				glm::ivec3 origin(void) const;
+
+				void snapshot(
+					__in nomic::terrain::manager &terrain,
+					__in const glm::vec3 &position
+					);
+
+				bool solid(
+					__in const glm::ivec3 &position
+					) const;
+
+				virtual std::string to_string(
+					__in_opt bool verbose = false
+					) const;
+
+			protected:
+
+				glm::ivec3 m_origin;
+
+				bool m_solid[COLLISION_WIDTH][COLLISION_WIDTH][COLLISION_WIDTH];
+		};
+	}
+}
+
+#endif // NOMIC_TERRAIN_COLLISION_H_
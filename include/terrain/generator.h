@@ -22,6 +22,7 @@
 #include "../core/noise.h"
 #include "../core/random.h"
 #include "./chunk.h"
+#include "./structure.h"
 
 namespace nomic {
 
@@ -109,13 +110,6 @@ namespace nomic {
 					__in nomic::terrain::chunk &chunk
 					);
 
-				bool chunk_decoration_cloud(
-					__in const glm::uvec3 &position,
-					__in nomic::terrain::chunk &chunk,
-					__inout int32_t &height,
-					__in double scale
-					);
-
 				bool chunk_decoration_grassland(
 					__in const glm::uvec3 &position,
 					__in nomic::terrain::chunk &chunk
@@ -145,13 +139,28 @@ namespace nomic {
 					__in nomic::terrain::chunk &chunk
 					);
 
-				uint32_t m_max;
+				static std::map<uint8_t, std::vector<nomic::terrain::structure>> structure_library(void);
+
+				void structure_tree_oak(
+					__inout nomic::terrain::structure &entry
+					);
 
-				nomic::core::noise m_noise_cloud;
+				void structure_tree_spruce(
+					__inout nomic::terrain::structure &entry
+					);
+
+				static const nomic::terrain::structure &structure_variant(
+					__in uint8_t type,
+					__in uint32_t variant
+					);
+
+				uint32_t m_max;
 
 				nomic::core::noise m_noise_terrain;
 
 				nomic::core::random<double> m_random;
+
+				std::vector<std::pair<glm::uvec3, uint8_t>> m_structure;
 		};
 	}
 }
@@ -20,6 +20,8 @@
 #define NOMIC_TERRAIN_MANAGER_H_
 
 #include <map>
+#include <set>
+#include "../core/pool.h"
 #include "../core/renderer.h"
 #include "../core/singleton.h"
 #include "../entity/chunk.h"
@@ -29,6 +31,8 @@ namespace nomic {
 
 	namespace terrain {
 
+		typedef std::tuple<glm::uvec3, std::vector<uint8_t>, std::vector<uint8_t>> region;
+
 		class manager :
 				public SINGLETON_CLASS(nomic::terrain::manager) {
 
@@ -47,8 +51,74 @@ namespace nomic {
 					__in const glm::ivec2 &position
 					);
 
+				uint32_t evict(
+					__in const glm::ivec2 &center,
+					__in const glm::ivec2 &predicted,
+					__in int32_t radius
+					);
+
 				nomic::terrain::generator &generator(void);
 
+				nomic::entity::chunk *insert(
+					__in const nomic::terrain::chunk &chunk
+					);
+
+				const nomic::core::pool<nomic::entity::chunk> &pool(void) const;
+
+				bool raycast(
+					__in const glm::vec3 &origin,
+					__in const glm::vec3 &direction,
+					__in float range,
+					__inout glm::ivec2 &chunk,
+					__inout glm::uvec3 &block,
+					__inout uint8_t &face,
+					__inout float &distance,
+					__in_opt bool (*predicate)(uint8_t) = nomic::utility::block_selectable
+					);
+
+				nomic::terrain::region region_copy(
+					__in const glm::ivec3 &minimum,
+					__in const glm::ivec3 &maximum
+					);
+
+				uint32_t region_fill(
+					__in const glm::ivec3 &minimum,
+					__in const glm::ivec3 &maximum,
+					__in uint8_t type,
+					__in_opt uint8_t attributes = BLOCK_ATTRIBUTES_DEFAULT,
+					__inout_opt std::vector<std::pair<glm::ivec2, glm::uvec3>> *boundary = nullptr
+					);
+
+				uint32_t region_paste(
+					__in const glm::ivec3 &origin,
+					__in const nomic::terrain::region &region,
+					__inout_opt std::vector<std::pair<glm::ivec2, glm::uvec3>> *boundary = nullptr
+					);
+
+				uint32_t region_replace(
+					__in const glm::ivec3 &minimum,
+					__in const glm::ivec3 &maximum,
+					__in uint8_t type_from,
+					__in uint8_t type,
+					__in_opt uint8_t attributes = BLOCK_ATTRIBUTES_DEFAULT,
+					__inout_opt std::vector<std::pair<glm::ivec2, glm::uvec3>> *boundary = nullptr
+					);
+
+				uint32_t region_sphere(
+					__in const glm::ivec3 &center,
+					__in uint32_t radius,
+					__in uint8_t type,
+					__in_opt uint8_t attributes = BLOCK_ATTRIBUTES_DEFAULT,
+					__inout_opt std::vector<std::pair<glm::ivec2, glm::uvec3>> *boundary = nullptr
+					);
+
+				void set_pending(
+					__in const glm::ivec2 &chunk,
+					__in const glm::uvec3 &position,
+					__in uint8_t type,
+					__in_opt uint8_t attributes = BLOCK_ATTRIBUTES_DEFAULT
+					);
+
 				std::string to_string(
 					__in_opt bool verbose = false
 					) const;
@@ -75,9 +145,50 @@ namespace nomic {
 
 				void on_uninitialize(void);
 
+				void pending(
+					__in nomic::entity::chunk *chunk
+					);
+
+				void pending_write(
+					__in nomic::entity::chunk *chunk,
+					__in const std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>> &blocks
+					);
+
+				nomic::entity::chunk *region_block(
+					__in const glm::ivec3 &position,
+					__inout glm::uvec3 &block
+					);
+
+				void region_bound(
+					__inout glm::ivec3 &lower,
+					__inout glm::ivec3 &upper
+					) const;
+
+				void region_insert(
+					__inout std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>> &write,
+					__in const glm::ivec3 &position,
+					__in uint8_t type,
+					__in uint8_t attributes,
+					__inout_opt std::vector<std::pair<glm::ivec2, glm::uvec3>> *boundary = nullptr
+					);
+
+				uint32_t region_write(
+					__in const std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>> &write
+					);
+
 				std::map<std::pair<int32_t, int32_t>, nomic::entity::chunk *> m_chunk;
 
+				std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>> m_edit;
+
 				nomic::terrain::generator m_generator;
+
+				std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>> m_pending;
+
+				std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>> m_pending_applied;
+
+				nomic::core::pool<nomic::entity::chunk> m_pool;
+
+				std::set<std::pair<int32_t, int32_t>> m_spilled;
 		};
 	}
 }
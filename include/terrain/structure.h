@@ -0,0 +1,80 @@
+/**
+ * Nomic
+ * Copyright (C) 2017 David Jolly
+ *
+ * Nomic is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Nomic is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NOMIC_TERRAIN_STRUCTURE_H_
+#define NOMIC_TERRAIN_STRUCTURE_H_
+
+#include "./chunk.h"
+
+namespace nomic {
+
+	namespace terrain {
+
+		class structure {
+
+			public:
+
+				structure(void);
+
+				structure(
+					__in const structure &other
+					);
+
+				virtual ~structure(void);
+
+				structure &operator=(
+					__in const structure &other
+					);
+
+				void add(
+					__in const glm::ivec3 &offset,
+					__in uint8_t type,
+					__in_opt uint8_t attributes = BLOCK_ATTRIBUTES_DEFAULT
+					);
+
+				void clear(void);
+
+				bool empty(void) const;
+
+				glm::ivec3 maximum(void) const;
+
+				glm::ivec3 minimum(void) const;
+
+				size_t size(void) const;
+
+				void stamp(
+					__in const glm::uvec3 &position,
+					__inout nomic::terrain::chunk &chunk
+					) const;
+
+				virtual std::string to_string(
+					__in_opt bool verbose = false
+					) const;
+
+			protected:
+
+				std::vector<std::tuple<glm::ivec3, uint8_t, uint8_t>> m_block;
+
+				glm::ivec3 m_maximum;
+
+				glm::ivec3 m_minimum;
+		};
+	}
+}
+
+#endif // NOMIC_TERRAIN_STRUCTURE_H_
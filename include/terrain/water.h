@@ -0,0 +1,112 @@
+/**
+ * Nomic
+ * Copyright (C) 2017 David Jolly
+ *
+ * Nomic is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Nomic is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NOMIC_TERRAIN_WATER_H_
+#define NOMIC_TERRAIN_WATER_H_
+
+#include <map>
+#include <queue>
+#include <set>
+#include <tuple>
+#include "./manager.h"
+
+namespace nomic {
+
+	namespace terrain {
+
+		typedef std::pair<std::pair<int32_t, int32_t>, uint32_t> water_cell;
+
+		class water {
+
+			public:
+
+				water(void);
+
+				water(
+					__in const water &other
+					);
+
+				virtual ~water(void);
+
+				water &operator=(
+					__in const water &other
+					);
+
+				void activate(
+					__in const glm::ivec2 &chunk,
+					__in const glm::uvec3 &block
+					);
+
+				void clear(void);
+
+				uint32_t count(void) const;
+
+				virtual std::string to_string(
+					__in_opt bool verbose = false
+					) const;
+
+				void update(
+					__in nomic::terrain::manager &terrain
+					);
+
+			protected:
+
+				void flush(
+					__in nomic::terrain::manager &terrain
+					);
+
+				nomic::entity::chunk *neighbor(
+					__in nomic::terrain::manager &terrain,
+					__in const glm::ivec2 &chunk,
+					__in const glm::uvec3 &block,
+					__in uint32_t face,
+					__inout glm::ivec2 &chunk_neighbor,
+					__inout glm::uvec3 &block_neighbor
+					);
+
+				uint32_t sources(
+					__in nomic::terrain::manager &terrain,
+					__in const glm::ivec2 &chunk,
+					__in const glm::uvec3 &block
+					);
+
+				void step(
+					__in nomic::terrain::manager &terrain,
+					__in const glm::ivec2 &chunk,
+					__in const glm::uvec3 &block
+					);
+
+				void write(
+					__in const glm::ivec2 &chunk,
+					__in const glm::uvec3 &block,
+					__in uint8_t type,
+					__in uint8_t attributes
+					);
+
+				std::queue<std::pair<glm::ivec2, glm::uvec3>> m_active;
+
+				std::set<water_cell> m_active_cell;
+
+				uint32_t m_tick;
+
+				std::map<water_cell, std::tuple<glm::ivec2, glm::uvec3, uint8_t, uint8_t>> m_write;
+		};
+	}
+}
+
+#endif // NOMIC_TERRAIN_WATER_H_
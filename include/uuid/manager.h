@@ -19,14 +19,22 @@
 #ifndef NOMIC_UUID_MANAGER_H_
 #define NOMIC_UUID_MANAGER_H_
 
-#include <map>
-#include <set>
+#include <tuple>
+#include <vector>
 #include "../core/singleton.h"
 
 namespace nomic {
 
 	namespace uuid {
 
+		enum {
+			UID_SLOT_GENERATION = 0,
+			UID_SLOT_REFERENCE,
+			UID_SLOT_NEXT,
+		};
+
+		typedef std::tuple<uint32_t, size_t, uint32_t> uid_slot;
+
 		class manager :
 				public SINGLETON_CLASS(nomic::uuid::manager) {
 
@@ -72,7 +80,7 @@ namespace nomic {
 
 				void clear(void);
 
-				std::map<uint32_t, size_t>::iterator find(
+				nomic::uuid::uid_slot &find(
 					__in uint32_t id
 					);
 
@@ -80,13 +88,13 @@ namespace nomic {
 
 				void on_uninitialize(void);
 
-				std::map<uint32_t, size_t> m_id;
+				uint32_t shard(void) const;
 
-				uint32_t m_id_next;
+				uint32_t m_free[UID_SHARD_COUNT];
 
-				std::set<uint32_t> m_id_surplus;
+				std::mutex m_mutex[UID_SHARD_COUNT];
 
-				std::mutex m_mutex;
+				std::vector<nomic::uuid::uid_slot> m_slot[UID_SHARD_COUNT];
 		};
 	}
 }
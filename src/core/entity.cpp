@@ -130,6 +130,22 @@ namespace nomic {
 			return m_enabled;
 		}
 
+		void 
+		entity::on_queue(
+			__in nomic::core::renderer &renderer,
+			__in const glm::vec3 &position,
+			__inout std::vector<nomic::core::entity_layer> &layer
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Renderer=%p, Position={%f, %f, %f}, Layer[%u]=%p", &renderer, position.x, position.y,
+				position.z, layer.size(), &layer);
+
+			layer.push_back(std::make_tuple((renderer.type() < RENDERER_CHUNK) ? RENDER_PASS_BACKGROUND : RENDER_PASS_FOREGROUND,
+				RENDER_TEXTURE_NONE, 0.f));
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
 		void 
 		entity::on_render(
 			__in nomic::core::renderer &renderer,
@@ -141,6 +157,23 @@ namespace nomic {
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
+		void 
+		entity::on_render_layer(
+			__in nomic::core::renderer &renderer,
+			__in void *textures,
+			__in float delta,
+			__in uint32_t pass,
+			__in uint8_t texture
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Renderer=%p, Textures=%p, Delta=%f, Pass=%x(%s), Texture=%x", &renderer, textures, delta,
+				pass, RENDER_PASS_STRING(pass), texture);
+
+			on_render(renderer, textures, delta);
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
 		void 
 		entity::on_update(
 			__in void *runtime,
@@ -16,7 +16,9 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstring>
 #include "../../include/core/font.h"
+#include "../../include/graphic/texture.h"
 #include "../../include/uuid/manager.h"
 #include "../../include/trace.h"
 #include "./font_type.h"
@@ -88,18 +90,9 @@ namespace nomic {
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Output=%p, Value=%x(\'%c\')", &output, (int) value,
 				std::isprint(value) ? value : CHARACTER_FILL);
 
-			if(!m_face) {
-				THROW_NOMIC_CORE_FONT_EXCEPTION(NOMIC_CORE_FONT_EXCEPTION_UNLOADED);
-			}
-
-			FT_Error result = FT_Load_Char(m_face, value, FT_LOAD_RENDER);
-			if(result) {
-				THROW_NOMIC_CORE_FONT_EXCEPTION_FORMAT(NOMIC_CORE_FONT_EXCEPTION_EXTERNAL,
-					"FT_Load_Char failed! Error=%x, Value=%x(\'%c\')", result, (int) value,
-					std::isprint(value) ? value : CHARACTER_FILL);
-			}
-
-			output.set(m_face);
+			nomic::graphic::cache_entry entry;
+			rasterize(entry, value);
+			output.set(entry);
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
@@ -147,6 +140,51 @@ namespace nomic {
 			return result;
 		}
 
+		void 
+		font::rasterize(
+			__inout nomic::graphic::cache_entry &output,
+			__in char value
+			)
+		{
+			FT_GlyphSlot glyph;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Output=%p, Value=%x(\'%c\')", &output, (int) value,
+				std::isprint(value) ? value : CHARACTER_FILL);
+
+			if(!m_face) {
+				THROW_NOMIC_CORE_FONT_EXCEPTION(NOMIC_CORE_FONT_EXCEPTION_UNLOADED);
+			}
+
+			FT_Error result = FT_Load_Char(m_face, value, FT_LOAD_RENDER);
+			if(result) {
+				THROW_NOMIC_CORE_FONT_EXCEPTION_FORMAT(NOMIC_CORE_FONT_EXCEPTION_EXTERNAL,
+					"FT_Load_Char failed! Error=%x, Value=%x(\'%c\')", result, (int) value,
+					std::isprint(value) ? value : CHARACTER_FILL);
+			}
+
+			glyph = m_face->glyph;
+
+			std::vector<int32_t> &attribute = std::get<nomic::graphic::CACHE_ENTRY_ATTRIBUTE>(output);
+			std::vector<std::vector<uint8_t>> &level = std::get<nomic::graphic::CACHE_ENTRY_LEVEL>(output);
+
+			attribute.assign(CHARACTER_ATTRIBUTE_COUNT, 0);
+			attribute.at(CHARACTER_ATTRIBUTE_WIDTH) = glyph->bitmap.width;
+			attribute.at(CHARACTER_ATTRIBUTE_HEIGHT) = glyph->bitmap.rows;
+			attribute.at(CHARACTER_ATTRIBUTE_LEFT) = glyph->bitmap_left;
+			attribute.at(CHARACTER_ATTRIBUTE_TOP) = glyph->bitmap_top;
+			attribute.at(CHARACTER_ATTRIBUTE_ADVANCE) = glyph->advance.x;
+			level.assign(1, std::vector<uint8_t>(glyph->bitmap.width * glyph->bitmap.rows, 0));
+
+			for(uint32_t row = 0; row < glyph->bitmap.rows; ++row) {
+				memcpy(&level.front()[row * glyph->bitmap.width], &glyph->bitmap.buffer[row * std::abs(glyph->bitmap.pitch)],
+					glyph->bitmap.width);
+			}
+
+			nomic::graphic::texture::generate_levels(level, glm::uvec2(glyph->bitmap.width, glyph->bitmap.rows), sizeof(uint8_t));
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
 		uint32_t 
 		font::size(void) const
 		{
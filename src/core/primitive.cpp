@@ -148,6 +148,21 @@ namespace nomic {
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
+		void 
+		primitive::set_size(
+			__in size_t size
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Size=%u", size);
+
+			nomic::graphic::manager &instance = nomic::graphic::manager::acquire();
+			if(instance.initialized() && instance.contains(m_type, m_handle)) {
+				instance.set_size(m_type, m_handle, size);
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
 		std::string 
 		primitive::to_string(
 			__in_opt bool verbose
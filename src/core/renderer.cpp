@@ -44,17 +44,9 @@ namespace nomic {
 				m_depth_mode(depth_mode),
 				m_mode(RENDER_PERSPECTIVE),
 				m_type(type),
-				m_uniform_ambient(0),
-				m_uniform_ambient_position(0),
-				m_uniform_clouds(0),
-				m_uniform_cycle(0),
+				m_uniform_block_frame(GL_INVALID_INDEX),
 				m_uniform_depth_matrix(0),
-				m_uniform_model(0),
-				m_uniform_position(0),
-				m_uniform_projection(0),
-				m_uniform_rotation(0),
-				m_uniform_underwater(0),
-				m_uniform_view(0)
+				m_uniform_model(0)
 		{
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Blend=%x, Blend Factor={%x, %x}, Cull=%x, Cull Mode=%x, Depth=%x, Depth Mode=%x",
 				blend, blend_sfactor, blend_dfactor, cull, cull_mode, depth, depth_mode);
@@ -77,17 +69,9 @@ namespace nomic {
 				m_depth_mode(other.m_depth_mode),
 				m_mode(other.m_mode),
 				m_type(other.m_type),
-				m_uniform_ambient(other.m_uniform_ambient),
-				m_uniform_ambient_position(other.m_uniform_ambient_position),
-				m_uniform_clouds(other.m_uniform_clouds),
-				m_uniform_cycle(other.m_uniform_cycle),
+				m_uniform_block_frame(other.m_uniform_block_frame),
 				m_uniform_depth_matrix(other.m_uniform_depth_matrix),
-				m_uniform_model(other.m_uniform_model),
-				m_uniform_position(other.m_uniform_position),
-				m_uniform_projection(other.m_uniform_projection),
-				m_uniform_rotation(other.m_uniform_rotation),
-				m_uniform_underwater(other.m_uniform_underwater),
-				m_uniform_view(other.m_uniform_view)
+				m_uniform_model(other.m_uniform_model)
 		{
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Blend=%x, Blend Factor={%x, %x}, Cull=%x, Cull Mode=%x, Depth=%x, Depth Mode=%x",
 				other.m_blend, other.m_blend_sfactor, other.m_blend_dfactor, other.m_cull, other.m_cull_mode, other.m_depth,
@@ -128,17 +112,9 @@ namespace nomic {
 				m_depth_mode = other.m_depth_mode;
 				m_mode = other.m_mode;
 				m_type = other.m_type;
-				m_uniform_ambient = other.m_uniform_ambient;
-				m_uniform_ambient_position = other.m_uniform_ambient_position;
-				m_uniform_clouds = other.m_uniform_clouds;
-				m_uniform_cycle = other.m_uniform_cycle;
+				m_uniform_block_frame = other.m_uniform_block_frame;
 				m_uniform_depth_matrix = other.m_uniform_depth_matrix;
 				m_uniform_model = other.m_uniform_model;
-				m_uniform_position = other.m_uniform_position;
-				m_uniform_projection = other.m_uniform_projection;
-				m_uniform_rotation = other.m_uniform_rotation;
-				m_uniform_underwater = other.m_uniform_underwater;
-				m_uniform_view = other.m_uniform_view;
 				add();
 			}
 
@@ -253,56 +229,6 @@ namespace nomic {
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
-		void 
-		renderer::set_ambient(
-			__in const glm::vec4 &ambient
-			)
-		{
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Ambient={%f, %f, %f, %f}", ambient.x, ambient.y, ambient.z, ambient.w);
-
-			nomic::graphic::program::set_uniform(m_uniform_ambient, ambient);
-
-			TRACE_EXIT(LEVEL_VERBOSE);
-		}
-
-		void 
-		renderer::set_ambient_background(
-			__in const glm::vec4 &ambient_background
-			)
-		{
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Background={%f, %f, %f, %f}", ambient_background.x, ambient_background.y,
-				ambient_background.z, ambient_background.w);
-
-			nomic::graphic::program::set_uniform(m_uniform_ambient_background, ambient_background);
-
-			TRACE_EXIT(LEVEL_VERBOSE);
-		}
-
-		void 
-		renderer::set_ambient_position(
-			__in const glm::vec3 &ambient_position
-			)
-		{
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%f, %f, %f}", ambient_position.x, ambient_position.y,
-				ambient_position.z);
-
-			nomic::graphic::program::set_uniform(m_uniform_ambient_position, ambient_position);
-
-			TRACE_EXIT(LEVEL_VERBOSE);
-		}
-
-		void 
-		renderer::set_clouds(
-			__in const GLboolean clouds
-			)
-		{
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Clouds=%x", clouds);
-
-			nomic::graphic::program::set_uniform(m_uniform_clouds, clouds);
-
-			TRACE_EXIT(LEVEL_VERBOSE);
-		}
-
 		void 
 		renderer::set_cull(
 			__in bool cull,
@@ -317,18 +243,6 @@ namespace nomic {
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
-		void 
-		renderer::set_cycle(
-			__in GLfloat cycle
-			)
-		{
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Cycle=%f", cycle);
-
-			nomic::graphic::program::set_uniform(m_uniform_cycle, cycle);
-
-			TRACE_EXIT(LEVEL_VERBOSE);
-		}
-
 		void 
 		renderer::set_depth(
 			__in bool depth,
@@ -379,66 +293,6 @@ namespace nomic {
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
-		void 
-		renderer::set_position(
-			__in const glm::vec3 &position
-			)
-		{
-			TRACE_ENTRY(LEVEL_VERBOSE);
-
-			nomic::graphic::program::set_uniform(m_uniform_position, position);
-
-			TRACE_EXIT(LEVEL_VERBOSE);
-		}
-
-		void 
-		renderer::set_projection(
-			__in const glm::mat4 &projection
-			)
-		{
-			TRACE_ENTRY(LEVEL_VERBOSE);
-
-			nomic::graphic::program::set_uniform(m_uniform_projection, projection);
-
-			TRACE_EXIT(LEVEL_VERBOSE);
-		}
-
-		void 
-		renderer::set_rotation(
-			__in const glm::vec3 &rotation
-			)
-		{
-			TRACE_ENTRY(LEVEL_VERBOSE);
-
-			nomic::graphic::program::set_uniform(m_uniform_rotation, rotation);
-
-			TRACE_EXIT(LEVEL_VERBOSE);
-		}
-
-		void 
-		renderer::set_underwater(
-			__in const GLboolean underwater
-			)
-		{
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Underwater=%x", underwater);
-
-			nomic::graphic::program::set_uniform(m_uniform_underwater, underwater);
-
-			TRACE_EXIT(LEVEL_VERBOSE);
-		}
-
-		void 
-		renderer::set_view(
-			__in const glm::mat4 &view
-			)
-		{
-			TRACE_ENTRY(LEVEL_VERBOSE);
-
-			nomic::graphic::program::set_uniform(m_uniform_view, view);
-
-			TRACE_EXIT(LEVEL_VERBOSE);
-		}
-
 		void 
 		renderer::set_shaders(
 			__in const std::string &vertex,
@@ -451,18 +305,13 @@ namespace nomic {
 			nomic::graphic::program::add_shader(nomic::graphic::shader(GL_VERTEX_SHADER, vertex));
 			nomic::graphic::program::add_shader(nomic::graphic::shader(GL_FRAGMENT_SHADER, fragment));
 			nomic::graphic::program::link();
-			m_uniform_ambient = nomic::graphic::program::uniform_location(UNIFORM_AMBIENT);
-			m_uniform_ambient_background = nomic::graphic::program::uniform_location(UNIFORM_AMBIENT_BACKGROUND);
-			m_uniform_ambient_position = nomic::graphic::program::uniform_location(UNIFORM_AMBIENT_POSITION);
-			m_uniform_clouds = nomic::graphic::program::uniform_location(UNIFORM_CLOUDS);
-			m_uniform_cycle = nomic::graphic::program::uniform_location(UNIFORM_CYCLE);
 			m_uniform_depth_matrix = nomic::graphic::program::uniform_location(UNIFORM_DEPTH_MATRIX);
 			m_uniform_model = nomic::graphic::program::uniform_location(UNIFORM_MODEL);
-			m_uniform_position = nomic::graphic::program::uniform_location(UNIFORM_POSITION);
-			m_uniform_projection = nomic::graphic::program::uniform_location(UNIFORM_PROJECTION);
-			m_uniform_rotation = nomic::graphic::program::uniform_location(UNIFORM_ROTATION);
-			m_uniform_underwater = nomic::graphic::program::uniform_location(UNIFORM_UNDERWATER);
-			m_uniform_view = nomic::graphic::program::uniform_location(UNIFORM_VIEW);
+
+			m_uniform_block_frame = nomic::graphic::program::uniform_block_index(UNIFORM_BLOCK_FRAME);
+			if(m_uniform_block_frame != GL_INVALID_INDEX) {
+				nomic::graphic::program::set_uniform_block(m_uniform_block_frame, UNIFORM_BLOCK_FRAME_BINDING);
+			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
@@ -487,13 +336,8 @@ namespace nomic {
 					<< ", Depth=" << m_depth << ", Depth Mode=" << SCALAR_AS_HEX(GLenum, m_depth_mode)
 					<< ", Mode=" << SCALAR_AS_HEX(uint32_t, m_mode)
 						<< "(" << ((m_mode == RENDER_PERSPECTIVE) ? "Perspective" : "Orthogonal") << ")"
-					<< ", Ambient=" << m_uniform_ambient << " (Background=" << m_uniform_ambient_background
-						<< ", Position=" << m_uniform_ambient_position << ")"
-					<< ", Clouds=" << m_uniform_clouds << ", Cycle=" << m_uniform_cycle
-					<< ", Depth Matrix=" << m_uniform_depth_matrix << ", Model=" << m_uniform_model
-					<< ", Position=" << m_uniform_position << ", Rotation=" << m_uniform_rotation
-					<< ", Projection=" << m_uniform_projection << ", Underwater=" << m_uniform_underwater
-					<< ", View=" << m_uniform_view;
+					<< ", Frame=" << SCALAR_AS_HEX(GLuint, m_uniform_block_frame)
+					<< ", Depth Matrix=" << m_uniform_depth_matrix << ", Model=" << m_uniform_model;
 			}
 
 			return result.str();
@@ -518,112 +362,5 @@ namespace nomic {
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
-		void 
-		renderer::use(
-			__in const glm::vec3 &position,
-			__in const glm::vec3 &rotation,
-			__in GLfloat cycle,
-			__in const glm::vec4 &ambient,
-			__in const glm::vec4 &ambient_background,
-			__in const glm::vec3 &ambient_position,
-			__in GLboolean clouds,
-			__in GLboolean underwater,
-			__in const glm::mat4 &projection
-			)
-		{
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE,
-"Position={%f, %f, %f}, Rotation={%f, %f, %f}, Cycle=%f, Ambient={%f, %f, %f, %f} (Background={%f, %f, %f, %f}, Position={%f, %f, %f}), Clouds=%x, Underwater=%x, Projection=%p",
-				position.x, position.y, position.z, rotation.x, rotation.y, rotation.z, cycle, ambient.x, ambient.y, ambient.z,
-				ambient.w, ambient_background.x, ambient_background.y, ambient_background.z, ambient_background.w,
-				ambient_position.x, ambient_position.y, ambient_position.z, clouds, underwater, &projection);
-
-			nomic::graphic::program::use();
-			nomic::graphic::program::set_uniform(m_uniform_ambient, ambient);
-			nomic::graphic::program::set_uniform(m_uniform_ambient_background, ambient_background);
-			nomic::graphic::program::set_uniform(m_uniform_ambient_position, ambient_position);
-			nomic::graphic::program::set_uniform(m_uniform_clouds, clouds);
-			nomic::graphic::program::set_uniform(m_uniform_cycle, cycle);
-			nomic::graphic::program::set_uniform(m_uniform_position, position);
-			nomic::graphic::program::set_uniform(m_uniform_projection, projection);
-			nomic::graphic::program::set_uniform(m_uniform_rotation, rotation);
-			nomic::graphic::program::set_uniform(m_uniform_underwater, underwater);
-			set_attributes();
-
-			TRACE_EXIT(LEVEL_VERBOSE);
-		}
-
-		void 
-		renderer::use(
-			__in const glm::vec3 &position,
-			__in const glm::vec3 &rotation,
-			__in GLfloat cycle,
-			__in const glm::vec4 &ambient,
-			__in const glm::vec4 &ambient_background,
-			__in const glm::vec3 &ambient_position,
-			__in GLboolean clouds,
-			__in GLboolean underwater,
-			__in const glm::mat4 &projection,
-			__in const glm::mat4 &view
-			)
-		{
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE,
-"Position={%f, %f, %f}, Rotation={%f, %f, %f}, Cycle=%f, Ambient={%f, %f, %f, %f} (Background={%f, %f, %f, %f}, Position={%f, %f, %f}), Clouds=%x, Underwater=%x, Projection=%p, View=%p",
-				position.x, position.y, position.z, rotation.x, rotation.y, rotation.z, cycle, ambient.x, ambient.y, ambient.z,
-				ambient.w, ambient_background.x, ambient_background.y, ambient_background.z, ambient_background.w,
-				ambient_position.x, ambient_position.y, ambient_position.z, clouds, underwater, &projection, &view);
-
-			nomic::graphic::program::use();
-			nomic::graphic::program::set_uniform(m_uniform_ambient, ambient);
-			nomic::graphic::program::set_uniform(m_uniform_ambient_background, ambient_background);
-			nomic::graphic::program::set_uniform(m_uniform_ambient_position, ambient_position);
-			nomic::graphic::program::set_uniform(m_uniform_clouds, clouds);
-			nomic::graphic::program::set_uniform(m_uniform_cycle, cycle);
-			nomic::graphic::program::set_uniform(m_uniform_position, position);
-			nomic::graphic::program::set_uniform(m_uniform_projection, projection);
-			nomic::graphic::program::set_uniform(m_uniform_rotation, rotation);
-			nomic::graphic::program::set_uniform(m_uniform_underwater, underwater);
-			nomic::graphic::program::set_uniform(m_uniform_view, view);
-			set_attributes();
-
-			TRACE_EXIT(LEVEL_VERBOSE);
-		}
-
-		void 
-		renderer::use(
-			__in const glm::vec3 &position,
-			__in const glm::vec3 &rotation,
-			__in GLfloat cycle,
-			__in const glm::vec4 &ambient,
-			__in const glm::vec4 &ambient_background,
-			__in const glm::vec3 &ambient_position,
-			__in GLboolean clouds,
-			__in GLboolean underwater,
-			__in const glm::mat4 &projection,
-			__in const glm::mat4 &view,
-			__in const glm::mat4 &model
-			)
-		{
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE,
-"Position={%f, %f, %f}, Rotation={%f, %f, %f}, Cycle=%f, Ambient={%f, %f, %f, %f} (Background={%f, %f, %f, %f}, Position={%f, %f, %f}), Clouds=%x, Underwater=%x, Projection=%p, View=%p, Model=%p",
-				position.x, position.y, position.z, rotation.x, rotation.y, rotation.z, cycle, ambient.x, ambient.y, ambient.z,
-				ambient.w, ambient_background.x, ambient_background.y, ambient_background.z, ambient_background.w,
-				ambient_position.x, ambient_position.y, ambient_position.z, clouds, underwater, &projection, &view, &model);
-
-			nomic::graphic::program::use();
-			nomic::graphic::program::set_uniform(m_uniform_ambient, ambient);
-			nomic::graphic::program::set_uniform(m_uniform_ambient_background, ambient_background);
-			nomic::graphic::program::set_uniform(m_uniform_ambient_position, ambient_position);
-			nomic::graphic::program::set_uniform(m_uniform_clouds, clouds);
-			nomic::graphic::program::set_uniform(m_uniform_cycle, cycle);
-			nomic::graphic::program::set_uniform(m_uniform_model, model);
-			nomic::graphic::program::set_uniform(m_uniform_position, position);
-			nomic::graphic::program::set_uniform(m_uniform_projection, projection);
-			nomic::graphic::program::set_uniform(m_uniform_rotation, rotation);
-			nomic::graphic::program::set_uniform(m_uniform_underwater, underwater);
-			nomic::graphic::program::set_uniform(m_uniform_view, view);
-			set_attributes();
-
-			TRACE_EXIT(LEVEL_VERBOSE);
-		}
 	}
 }
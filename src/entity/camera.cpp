@@ -40,6 +40,7 @@ namespace nomic {
 				m_rotation_previous(rotation.x, rotation.y),
 				m_sprinting(false),
 				m_velocity(0.f, 0.f, 0.f),
+				m_view_radius(VIEW_RADIUS_DEFAULT),
 				m_wheel(0)
 		{
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Dimensions={%u, %u}, Position={%f, %f, %f}, Rotation={%f, %f, %f}, Up={%f, %f, %f}, fov=%f",
@@ -68,6 +69,7 @@ namespace nomic {
 				m_rotation_previous(other.m_rotation_previous),
 				m_sprinting(other.m_sprinting),
 				m_velocity(other.m_velocity),
+				m_view_radius(other.m_view_radius),
 				m_wheel(other.m_wheel)
 		{
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Dimensions={%u, %u}, Position={%f, %f, %f}, Rotation={%f, %f, %f}, Up={%f, %f, %f}, fov=%f",
@@ -108,6 +110,7 @@ namespace nomic {
 				m_rotation_previous = other.m_rotation_previous;
 				m_sprinting = other.m_sprinting;
 				m_velocity = other.m_velocity;
+				m_view_radius = other.m_view_radius;
 				m_wheel = other.m_wheel;
 			}
 
@@ -310,6 +313,18 @@ namespace nomic {
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
+		void 
+		camera::set_view_radius(
+			__in uint32_t radius
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Radius=%u", radius);
+
+			m_view_radius = std::max(std::min(radius, (uint32_t) VIEW_RADIUS_MAX), (uint32_t) VIEW_RADIUS_MIN);
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
 		std::string 
 		camera::to_string(
 			__in_opt bool verbose
@@ -326,7 +341,8 @@ namespace nomic {
 					<< ", Dimension={" << m_dimensions.x << ", " << m_dimensions.y << "}"
 					<< ", Velocity={" << m_velocity.x << ", " << m_velocity.y << ", " << m_velocity.z << "}"
 					<< ", State=" << (m_falling ? "Falling" : "Not-Falling") << ", " << (m_sprinting ? "Sprinting" : "Walking")
-					<< ", FOV=" << m_fov;
+					<< ", FOV=" << m_fov
+					<< ", View=" << m_view_radius;
 			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
@@ -453,17 +469,12 @@ namespace nomic {
 					position.y = CHUNK_HEIGHT;
 				}
 
-				nomic::utility::position_as_block(position, position_chunk, position_block);
-
 				if(!debug) {
-					uint8_t type;
-					glm::uvec3 position_block_adjacent;
-					glm::ivec2 position_chunk_adjacent;
-					nomic::terrain::manager &terrain = instance.terrain();
+					glm::bvec3 contact;
+					glm::vec3 motion;
 					float drag = (!underwater ? CAMERA_DRAG_NORMAL : CAMERA_DRAG_UNDERWATER),
 						gravity = (!underwater ? CAMERA_GRAVITY_NORMAL : CAMERA_GRAVITY_UNDERWATER),
-						gravity_step = (!underwater ? CAMERA_GRAVITY_STEP_NORMAL : CAMERA_GRAVITY_STEP_UNDERWATER),
-						position_int;
+						gravity_step = (!underwater ? CAMERA_GRAVITY_STEP_NORMAL : CAMERA_GRAVITY_STEP_UNDERWATER);
 
 					if(m_jump_timeout < CAMERA_JUMP_TIMEOUT) {
 						++m_jump_timeout;
@@ -477,96 +488,29 @@ namespace nomic {
 						m_velocity.y += gravity_step;
 					}
 
-					type = terrain.at(position_chunk)->block_type(position_block);
-					if(!nomic::utility::block_passable(type)) { // top
+					m_collision.snapshot(instance.terrain(), m_position);
+					motion = m_collision.move(m_position - glm::vec3(CAMERA_COLLISION_WIDTH, CAMERA_COLLISION_EYE, CAMERA_COLLISION_WIDTH),
+						m_position + glm::vec3(CAMERA_COLLISION_WIDTH, CAMERA_COLLISION_HEIGHT - CAMERA_COLLISION_EYE,
+						CAMERA_COLLISION_WIDTH), position_relative + m_velocity, contact);
 
-						if(m_velocity.y > 0.f) {
-							m_velocity.y = 0.f;
-						}
-					}
-
-					type = terrain.at(position_chunk)->block_type(position_block + glm::uvec3(0.f, -CAMERA_HEIGHT_OFFSET, 0.f));
-					if(!nomic::utility::block_passable(type)) { // bottom
+					if(contact.y) { // bottom/top
 
 						if(m_velocity.y < 0.f) {
 							m_falling = false;
-							m_velocity.y = 0.f;
-						}
-					}
-
-					if(position_block.x < (CHUNK_WIDTH - 1)) { // right
-						position_chunk_adjacent = position_chunk;
-					} else if(terrain.contains(position_chunk + glm::ivec2(1, 0))) { // right (boundary)
-						position_chunk_adjacent = (position_chunk + glm::ivec2(1, 0));
-					}
-
-					for(uint32_t iter = 0; iter < CAMERA_HEIGHT_OFFSET; ++iter) {
-						position_block_adjacent = position_block;
-						position_block_adjacent.x += 1;
-						position_block_adjacent.y -= iter;
-
-						type = terrain.at(position_chunk_adjacent)->block_type(position_block_adjacent);
-						if(!nomic::utility::block_passable(type) && (position_relative.x > 0.f)) {
-							position.x -= std::modf(position_relative.x, &position_int);
-							break;
 						}
-					}
 
-					if(position_block.x) { // left
-						position_chunk_adjacent = position_chunk;
-					} else if(terrain.contains(position_chunk - glm::ivec2(1, 0))) { // left (boundary)
-						position_chunk_adjacent = (position_chunk - glm::ivec2(1, 0));
-					}
-
-					for(uint32_t iter = 0; iter < CAMERA_HEIGHT_OFFSET; ++iter) {
-						position_block_adjacent = position_block;
-						position_block_adjacent.x -= 1;
-						position_block_adjacent.y -= iter;
-
-						type = terrain.at(position_chunk_adjacent)->block_type(position_block_adjacent);
-						if(!nomic::utility::block_passable(type) && (position_relative.x < 0.f)) {
-							position.x += -std::modf(position_relative.x, &position_int);
-							break;
-						}
-					}
-
-					if(position_block.z < (CHUNK_WIDTH - 1)) { // back
-						position_chunk_adjacent = position_chunk;
-					} else if(terrain.contains(position_chunk + glm::ivec2(0, 1))) { // back (boundary)
-						position_chunk_adjacent = (position_chunk + glm::ivec2(0, 1));
-					}
-
-					for(uint32_t iter = 0; iter < CAMERA_HEIGHT_OFFSET; ++iter) {
-						position_block_adjacent = position_block;
-						position_block_adjacent.y -= iter;
-						position_block_adjacent.z += 1;
-
-						type = terrain.at(position_chunk_adjacent)->block_type(position_block_adjacent);
-						if(!nomic::utility::block_passable(type) && (position_relative.z > 0.f)) {
-							position.z -= std::modf(position_relative.z, &position_int);
-							break;
-						}
+						m_velocity.y = 0.f;
 					}
 
-					if(position_block.z) { // front
-						position_chunk_adjacent = position_chunk;;
-					} else if(terrain.contains(position_chunk - glm::ivec2(0, 1))) { // front (boundary)
-						position_chunk_adjacent = (position_chunk - glm::ivec2(0, 1));
+					if(contact.x) { // left/right
+						m_velocity.x = 0.f;
 					}
 
-					for(uint32_t iter = 0; iter < CAMERA_HEIGHT_OFFSET; ++iter) {
-						position_block_adjacent = position_block;
-						position_block_adjacent.y -= iter;
-						position_block_adjacent.z -= 1;
-
-						type = terrain.at(position_chunk_adjacent)->block_type(position_block_adjacent);
-						if(!nomic::utility::block_passable(type) && (position_relative.z < 0.f)) {
-							position.z += -std::modf(position_relative.z, &position_int);
-							break;
-						}
+					if(contact.z) { // back/front
+						m_velocity.z = 0.f;
 					}
 
-					position += m_velocity;
+					position = (m_position + motion);
 
 					if(m_velocity.x > drag) {
 						m_velocity.x -= drag;
@@ -665,6 +609,14 @@ namespace nomic {
 			return m_view;
 		}
 
+		uint32_t 
+		camera::view_radius(void) const
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", m_view_radius);
+			return m_view_radius;
+		}
+
 		void 
 		camera::wheel(
 			__in uint32_t direction,
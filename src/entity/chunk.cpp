@@ -19,7 +19,6 @@
 #include "../../include/entity/chunk.h"
 #include "../../include/entity/camera.h"
 #include "../../include/graphic/atlas.h"
-#include "../../include/terrain/manager.h"
 #include "../../include/trace.h"
 #include "./chunk_type.h"
 
@@ -27,22 +26,78 @@ namespace nomic {
 
 	namespace entity {
 
+		#define CHUNK_DECORATION_HASH(_X_, _Y_, _Z_) \
+			(((((uint32_t) (_X_)) * 73856093) ^ (((uint32_t) (_Y_)) * 19349663) ^ (((uint32_t) (_Z_)) * 83492791)) & UINT16_MAX)
+
+		#define CHUNK_MESH_HEADROOM(_COUNT_) \
+			((_COUNT_) + ((_COUNT_) / 4) + (BLOCK_FACE_COUNT * 16))
+
+		#define CHUNK_OCCLUSION_HEIGHT (CHUNK_HEIGHT + 2)
+		#define CHUNK_OCCLUSION_INDEX(_X_, _Y_, _Z_) \
+			(((((_X_) + 1) * CHUNK_OCCLUSION_HEIGHT) + ((_Y_) + 1)) * CHUNK_OCCLUSION_WIDTH + ((_Z_) + 1))
+		#define CHUNK_OCCLUSION_LEVEL_MAX 3
+		#define CHUNK_OCCLUSION_OFFSET(_X_, _Y_, _Z_) \
+			((((_X_) * CHUNK_OCCLUSION_HEIGHT) + (_Y_)) * CHUNK_OCCLUSION_WIDTH + (_Z_))
+		#define CHUNK_OCCLUSION_WIDTH (CHUNK_WIDTH + 2)
+
+		#define CHUNK_SEGMENT_COUNT_DECORATION (BLOCK_FACE_COUNT * 2)
 		#define CHUNK_SEGMENT_WIDTH_COORDINATE 2
+		#define CHUNK_SEGMENT_WIDTH_INSTANCE 4
+		#define CHUNK_SEGMENT_WIDTH_LIGHT 3
 		#define CHUNK_SEGMENT_WIDTH_NORMAL 3
 		#define CHUNK_SEGMENT_WIDTH_VERTEX 3
 
+		enum {
+			BLOCK_POSITION = 0,
+			BLOCK_TYPE,
+			BLOCK_ATTRIBUTES,
+		};
+
 		enum {
 			CHUNK_INDEX_COORDINATE = 0,
 			CHUNK_INDEX_NORMAL,
 			CHUNK_INDEX_VERTEX,
+			CHUNK_INDEX_INSTANCE,
+			CHUNK_INDEX_LIGHT,
+		};
+
+		enum {
+			QUAD_DIAGONAL = 0,
+			QUAD_DIAGONAL_OTHER,
+			QUAD_OPPOSITE,
+			QUAD_OPPOSITE_OTHER,
+		};
+
+		enum {
+			OCCLUSION_SIDE = 0,
+			OCCLUSION_SIDE_OTHER,
+			OCCLUSION_CORNER,
+		};
+
+		enum {
+			DECORATION_INSTANCE = 0,
+			DECORATION_LIGHT,
+		};
+
+		enum {
+			MESH_COORDINATE = 0,
+			MESH_LIGHT,
+			MESH_NORMAL,
+			MESH_VERTEX,
+			MESH_INSTANCE,
+			MESH_INSTANCE_LIGHT,
+		};
+
+		enum {
+			RANGE_BASE = 0,
+			RANGE_OFFSET,
 		};
 
 		enum {
 			VAO_COORDINATES = 0,
+			VAO_LIGHT,
 			VAO_NORMAL,
 			VAO_VERTEX,
-			VAO_BASE,
-			VAO_OFFSET,
 		};
 
 		static const glm::vec2 CHUNK_COORDINATE[] = {
@@ -137,6 +192,63 @@ namespace nomic {
 			{ -1.f, 0.f, 1.f }, // left
 			};
 
+		static const int32_t CHUNK_OCCLUSION[][3] = {
+			{ CHUNK_OCCLUSION_OFFSET(1, -1, 0), CHUNK_OCCLUSION_OFFSET(1, 0, -1), CHUNK_OCCLUSION_OFFSET(1, -1, -1), }, // right
+			{ CHUNK_OCCLUSION_OFFSET(1, -1, 0), CHUNK_OCCLUSION_OFFSET(1, 0, 1), CHUNK_OCCLUSION_OFFSET(1, -1, 1), },
+			{ CHUNK_OCCLUSION_OFFSET(1, 1, 0), CHUNK_OCCLUSION_OFFSET(1, 0, 1), CHUNK_OCCLUSION_OFFSET(1, 1, 1), },
+			{ CHUNK_OCCLUSION_OFFSET(1, 1, 0), CHUNK_OCCLUSION_OFFSET(1, 0, 1), CHUNK_OCCLUSION_OFFSET(1, 1, 1), },
+			{ CHUNK_OCCLUSION_OFFSET(1, 1, 0), CHUNK_OCCLUSION_OFFSET(1, 0, -1), CHUNK_OCCLUSION_OFFSET(1, 1, -1), },
+			{ CHUNK_OCCLUSION_OFFSET(1, -1, 0), CHUNK_OCCLUSION_OFFSET(1, 0, -1), CHUNK_OCCLUSION_OFFSET(1, -1, -1), },
+			{ CHUNK_OCCLUSION_OFFSET(-1, -1, 0), CHUNK_OCCLUSION_OFFSET(-1, 0, 1), CHUNK_OCCLUSION_OFFSET(-1, -1, 1), }, // left
+			{ CHUNK_OCCLUSION_OFFSET(-1, -1, 0), CHUNK_OCCLUSION_OFFSET(-1, 0, -1), CHUNK_OCCLUSION_OFFSET(-1, -1, -1), },
+			{ CHUNK_OCCLUSION_OFFSET(-1, 1, 0), CHUNK_OCCLUSION_OFFSET(-1, 0, -1), CHUNK_OCCLUSION_OFFSET(-1, 1, -1), },
+			{ CHUNK_OCCLUSION_OFFSET(-1, 1, 0), CHUNK_OCCLUSION_OFFSET(-1, 0, -1), CHUNK_OCCLUSION_OFFSET(-1, 1, -1), },
+			{ CHUNK_OCCLUSION_OFFSET(-1, 1, 0), CHUNK_OCCLUSION_OFFSET(-1, 0, 1), CHUNK_OCCLUSION_OFFSET(-1, 1, 1), },
+			{ CHUNK_OCCLUSION_OFFSET(-1, -1, 0), CHUNK_OCCLUSION_OFFSET(-1, 0, 1), CHUNK_OCCLUSION_OFFSET(-1, -1, 1), },
+			{ CHUNK_OCCLUSION_OFFSET(-1, 1, 0), CHUNK_OCCLUSION_OFFSET(0, 1, -1), CHUNK_OCCLUSION_OFFSET(-1, 1, -1), }, // top
+			{ CHUNK_OCCLUSION_OFFSET(1, 1, 0), CHUNK_OCCLUSION_OFFSET(0, 1, -1), CHUNK_OCCLUSION_OFFSET(1, 1, -1), },
+			{ CHUNK_OCCLUSION_OFFSET(1, 1, 0), CHUNK_OCCLUSION_OFFSET(0, 1, 1), CHUNK_OCCLUSION_OFFSET(1, 1, 1), },
+			{ CHUNK_OCCLUSION_OFFSET(1, 1, 0), CHUNK_OCCLUSION_OFFSET(0, 1, 1), CHUNK_OCCLUSION_OFFSET(1, 1, 1), },
+			{ CHUNK_OCCLUSION_OFFSET(-1, 1, 0), CHUNK_OCCLUSION_OFFSET(0, 1, 1), CHUNK_OCCLUSION_OFFSET(-1, 1, 1), },
+			{ CHUNK_OCCLUSION_OFFSET(-1, 1, 0), CHUNK_OCCLUSION_OFFSET(0, 1, -1), CHUNK_OCCLUSION_OFFSET(-1, 1, -1), },
+			{ CHUNK_OCCLUSION_OFFSET(-1, -1, 0), CHUNK_OCCLUSION_OFFSET(0, -1, -1), CHUNK_OCCLUSION_OFFSET(-1, -1, -1), }, // bottom
+			{ CHUNK_OCCLUSION_OFFSET(-1, -1, 0), CHUNK_OCCLUSION_OFFSET(0, -1, 1), CHUNK_OCCLUSION_OFFSET(-1, -1, 1), },
+			{ CHUNK_OCCLUSION_OFFSET(1, -1, 0), CHUNK_OCCLUSION_OFFSET(0, -1, -1), CHUNK_OCCLUSION_OFFSET(1, -1, -1), },
+			{ CHUNK_OCCLUSION_OFFSET(1, -1, 0), CHUNK_OCCLUSION_OFFSET(0, -1, -1), CHUNK_OCCLUSION_OFFSET(1, -1, -1), },
+			{ CHUNK_OCCLUSION_OFFSET(-1, -1, 0), CHUNK_OCCLUSION_OFFSET(0, -1, 1), CHUNK_OCCLUSION_OFFSET(-1, -1, 1), },
+			{ CHUNK_OCCLUSION_OFFSET(1, -1, 0), CHUNK_OCCLUSION_OFFSET(0, -1, 1), CHUNK_OCCLUSION_OFFSET(1, -1, 1), },
+			{ CHUNK_OCCLUSION_OFFSET(-1, 0, 1), CHUNK_OCCLUSION_OFFSET(0, -1, 1), CHUNK_OCCLUSION_OFFSET(-1, -1, 1), }, // back
+			{ CHUNK_OCCLUSION_OFFSET(-1, 0, 1), CHUNK_OCCLUSION_OFFSET(0, 1, 1), CHUNK_OCCLUSION_OFFSET(-1, 1, 1), },
+			{ CHUNK_OCCLUSION_OFFSET(1, 0, 1), CHUNK_OCCLUSION_OFFSET(0, 1, 1), CHUNK_OCCLUSION_OFFSET(1, 1, 1), },
+			{ CHUNK_OCCLUSION_OFFSET(1, 0, 1), CHUNK_OCCLUSION_OFFSET(0, 1, 1), CHUNK_OCCLUSION_OFFSET(1, 1, 1), },
+			{ CHUNK_OCCLUSION_OFFSET(1, 0, 1), CHUNK_OCCLUSION_OFFSET(0, -1, 1), CHUNK_OCCLUSION_OFFSET(1, -1, 1), },
+			{ CHUNK_OCCLUSION_OFFSET(-1, 0, 1), CHUNK_OCCLUSION_OFFSET(0, -1, 1), CHUNK_OCCLUSION_OFFSET(-1, -1, 1), },
+			{ CHUNK_OCCLUSION_OFFSET(-1, 0, -1), CHUNK_OCCLUSION_OFFSET(0, 1, -1), CHUNK_OCCLUSION_OFFSET(-1, 1, -1), }, // front
+			{ CHUNK_OCCLUSION_OFFSET(-1, 0, -1), CHUNK_OCCLUSION_OFFSET(0, -1, -1), CHUNK_OCCLUSION_OFFSET(-1, -1, -1), },
+			{ CHUNK_OCCLUSION_OFFSET(1, 0, -1), CHUNK_OCCLUSION_OFFSET(0, -1, -1), CHUNK_OCCLUSION_OFFSET(1, -1, -1), },
+			{ CHUNK_OCCLUSION_OFFSET(1, 0, -1), CHUNK_OCCLUSION_OFFSET(0, -1, -1), CHUNK_OCCLUSION_OFFSET(1, -1, -1), },
+			{ CHUNK_OCCLUSION_OFFSET(1, 0, -1), CHUNK_OCCLUSION_OFFSET(0, 1, -1), CHUNK_OCCLUSION_OFFSET(1, 1, -1), },
+			{ CHUNK_OCCLUSION_OFFSET(-1, 0, -1), CHUNK_OCCLUSION_OFFSET(0, 1, -1), CHUNK_OCCLUSION_OFFSET(-1, 1, -1), },
+			};
+
+		static const uint32_t CHUNK_QUAD_DIAGONAL[][4] = {
+			{ 0, 2, 1, 4, }, // right
+			{ 0, 2, 1, 4, }, // left
+			{ 0, 2, 1, 4, }, // top
+			{ 1, 2, 0, 5, }, // bottom
+			{ 0, 2, 1, 4, }, // back
+			{ 0, 2, 1, 4, }, // front
+			};
+
+		static const uint32_t CHUNK_QUAD_FLIPPED[][BLOCK_FACE_COUNT] = {
+			{ 1, 2, 4, 4, 0, 1, }, // right
+			{ 1, 2, 4, 4, 0, 1, }, // left
+			{ 1, 2, 4, 4, 0, 1, }, // top
+			{ 0, 1, 5, 5, 2, 0, }, // bottom
+			{ 1, 2, 4, 4, 0, 1, }, // back
+			{ 1, 2, 4, 4, 0, 1, }, // front
+			};
+
 		static const glm::vec3 CHUNK_VERTEX[] = {
 			{ BLOCK_WIDTH, 0.f, 0.f }, // right
 			{ BLOCK_WIDTH, 0.f, BLOCK_WIDTH },
@@ -230,6 +342,16 @@ namespace nomic {
 			{ 0.f, BLOCK_WIDTH, BLOCK_SMALL_OFFSET },
 			};
 
+		// cross-quad shared by every chunk's decoration array; vbo copies share the GL handle, and the set is released
+		// with the last array (main thread only)
+		static uint32_t chunk_decoration_count = 0;
+		static std::map<GLuint, nomic::graphic::vbo> chunk_decoration_shared;
+
+		// per-thread meshing scratch, cleared (not freed) between builds so worker threads reuse their capacity
+		static thread_local std::map<uint8_t, chunk_decoration> chunk_scratch_decoration;
+		static thread_local std::map<uint8_t, chunk_data> chunk_scratch_face;
+		static thread_local std::vector<uint8_t> chunk_scratch_occlusion;
+
 		chunk::chunk(
 			__in const glm::ivec2 &position,
 			__in nomic::terrain::generator &generator
@@ -240,7 +362,11 @@ namespace nomic {
 				m_chunk_back(nullptr),
 				m_chunk_front(nullptr),
 				m_chunk_left(nullptr),
-				m_chunk_right(nullptr)
+				m_chunk_right(nullptr),
+				m_decoration_array(nullptr),
+				m_job(JOB_INVALID),
+				m_mesh_capacity(0),
+				m_mesh_retain(false)
 		{
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%i, %i}, Generator=%p", position.x, position.y, &generator);
 
@@ -249,6 +375,25 @@ namespace nomic {
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
+		chunk::chunk(
+			__in const nomic::terrain::chunk &other
+			) :
+				nomic::entity::object(ENTITY_CHUNK, SUBTYPE_UNDEFINED, glm::vec3(other.position().x, 0.0, other.position().y)),
+				nomic::terrain::chunk(other),
+				m_changed(false),
+				m_chunk_back(nullptr),
+				m_chunk_front(nullptr),
+				m_chunk_left(nullptr),
+				m_chunk_right(nullptr),
+				m_decoration_array(nullptr),
+				m_job(JOB_INVALID),
+				m_mesh_capacity(0),
+				m_mesh_retain(false)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Chunk=%p", &other);
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
 		chunk::chunk(
 			__in const chunk &other
 			) :
@@ -259,7 +404,13 @@ namespace nomic {
 				m_chunk_front(other.m_chunk_front),
 				m_chunk_left(other.m_chunk_left),
 				m_chunk_right(other.m_chunk_right),
-				m_face(other.m_face)
+				m_decoration(other.m_decoration),
+				m_decoration_array(nullptr),
+				m_edited(other.m_edited),
+				m_face(other.m_face),
+				m_job(JOB_INVALID),
+				m_mesh_capacity(0),
+				m_mesh_retain(false)
 		{
 			TRACE_ENTRY(LEVEL_VERBOSE);
 			TRACE_EXIT(LEVEL_VERBOSE);
@@ -268,6 +419,18 @@ namespace nomic {
 		chunk::~chunk(void)
 		{
 			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			synchronize();
+
+			if(m_decoration_array) {
+				delete m_decoration_array;
+				m_decoration_array = nullptr;
+
+				if(!--chunk_decoration_count) {
+					chunk_decoration_shared.clear();
+				}
+			}
+
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
@@ -279,6 +442,7 @@ namespace nomic {
 			TRACE_ENTRY(LEVEL_VERBOSE);
 
 			if(this != &other) {
+				synchronize();
 				nomic::entity::object::operator=(other);
 				nomic::terrain::chunk::operator=(other);
 				m_changed = other.m_changed;
@@ -286,6 +450,8 @@ namespace nomic {
 				m_chunk_front = other.m_chunk_front;
 				m_chunk_left = other.m_chunk_left;
 				m_chunk_right = other.m_chunk_right;
+				m_decoration = other.m_decoration;
+				m_edited = other.m_edited;
 				m_face = other.m_face;
 			}
 
@@ -293,22 +459,59 @@ namespace nomic {
 			return *this;
 		}
 
+		void 
+		chunk::add_decoration(
+			__in const glm::vec3 &position,
+			__in const glm::vec3 &block,
+			__in uint8_t type,
+			__in uint8_t attributes
+			)
+		{
+			glm::vec3 position_block = (position + block);
+			std::map<uint8_t, chunk_decoration>::iterator entry;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%f, %f, %f}, Block={%f, %f, %f}, Type=%x, Attributes=%x", position.x,
+				position.y, position.z, block.x, block.y, block.z, type, attributes);
+
+			type = nomic::utility::block_face_type(type, BLOCK_FACE_RIGHT, attributes);
+
+			entry = chunk_scratch_decoration.find(type);
+			if(entry == chunk_scratch_decoration.end()) {
+				entry = chunk_scratch_decoration.insert(std::make_pair(type, chunk_decoration())).first;
+				if(entry == chunk_scratch_decoration.end()) {
+					THROW_NOMIC_ENTITY_CHUNK_EXCEPTION_FORMAT(NOMIC_ENTITY_CHUNK_EXCEPTION_TYPE_INVALID, "Type=%x", type);
+				}
+			}
+
+			std::get<DECORATION_INSTANCE>(entry->second).push_back(glm::vec4(position_block, CHUNK_DECORATION_HASH(position_block.x,
+				position_block.y, position_block.z) / (float) (UINT16_MAX + 1)));
+			std::get<DECORATION_LIGHT>(entry->second).push_back(glm::vec3(light_adjacent(glm::ivec3(block)), 1.f));
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
 		void 
 		chunk::add_face(
 			__in const glm::vec3 &position,
+			__in const glm::vec3 &block,
 			__in uint32_t face,
 			__in uint32_t attributes,
 			__in std::map<uint8_t, chunk_data>::iterator entry
 			)
 		{
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%f, %f, %f}, Face=%x, Attributes=%x", position.x, position.y, position.z, face,
-				attributes);
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%f, %f, %f}, Block={%f, %f, %f}, Face=%x, Attributes=%x", position.x,
+				position.y, position.z, block.x, block.y, block.z, face, attributes);
 
 			std::vector<glm::vec2> &coordinate = std::get<VAO_COORDINATES>(entry->second);
+			std::vector<glm::vec3> &light = std::get<VAO_LIGHT>(entry->second);
 			std::vector<glm::vec3> &normal = std::get<VAO_NORMAL>(entry->second);
 			std::vector<glm::vec3> &vertex = std::get<VAO_VERTEX>(entry->second);
+			glm::vec2 light_face = light_adjacent(glm::ivec3(block + CHUNK_NORMAL[face]));
+			float occlusion[BLOCK_FACE_COUNT];
+			bool flipped = face_occlusion(block, face, occlusion);
 
 			for(uint32_t iter = 0; iter < BLOCK_FACE_COUNT; ++iter) {
+				uint32_t index = (flipped ? CHUNK_QUAD_FLIPPED[face][iter] : iter);
 
 				if(attributes & BLOCK_ATTRIBUTE_ROTATABLE) {
 
@@ -316,59 +519,33 @@ namespace nomic {
 
 						if((face == BLOCK_FACE_BOTTOM) || (face == BLOCK_FACE_TOP)
 								|| (face == BLOCK_FACE_BACK) || (face == BLOCK_FACE_FRONT)) {
-							coordinate.push_back(CHUNK_COORDINATE_ROTATED[(face * BLOCK_FACE_COUNT) + iter]);
+							coordinate.push_back(CHUNK_COORDINATE_ROTATED[(face * BLOCK_FACE_COUNT) + index]);
 						} else {
-							coordinate.push_back(CHUNK_COORDINATE[(face * BLOCK_FACE_COUNT) + iter]);
+							coordinate.push_back(CHUNK_COORDINATE[(face * BLOCK_FACE_COUNT) + index]);
 						}
 					} else if((attributes & BLOCK_ATTRIBUTE_ROTATED_BACK) || (attributes & BLOCK_ATTRIBUTE_ROTATED_FRONT)) {
 
 						if((face == BLOCK_FACE_LEFT) || (face == BLOCK_FACE_RIGHT)) {
-							coordinate.push_back(CHUNK_COORDINATE_ROTATED[(face * BLOCK_FACE_COUNT) + iter]);
+							coordinate.push_back(CHUNK_COORDINATE_ROTATED[(face * BLOCK_FACE_COUNT) + index]);
 						} else {
-							coordinate.push_back(CHUNK_COORDINATE[(face * BLOCK_FACE_COUNT) + iter]);
+							coordinate.push_back(CHUNK_COORDINATE[(face * BLOCK_FACE_COUNT) + index]);
 						}
 					} else {
-						coordinate.push_back(CHUNK_COORDINATE[(face * BLOCK_FACE_COUNT) + iter]);
+						coordinate.push_back(CHUNK_COORDINATE[(face * BLOCK_FACE_COUNT) + index]);
 					}
 				} else {
-					coordinate.push_back(CHUNK_COORDINATE[(face * BLOCK_FACE_COUNT) + iter]);
+					coordinate.push_back(CHUNK_COORDINATE[(face * BLOCK_FACE_COUNT) + index]);
 				}
 
+				light.push_back(glm::vec3(light_face, occlusion[index]));
+
 				if((entry->first == BLOCK_CLOUD) && (face == BLOCK_FACE_BOTTOM)) {
 					normal.push_back(CHUNK_NORMAL[BLOCK_FACE_TOP]);
 				} else {
 					normal.push_back(CHUNK_NORMAL[face]);
 				}
 
-				vertex.push_back(CHUNK_VERTEX[(face * BLOCK_FACE_COUNT) + iter] + position);
-			}
-
-			TRACE_EXIT(LEVEL_VERBOSE);
-		}
-
-		void 
-		chunk::add_face_decoration(
-			__in const glm::vec3 &position,
-			__in uint32_t face,
-			__in uint32_t attributes,
-			__in std::map<uint8_t, chunk_data>::iterator entry
-			)
-		{
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%f, %f, %f}, Face=%x, Attributes=%x", position.x, position.y, position.z, face,
-				attributes);
-
-			std::vector<glm::vec2> &coordinate = std::get<VAO_COORDINATES>(entry->second);
-			std::vector<glm::vec3> &normal = std::get<VAO_NORMAL>(entry->second);
-			std::vector<glm::vec3> &vertex = std::get<VAO_VERTEX>(entry->second);
-
-			if(face > BLOCK_FACE_LEFT) {
-				THROW_NOMIC_ENTITY_CHUNK_EXCEPTION_FORMAT(NOMIC_ENTITY_CHUNK_EXCEPTION_FACE_INVALID, "Face=%x", face);
-			}
-
-			for(uint32_t iter = 0; iter < BLOCK_FACE_COUNT; ++iter) {
-				coordinate.push_back(CHUNK_COORDINATE[(face * BLOCK_FACE_COUNT) + iter]);
-				normal.push_back(CHUNK_NORMAL_DECORATION[face]);
-				vertex.push_back(CHUNK_VERTEX_DECORATION[(face * BLOCK_FACE_COUNT) + iter] + position);
+				vertex.push_back(CHUNK_VERTEX[(face * BLOCK_FACE_COUNT) + index] + position + block);
 			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
@@ -377,22 +554,30 @@ namespace nomic {
 		void 
 		chunk::add_face_small(
 			__in const glm::vec3 &position,
+			__in const glm::vec3 &block,
 			__in uint32_t face,
 			__in uint32_t attributes,
 			__in std::map<uint8_t, chunk_data>::iterator entry
 			)
 		{
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%f, %f, %f}, Face=%x, Attributes=%x", position.x, position.y, position.z, face,
-				attributes);
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%f, %f, %f}, Block={%f, %f, %f}, Face=%x, Attributes=%x", position.x,
+				position.y, position.z, block.x, block.y, block.z, face, attributes);
 
 			std::vector<glm::vec2> &coordinate = std::get<VAO_COORDINATES>(entry->second);
+			std::vector<glm::vec3> &light = std::get<VAO_LIGHT>(entry->second);
 			std::vector<glm::vec3> &normal = std::get<VAO_NORMAL>(entry->second);
 			std::vector<glm::vec3> &vertex = std::get<VAO_VERTEX>(entry->second);
+			glm::vec2 light_face = light_adjacent(glm::ivec3(block + CHUNK_NORMAL[face]));
+			float occlusion[BLOCK_FACE_COUNT];
+			bool flipped = face_occlusion(block, face, occlusion);
 
 			for(uint32_t iter = 0; iter < BLOCK_FACE_COUNT; ++iter) {
-				coordinate.push_back(CHUNK_COORDINATE[(face * BLOCK_FACE_COUNT) + iter]);
+				uint32_t index = (flipped ? CHUNK_QUAD_FLIPPED[face][iter] : iter);
+
+				coordinate.push_back(CHUNK_COORDINATE[(face * BLOCK_FACE_COUNT) + index]);
+				light.push_back(glm::vec3(light_face, occlusion[index]));
 				normal.push_back(CHUNK_NORMAL[face]);
-				vertex.push_back(CHUNK_VERTEX_SMALL[(face * BLOCK_FACE_COUNT) + iter] + position);
+				vertex.push_back(CHUNK_VERTEX_SMALL[(face * BLOCK_FACE_COUNT) + index] + position + block);
 			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
@@ -411,12 +596,12 @@ namespace nomic {
 
 			type = nomic::utility::block_face_type(type, face, attributes);
 
-			result = m_face.find(type);
-			if(result == m_face.end()) {
-				m_face.insert(std::make_pair(type, chunk_data()));
+			result = chunk_scratch_face.find(type);
+			if(result == chunk_scratch_face.end()) {
+				chunk_scratch_face.insert(std::make_pair(type, chunk_data()));
 
-				result = m_face.find(type);
-				if(result == m_face.end()) {
+				result = chunk_scratch_face.find(type);
+				if(result == chunk_scratch_face.end()) {
 					THROW_NOMIC_ENTITY_CHUNK_EXCEPTION_FORMAT(NOMIC_ENTITY_CHUNK_EXCEPTION_TYPE_INVALID,
 						"Type=%x", type);
 				}
@@ -426,217 +611,33 @@ namespace nomic {
 			return result;
 		}
 
-		void 
-		chunk::add_tree(
-			__in const glm::uvec3 &position,
-			__in uint8_t type,
-			__in uint32_t attributes
-			)
+		const nomic::entity::chunk *
+		chunk::adjacent(
+			__inout glm::ivec3 &position
+			) const
 		{
-			uint8_t offset = 0;
-
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%u, %u, %u}, Type=%x, Attributes=%x", position.x, position.y, position.z,
-				type, attributes);
-
-			nomic::terrain::manager &instance = nomic::terrain::manager::acquire();
-			if(instance.initialized()) {
-				int32_t radius, start;
-
-				nomic::terrain::generator &generator = instance.generator();
-
-				switch(type) {
-					case BLOCK_WOOD_OAK: { // oak
-							int32_t y;
-							glm::uvec3 back(0, 0, 1), front(0, 0, -1), left(-1, 0, 0), right(1, 0, 0);
-
-							radius = BLOCK_TREE_OAK_RADIUS_DEFAULT;
-
-							for(; offset <= BLOCK_TREE_OAK_MAX; ++offset) { // trunk
-
-								if((offset >= BLOCK_TREE_OAK_MIN)
-										&& (generator.block_pick(BLOCK_WOOD_OAK, BLOCK_AIR) == BLOCK_AIR)) {
-									break;
-								} else if((offset > BLOCK_TREE_OAK_AVERAGE)
-										&& (generator.block_pick(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_AIR)) {
-									break;
-								}
-
-								if((offset >= BLOCK_TREE_OAK_SPLIT_MIN) && (offset < BLOCK_TREE_OAK_AVERAGE)) {
-
-									if(generator.block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_WOOD_OAK) {
-										// right
-										right.y = (generator.block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK)
-												== BLOCK_WOOD_OAK) ? -1 : 0;
-
-										set_block_adjacent(position + glm::uvec3(0, offset, 0) + right,
-											BLOCK_WOOD_OAK);
-										++right.x;
-									}
-
-									if(generator.block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_WOOD_OAK) {
-										// left
-										left.y = (generator.block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK)
-												== BLOCK_WOOD_OAK) ? -1 : 0;
-
-										set_block_adjacent(position + glm::uvec3(0, offset, 0) + left,
-											BLOCK_WOOD_OAK);
-										--left.x;
-									}
-
-									if(generator.block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_WOOD_OAK) {
-										// back
-										back.y = (generator.block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK)
-												== BLOCK_WOOD_OAK) ? -1 : 0;
-
-										set_block_adjacent(position + glm::uvec3(0, offset, 0) + back,
-											BLOCK_WOOD_OAK);
-										++back.z;
-									}
-
-									if(generator.block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_WOOD_OAK) {
-										// front
-										front.y = (generator.block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK)
-												== BLOCK_WOOD_OAK) ? -1 : 0;
-
-										set_block_adjacent(position + glm::uvec3(0, offset, 0) + front,
-											BLOCK_WOOD_OAK);
-										--front.z;
-									}
-								}
-
-								set_block(position + glm::uvec3(0, offset, 0), BLOCK_WOOD_OAK);
-							}
-
-							radius = std::max((int32_t) right.x, radius);
-							radius = std::max(std::abs((int32_t) left.x), radius);
-							radius = std::max((int32_t) back.z, radius);
-							radius = std::max(std::abs((int32_t) front.z), radius);
-							++radius;
-
-							start = BLOCK_TREE_OAK_LEAVES_START;
-							if(generator.block_pick(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_WOOD_OAK) {
-								--start;	
-							}
-
-							for(y = start; y <= offset; ++y) { // leaves
-								int32_t layer_radius = radius;
-
-								float delta = ((offset - y) / (float) (offset - start));
-								if(delta <= 0.5f) {
-									layer_radius *= delta;
-								} else {
-									layer_radius *= (1.f - delta);
-								}
-
-								layer_radius += BLOCK_TREE_OAK_RADIUS_DEFAULT;
-
-								for(int32_t z = -radius; z < radius; ++z) {
-
-									for(int32_t x = -radius; x < radius; ++x) {
-
-										if((std::abs(x * x) + std::abs(z * z))
-												<= (layer_radius * layer_radius)) {
-											set_block_adjacent(position + glm::uvec3(x, y, z),
-												BLOCK_LEAVES_OAK);
-										}
-									}
-								}
-							}
-
-							if(generator.block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_WOOD_OAK) {
-								for(; y < (offset + BLOCK_TREE_OAK_CAP_WIDTH); ++y) {
-
-									for(int32_t z = -BLOCK_TREE_OAK_CAP_RADIUS; z < BLOCK_TREE_OAK_CAP_RADIUS;
-											++z) {
-
-										for(int32_t x = -BLOCK_TREE_OAK_CAP_RADIUS;
-												x < BLOCK_TREE_OAK_CAP_RADIUS; ++x) {
-											set_block_adjacent(position + glm::uvec3(x, y, z),
-												BLOCK_LEAVES_OAK);
-										}
-									}
-								}
-
-								if(generator.block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_WOOD_OAK) {
-									set_block_adjacent(position + glm::uvec3(0, y, 0), BLOCK_LEAVES_OAK);
-								}
-							}
-						} break;
-					case BLOCK_WOOD_SPRUCE: { // spruce
-							int8_t end, layer_radius = 1, layer_radius_previous;
-
-							radius = BLOCK_TREE_SPRUCE_RADIUS_DEFAULT;
-
-							for(; offset <= BLOCK_TREE_SPRUCE_MAX; ++offset) { // trunk
-
-								if((offset >= BLOCK_TREE_SPRUCE_MIN)
-										&& (generator.block_pick(BLOCK_WOOD_SPRUCE, BLOCK_AIR) == BLOCK_AIR)) {
-									break;
-								} else if((offset > BLOCK_TREE_SPRUCE_AVERAGE)
-										&& (generator.block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_SPRUCE)
-											== BLOCK_AIR)) {
-									break;
-								}
-
-								set_block(position + glm::uvec3(0, offset, 0), BLOCK_WOOD_SPRUCE);
-							}
-
-							set_block_adjacent(position + glm::uvec3(0, offset, 0), BLOCK_LEAVES_SPRUCE); // leaves
-
-							start = (int32_t) offset;
-							if(generator.block_pick(BLOCK_AIR, BLOCK_WOOD_SPRUCE) == BLOCK_AIR) {
-								--start;
-							}
-
-							end = BLOCK_TREE_SPRUCE_LEAVES_END;
-							if(generator.block_pick(BLOCK_AIR, BLOCK_WOOD_SPRUCE) == BLOCK_WOOD_SPRUCE) {
-								--end;
-							}
+			const nomic::entity::chunk *result = this;
 
-							for(int32_t y = start; y >= end; --y) {
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%i, %i, %i}", position.x, position.y, position.z);
 
-								if(!(y % 2)) {
-									layer_radius_previous = layer_radius;
-									layer_radius = ((generator.block_pick(BLOCK_AIR, BLOCK_WOOD_SPRUCE)
-										== BLOCK_AIR) ? 1 : 0);
-
-									if(layer_radius && ((generator.block_pick(BLOCK_AIR, BLOCK_WOOD_SPRUCE)
-											== BLOCK_WOOD_SPRUCE))) {
-										layer_radius = (layer_radius_previous + 1);
-									}
-								}
-
-								if(layer_radius) {
-
-									for(int32_t z = -radius; z < radius; ++z) {
-
-										for(int32_t x = -radius; x < radius; ++x) {
-
-											if((std::abs(x * x) + std::abs(z * z))
-													<= (layer_radius * layer_radius)) {
-												set_block_adjacent(position + glm::uvec3(x, y, z),
-													BLOCK_LEAVES_SPRUCE);
-											}
-										}
-									}
-								}
-
-								if(!(y % 2)) {
-									layer_radius = layer_radius_previous;
-								} else {
-									++layer_radius;
-								}
-							}
-						} break;
-					default:
-						THROW_NOMIC_ENTITY_CHUNK_EXCEPTION_FORMAT(NOMIC_ENTITY_CHUNK_EXCEPTION_TYPE_INVALID,
-							"Type=%x", type);
-				}
+			if(position.x >= CHUNK_WIDTH) { // right
+				result = m_chunk_right;
+				position.x -= CHUNK_WIDTH;
+			} else if(position.x < 0) { // left
+				result = m_chunk_left;
+				position.x += CHUNK_WIDTH;
 			}
 
-			instance.release();
+			if(result && (position.z >= CHUNK_WIDTH)) { // back
+				result = result->m_chunk_back;
+				position.z -= CHUNK_WIDTH;
+			} else if(result && (position.z < 0)) { // front
+				result = result->m_chunk_front;
+				position.z += CHUNK_WIDTH;
+			}
 
-			TRACE_EXIT(LEVEL_VERBOSE);
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%p", result);
+			return result;
 		}
 
 		uint8_t 
@@ -669,6 +670,37 @@ namespace nomic {
 			return result;
 		}
 
+		uint8_t 
+		chunk::block_light(
+			__in const glm::uvec3 &position
+			) const
+		{
+			uint8_t result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%u, %u, %u}", position.x, position.y, position.z);
+
+			result = nomic::terrain::chunk::light(position);
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x(%u)", (uint16_t) result, (uint16_t) result);
+			return result;
+		}
+
+		bool 
+		chunk::block_mask(
+			__in uint32_t type,
+			__in const glm::uvec3 &position
+			) const
+		{
+			bool result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Type=%x, Position={%u, %u, %u}", type, position.x, position.y, position.z);
+
+			result = nomic::terrain::chunk::mask(type, position);
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
+			return result;
+		}
+
 		uint8_t 
 		chunk::block_type(
 			__in const glm::uvec3 &position
@@ -685,649 +717,648 @@ namespace nomic {
 		}
 
 		void 
-		chunk::on_render(
-			__in nomic::core::renderer &renderer,
-			__in void *textures,
-			__in float delta
-			)
+		chunk::build(void)
 		{
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Renderer=%p, Textures=%p, Delta=%f", &renderer, textures, delta);
+			glm::vec3 position;
+			uint64_t decoration[CHUNK_MASK_WORD_COUNT], face[BLOCK_FACE_COUNT][CHUNK_MASK_WORD_COUNT];
+			const std::vector<uint8_t> &block_attributes = std::get<nomic::terrain::SNAPSHOT_ATTRIBUTES>(m_snapshot),
+				&block = std::get<nomic::terrain::SNAPSHOT_BLOCK>(m_snapshot);
 
-			if(!m_face.empty()) {
-				nomic::graphic::vao &arr = vertex_array();
-				arr.bind();
-				arr.enable(CHUNK_INDEX_COORDINATE);
-				arr.enable(CHUNK_INDEX_NORMAL);
-				arr.enable(CHUNK_INDEX_VERTEX);
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			// runs on a worker; reads only the snapshot taken by build_snapshot on the main thread
+			nomic::terrain::chunk::update_light();
+			build_occlusion();
+
+			for(std::map<uint8_t, chunk_decoration>::iterator iter = chunk_scratch_decoration.begin();
+					iter != chunk_scratch_decoration.end(); ++iter) {
+				std::get<DECORATION_INSTANCE>(iter->second).clear();
+				std::get<DECORATION_LIGHT>(iter->second).clear();
+			}
+
+			for(std::map<uint8_t, chunk_data>::iterator iter = chunk_scratch_face.begin(); iter != chunk_scratch_face.end(); ++iter) {
+				std::get<VAO_COORDINATES>(iter->second).clear();
+				std::get<VAO_LIGHT>(iter->second).clear();
+				std::get<VAO_NORMAL>(iter->second).clear();
+				std::get<VAO_VERTEX>(iter->second).clear();
+			}
+
+			m_face_column_build.clear();
+			position.x = (nomic::terrain::chunk::position().x * (CHUNK_WIDTH - 1));
+			position.z = (nomic::terrain::chunk::position().y * (CHUNK_WIDTH - 1));
+
+			for(int32_t z = 0; z < CHUNK_WIDTH; ++z) {
 
-				if(textures) {
-					nomic::graphic::atlas *texture_ref = (nomic::graphic::atlas *) textures;
+				for(int32_t x = 0; x < CHUNK_WIDTH; ++x) {
+					build_mask(glm::uvec2(x, z), face, decoration);
 
-					for(std::map<uint8_t, chunk_data>::iterator iter = m_face.begin(); iter != m_face.end(); ++iter) {
+					for(int32_t word = (CHUNK_MASK_WORD_COUNT - 1); word >= 0; --word) {
+						uint64_t remaining = decoration[word];
 
-						bool decoration = nomic::utility::block_decoration(iter->first);
-						if(decoration) {
-							GL_CHECK(LEVEL_WARNING, glDisable, GL_CULL_FACE);
+						for(uint32_t iter = BLOCK_FACE_MIN; iter <= BLOCK_FACE_MAX; ++iter) {
+							remaining |= face[iter][word];
 						}
 
-						if(!nomic::utility::block_transparent(iter->first)) {
-							texture_ref->enable(iter->first);
-							GL_CHECK(LEVEL_WARNING, glDrawArrays, GL_TRIANGLES, std::get<VAO_BASE>(iter->second),
-								std::get<VAO_OFFSET>(iter->second));
+						while(remaining) { // top-down over blocks with at least one visible face
+							bool small;
+							uint32_t bit = CHUNK_MASK_BIT_HIGHEST(remaining);
+							uint64_t mask = (1ULL << bit);
+							int32_t y = ((word * CHUNK_MASK_WORD_WIDTH) + bit);
+							uint32_t index = CHUNK_SNAPSHOT_INDEX(x, y, z);
+							uint8_t attributes = block_attributes[index], type = block[index];
+							glm::vec3 position_relative = glm::vec3(x, y, z);
+
+							remaining &= ~mask;
+
+							if(decoration[word] & mask) {
+								add_decoration(position, position_relative, type, attributes);
+								continue;
+							}
+
+							small = nomic::utility::block_small(type);
+
+							for(uint32_t iter = BLOCK_FACE_MIN; iter <= BLOCK_FACE_MAX; ++iter) {
+
+								if(face[iter][word] & mask) {
+									std::map<uint8_t, chunk_data>::iterator face_iter = add_face_type(type, iter,
+										attributes);
+
+									if(small) {
+										add_face_small(position, position_relative, iter, attributes, face_iter);
+									} else {
+										add_face(position, position_relative, iter, attributes, face_iter);
+									}
+								}
+							}
 						}
+					}
 
-						if(decoration) {
-							GL_CHECK(LEVEL_WARNING, glEnable, GL_CULL_FACE);
+					// columns run in index order, so each texture's faces end at a known offset per column
+					for(std::map<uint8_t, chunk_data>::iterator iter = chunk_scratch_face.begin(); iter != chunk_scratch_face.end();
+							++iter) {
+						std::vector<uint32_t> &column = m_face_column_build[iter->first];
+
+						if(column.empty()) {
+							column.resize(CHUNK_BLOCK_SURFACE_COUNT + 1, 0);
 						}
+
+						column[CHUNK_COLUMN_INDEX(x, z) + 1] = std::get<VAO_VERTEX>(iter->second).size();
 					}
-				} else {
-					GL_CHECK(LEVEL_WARNING, glDrawArrays, GL_TRIANGLES, 0, m_face.size() * BLOCK_FACE_COUNT);
 				}
 			}
 
+			build_mesh();
+
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
 		void 
-		chunk::on_render_transparent(
-			__in nomic::core::renderer &renderer,
-			__in void *textures,
-			__in float delta
-			)
+		chunk::build_mask(
+			__in const glm::uvec2 &column,
+			__inout uint64_t (&face)[BLOCK_FACE_COUNT][CHUNK_MASK_WORD_COUNT],
+			__inout uint64_t (&decoration)[CHUNK_MASK_WORD_COUNT]
+			) const
 		{
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Renderer=%p, Textures=%p, Delta=%f", &renderer, textures, delta);
-
-			if(!m_face.empty()) {
-				nomic::graphic::vao &arr = vertex_array();
-				arr.bind();
-				arr.enable(CHUNK_INDEX_COORDINATE);
-				arr.enable(CHUNK_INDEX_NORMAL);
-				arr.enable(CHUNK_INDEX_VERTEX);
-
-				if(textures) {
-					nomic::graphic::atlas *texture_ref = (nomic::graphic::atlas *) textures;
-
-					for(std::map<uint8_t, chunk_data>::iterator iter = m_face.begin(); iter != m_face.end(); ++iter) {
-
-						bool decoration = nomic::utility::block_decoration(iter->first);
-						if(decoration) {
-							GL_CHECK(LEVEL_WARNING, glDisable, GL_CULL_FACE);
-						}
-
-						if(nomic::utility::block_transparent(iter->first)) {
-							texture_ref->enable(iter->first);
-							GL_CHECK(LEVEL_WARNING, glDrawArrays, GL_TRIANGLES, std::get<VAO_BASE>(iter->second),
-								std::get<VAO_OFFSET>(iter->second));
-						}
-
-						if(decoration) {
-							GL_CHECK(LEVEL_WARNING, glEnable, GL_CULL_FACE);
-						}
+			int32_t x = column.x, z = column.y;
+			const std::vector<uint64_t> &mask = std::get<nomic::terrain::SNAPSHOT_MASK>(m_snapshot);
+			const uint64_t *cloud = &mask[CHUNK_SNAPSHOT_MASK_INDEX(CHUNK_MASK_CLOUD, x, z)],
+				*decorative = &mask[CHUNK_SNAPSHOT_MASK_INDEX(CHUNK_MASK_DECORATION, x, z)],
+				*transparent = &mask[CHUNK_SNAPSHOT_MASK_INDEX(CHUNK_MASK_TRANSPARENT, x, z)],
+				*visible = &mask[CHUNK_SNAPSHOT_MASK_INDEX(CHUNK_MASK_VISIBLE, x, z)],
+				*water = &mask[CHUNK_SNAPSHOT_MASK_INDEX(CHUNK_MASK_WATER, x, z)];
+			const uint64_t *edge_air[BLOCK_FACE_COUNT] = {}, *edge_transparent[BLOCK_FACE_COUNT] = {};
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Column={%u, %u}", column.x, column.y);
+
+			// border columns come from the snapshot ring, which is empty (no faces) where no neighbor is attached
+			edge_air[BLOCK_FACE_RIGHT] = &mask[CHUNK_SNAPSHOT_MASK_INDEX(CHUNK_MASK_AIR, x + 1, z)];
+			edge_transparent[BLOCK_FACE_RIGHT] = &mask[CHUNK_SNAPSHOT_MASK_INDEX(CHUNK_MASK_TRANSPARENT, x + 1, z)];
+			edge_air[BLOCK_FACE_LEFT] = &mask[CHUNK_SNAPSHOT_MASK_INDEX(CHUNK_MASK_AIR, x - 1, z)];
+			edge_transparent[BLOCK_FACE_LEFT] = &mask[CHUNK_SNAPSHOT_MASK_INDEX(CHUNK_MASK_TRANSPARENT, x - 1, z)];
+			edge_air[BLOCK_FACE_BACK] = &mask[CHUNK_SNAPSHOT_MASK_INDEX(CHUNK_MASK_AIR, x, z + 1)];
+			edge_transparent[BLOCK_FACE_BACK] = &mask[CHUNK_SNAPSHOT_MASK_INDEX(CHUNK_MASK_TRANSPARENT, x, z + 1)];
+			edge_air[BLOCK_FACE_FRONT] = &mask[CHUNK_SNAPSHOT_MASK_INDEX(CHUNK_MASK_AIR, x, z - 1)];
+			edge_transparent[BLOCK_FACE_FRONT] = &mask[CHUNK_SNAPSHOT_MASK_INDEX(CHUNK_MASK_TRANSPARENT, x, z - 1)];
+
+			for(uint32_t word = 0; word < CHUNK_MASK_WORD_COUNT; ++word) {
+				uint64_t below_transparent, below_water, above_transparent, above_water, fluid, solid;
+
+				// shift whole columns by one block, carrying across words; above the top layer is open air
+				below_transparent = ((transparent[word] << 1) | (word ? (transparent[word - 1] >> (CHUNK_MASK_WORD_WIDTH - 1)) : 0));
+				below_water = ((water[word] << 1) | (word ? (water[word - 1] >> (CHUNK_MASK_WORD_WIDTH - 1)) : 0));
+				above_transparent = ((transparent[word] >> 1) | (((word + 1) < CHUNK_MASK_WORD_COUNT)
+					? (transparent[word + 1] << (CHUNK_MASK_WORD_WIDTH - 1)) : (1ULL << (CHUNK_MASK_WORD_WIDTH - 1))));
+				above_water = ((water[word] >> 1) | (((word + 1) < CHUNK_MASK_WORD_COUNT)
+					? (water[word + 1] << (CHUNK_MASK_WORD_WIDTH - 1)) : 0));
+				fluid = (cloud[word] | water[word]);
+				solid = (visible[word] & ~decorative[word]);
+
+				for(uint32_t iter = BLOCK_FACE_MIN; iter <= BLOCK_FACE_MAX; ++iter) {
+
+					switch(iter) {
+						case BLOCK_FACE_TOP:
+							face[iter][word] = (solid & ~cloud[word] & above_transparent & ~(water[word] & above_water));
+							break;
+						case BLOCK_FACE_BOTTOM:
+							face[iter][word] = (solid & below_transparent & ~(water[word] & below_water));
+							break;
+						default: // clouds and water only show sides against air
+							face[iter][word] = (solid & ((fluid & edge_air[iter][word])
+								| (~fluid & edge_transparent[iter][word])));
+							break;
 					}
-				} else {
-					GL_CHECK(LEVEL_WARNING, glDrawArrays, GL_TRIANGLES, 0, m_face.size() * BLOCK_FACE_COUNT);
 				}
+
+				decoration[word] = (visible[word] & decorative[word]);
 			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
 		void 
-		chunk::on_update(
-			__in void *runtime,
-			__in void *camera
-			)
+		chunk::build_mesh(void)
 		{
-			bool shown = true;
-			std::vector<std::pair<glm::uvec3, uint8_t>> spawn;
+			uint32_t count = 0, count_instance = 0;
+			std::vector<glm::vec2> &coordinate = std::get<MESH_COORDINATE>(m_mesh);
+			std::vector<glm::vec4> &instance = std::get<MESH_INSTANCE>(m_mesh);
+			std::vector<glm::vec3> &instance_light = std::get<MESH_INSTANCE_LIGHT>(m_mesh), &light = std::get<MESH_LIGHT>(m_mesh),
+				&normal = std::get<MESH_NORMAL>(m_mesh), &vertex = std::get<MESH_VERTEX>(m_mesh);
 
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Runtime=%p, Camera=%p", runtime, camera);
+			TRACE_ENTRY(LEVEL_VERBOSE);
 
-			spawn = nomic::terrain::chunk::spawn();
-			if(!spawn.empty()) {
-
-				for(std::vector<std::pair<glm::uvec3, uint8_t>>::iterator iter = spawn.begin(); iter != spawn.end(); ++iter) {
-					uint8_t attributes = BLOCK_ATTRIBUTES_DEFAULT, type = iter->second;
-
-					if(m_chunk_back && m_chunk_front && m_chunk_left && m_chunk_right
-							&& m_chunk_left->m_chunk_back && m_chunk_left->m_chunk_front
-							&& m_chunk_right->m_chunk_back && m_chunk_right->m_chunk_front
-							&& m_chunk_back->shown() && m_chunk_front->shown()
-							&& m_chunk_left->shown() && m_chunk_right->shown()
-							&& m_chunk_left->m_chunk_back->shown()
-							&& m_chunk_left->m_chunk_front->shown()
-							&& m_chunk_right->m_chunk_back->shown()
-							&& m_chunk_right->m_chunk_front->shown()) {
-
-						switch(type) {
-							case BLOCK_WOOD_OAK:
-							case BLOCK_WOOD_SPRUCE:
-								add_tree(iter->first, type, attributes);
-								break;
-							default:
-								set_block(iter->first, type, attributes, true);
-								break;
-						}
-					} else {
-						nomic::terrain::chunk::set_spawn(iter->first, iter->second,
-							CHUNK_SPAWN_DEFERRED_TIMEOUT);
-					}
-				}
+			m_decoration_build.clear();
+			m_face_build.clear();
 
-				spawn.clear();
+			for(std::map<uint8_t, chunk_data>::iterator iter = chunk_scratch_face.begin(); iter != chunk_scratch_face.end(); ++iter) {
+				count += std::get<VAO_VERTEX>(iter->second).size();
 			}
 
-			nomic::terrain::chunk::update();
+			for(std::map<uint8_t, chunk_decoration>::iterator iter = chunk_scratch_decoration.begin();
+					iter != chunk_scratch_decoration.end(); ++iter) {
+				count_instance += std::get<DECORATION_INSTANCE>(iter->second).size();
+			}
 
-			if(m_changed) {
-				std::vector<glm::vec2> coordinate;
-				std::vector<glm::vec3> normal, vertex;
-
-				m_changed = false;
-				rebuild(m_chunk_right, m_chunk_left, m_chunk_back, m_chunk_front);
-
-				for(std::map<uint8_t, chunk_data>::iterator iter = m_face.begin(); iter != m_face.end(); ++iter) {
-					std::vector<glm::vec2> &iter_coordinate = std::get<VAO_COORDINATES>(iter->second);
-					std::vector<glm::vec3> &iter_normal = std::get<VAO_NORMAL>(iter->second);
-					std::vector<glm::vec3> &iter_vertex = std::get<VAO_VERTEX>(iter->second);
-
-					coordinate.insert(coordinate.end(), iter_coordinate.begin(), iter_coordinate.end());
-					normal.insert(normal.end(), iter_normal.begin(), iter_normal.end());
-					std::get<VAO_BASE>(iter->second) = vertex.size();
-					std::get<VAO_OFFSET>(iter->second) = iter_vertex.size();
-					vertex.insert(vertex.end(), iter_vertex.begin(), iter_vertex.end());
-
-					std::get<VAO_COORDINATES>(iter->second).clear();
-					std::get<VAO_NORMAL>(iter->second).clear();
-					std::get<VAO_VERTEX>(iter->second).clear();
+			coordinate.clear();
+			coordinate.reserve(count);
+			light.clear();
+			light.reserve(count);
+			normal.clear();
+			normal.reserve(count);
+			vertex.clear();
+			vertex.reserve(count);
+
+			for(std::map<uint8_t, chunk_data>::iterator iter = chunk_scratch_face.begin(); iter != chunk_scratch_face.end(); ++iter) {
+				std::vector<glm::vec2> &iter_coordinate = std::get<VAO_COORDINATES>(iter->second);
+				std::vector<glm::vec3> &iter_light = std::get<VAO_LIGHT>(iter->second);
+				std::vector<glm::vec3> &iter_normal = std::get<VAO_NORMAL>(iter->second);
+				std::vector<glm::vec3> &iter_vertex = std::get<VAO_VERTEX>(iter->second);
+
+				if(iter_vertex.empty()) {
+					m_face_column_build.erase(iter->first);
+					continue;
 				}
 
-				nomic::graphic::vao &arr = vertex_array();
-				arr.disable_all();
-				arr.remove_all();
-				arr.clear();
-				arr.bind();
-				arr.add(nomic::graphic::vbo(GL_ARRAY_BUFFER, std::vector<uint8_t>((uint8_t *) &coordinate[0],
-					((uint8_t *) &coordinate[0]) + (coordinate.size() * CHUNK_SEGMENT_WIDTH_COORDINATE * sizeof(GLfloat))),
-					GL_STATIC_DRAW), CHUNK_INDEX_COORDINATE, CHUNK_SEGMENT_WIDTH_COORDINATE, GL_FLOAT);
-				arr.add(nomic::graphic::vbo(GL_ARRAY_BUFFER, std::vector<uint8_t>((uint8_t *) &normal[0],
-					((uint8_t *) &normal[0]) + (normal.size() * CHUNK_SEGMENT_WIDTH_NORMAL * sizeof(GLfloat))),
-					GL_STATIC_DRAW), CHUNK_INDEX_NORMAL, CHUNK_SEGMENT_WIDTH_NORMAL, GL_FLOAT);
-				arr.add(nomic::graphic::vbo(GL_ARRAY_BUFFER, std::vector<uint8_t>((uint8_t *) &vertex[0],
-					((uint8_t *) &vertex[0]) + (vertex.size() * CHUNK_SEGMENT_WIDTH_VERTEX * sizeof(GLfloat))),
-					GL_STATIC_DRAW), CHUNK_INDEX_VERTEX, CHUNK_SEGMENT_WIDTH_VERTEX, GL_FLOAT);
-				arr.enable(CHUNK_INDEX_COORDINATE);
-				arr.enable(CHUNK_INDEX_NORMAL);
-				arr.enable(CHUNK_INDEX_VERTEX);
+				m_face_build.insert(std::make_pair(iter->first, chunk_range(vertex.size(), iter_vertex.size())));
+				coordinate.insert(coordinate.end(), iter_coordinate.begin(), iter_coordinate.end());
+				light.insert(light.end(), iter_light.begin(), iter_light.end());
+				normal.insert(normal.end(), iter_normal.begin(), iter_normal.end());
+				vertex.insert(vertex.end(), iter_vertex.begin(), iter_vertex.end());
 			}
 
-#ifdef VIEW_SELECTIVE_SHOW
-			glm::vec3 camera_position = ((nomic::entity::camera *) camera)->position();
-			glm::ivec2 camera_position_chunk = glm::ivec2(camera_position.x / CHUNK_WIDTH, camera_position.z / CHUNK_WIDTH);
-			glm::ivec2 position_chunk = nomic::entity::chunk::position();
-			int32_t dx = (position_chunk.x - camera_position_chunk.x), dz = (position_chunk.y - camera_position_chunk.y);
-			shown = ((std::abs(dx * dx) + std::abs(dz * dz)) <= (VIEW_RADIUS_RUNTIME * VIEW_RADIUS_RUNTIME));
-#endif // VIEW_SELECTIVE_SHOW
-			show(shown);
+			instance.clear();
+			instance.reserve(count_instance);
+			instance_light.clear();
+			instance_light.reserve(count_instance);
 
-			TRACE_EXIT(LEVEL_VERBOSE);
+			for(std::map<uint8_t, chunk_decoration>::iterator iter = chunk_scratch_decoration.begin();
+					iter != chunk_scratch_decoration.end(); ++iter) {
+				std::vector<glm::vec4> &iter_instance = std::get<DECORATION_INSTANCE>(iter->second);
+				std::vector<glm::vec3> &iter_light = std::get<DECORATION_LIGHT>(iter->second);
+
+				if(iter_instance.empty()) {
+					continue;
+				}
+
+				m_decoration_build.insert(std::make_pair(iter->first, chunk_range(instance.size(), iter_instance.size())));
+				instance.insert(instance.end(), iter_instance.begin(), iter_instance.end());
+				instance_light.insert(instance_light.end(), iter_light.begin(), iter_light.end());
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Vertex[%u], Instance[%u]", count, count_instance);
 		}
 
-		glm::ivec2 
-		chunk::position(void) const
+		void 
+		chunk::build_mesh_dirty(
+			__in const nomic::terrain::chunk_column &column
+			)
 		{
-			glm::ivec2 result;
+			nomic::terrain::chunk_column dirty;
+			uint32_t count = std::get<MESH_VERTEX>(m_mesh).size();
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Column[%u]", column.count());
+
+			m_mesh_dirty.clear();
+
+			if(m_mesh_retain && m_mesh_capacity && (count <= m_mesh_capacity)) {
+
+				// faces read masks, light and occlusion from the columns around them
+				for(int32_t z = 0; z < CHUNK_WIDTH; ++z) {
+
+					for(int32_t x = 0; x < CHUNK_WIDTH; ++x) {
+
+						if(!column.test(CHUNK_COLUMN_INDEX(x, z))) {
+							continue;
+						}
+
+						for(int32_t z_adjacent = std::max(z - 1, 0); z_adjacent <= std::min(z + 1, CHUNK_WIDTH - 1); ++z_adjacent) {
+
+							for(int32_t x_adjacent = std::max(x - 1, 0); x_adjacent <= std::min(x + 1, CHUNK_WIDTH - 1);
+									++x_adjacent) {
+								dirty.set(CHUNK_COLUMN_INDEX(x_adjacent, z_adjacent));
+							}
+						}
+					}
+				}
+
+				for(std::map<uint8_t, chunk_range>::iterator iter = m_face_build.begin(); iter != m_face_build.end(); ++iter) {
+					bool shifted = false;
+					uint32_t base = std::get<RANGE_BASE>(iter->second), first = UINT32_MAX, last = 0;
+					std::map<uint8_t, chunk_range>::iterator iter_previous = m_face.find(iter->first);
+					std::map<uint8_t, std::vector<uint32_t>>::iterator iter_column = m_face_column_build.find(iter->first),
+						iter_column_previous = m_face_column.find(iter->first);
+
+					if((iter_previous == m_face.end()) || (iter_column_previous == m_face_column.end())
+							|| (std::get<RANGE_BASE>(iter_previous->second) != base)) { // texture moved, so the rest of the mesh did too
+						m_mesh_dirty.push_back(chunk_range(base, count - base));
+						break;
+					}
+
+					const std::vector<uint32_t> &offset = iter_column->second, &offset_previous = iter_column_previous->second;
+
+					for(uint32_t index = 0; index < CHUNK_BLOCK_SURFACE_COUNT; ++index) {
+
+						if(offset[index + 1] != offset_previous[index + 1]) { // column face count changed, shifting what follows
+							first = std::min(first, offset[index]);
+							shifted = true;
+							break;
+						}
+
+						if(dirty.test(index) && (offset[index + 1] > offset[index])) {
+							first = std::min(first, offset[index]);
+							last = offset[index + 1];
+						}
+					}
+
+					if(shifted) {
+
+						if((base + first) < count) {
+							m_mesh_dirty.push_back(chunk_range(base + first, count - (base + first)));
+						}
+
+						break;
+					}
+
+					if(first < last) {
+						m_mesh_dirty.push_back(chunk_range(base + first, last - first));
+					}
+				}
+			} else if(count) {
+				m_mesh_dirty.push_back(chunk_range(0, count));
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Dirty[%u]", m_mesh_dirty.size());
+		}
+
+		void 
+		chunk::build_occlusion(void)
+		{
+			const std::vector<uint8_t> &block = std::get<nomic::terrain::SNAPSHOT_BLOCK>(m_snapshot);
 
 			TRACE_ENTRY(LEVEL_VERBOSE);
 
-			result = nomic::terrain::chunk::position();
+			chunk_scratch_occlusion.assign(CHUNK_OCCLUSION_WIDTH * CHUNK_OCCLUSION_HEIGHT * CHUNK_OCCLUSION_WIDTH, 0);
 
-			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Position={%i, %i}", result.x, result.y);
-			return result;
+			for(int32_t x = -1; x <= CHUNK_WIDTH; ++x) {
+
+				for(int32_t z = -1; z <= CHUNK_WIDTH; ++z) {
+					uint8_t *column = &chunk_scratch_occlusion[CHUNK_OCCLUSION_INDEX(x, 0, z)];
+
+					for(uint32_t y = 0; y < CHUNK_HEIGHT; ++y) {
+						column[y * CHUNK_OCCLUSION_WIDTH] = !nomic::utility::block_transparent(block[CHUNK_SNAPSHOT_INDEX(x, y, z)]);
+					}
+				}
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
 		void 
-		chunk::rebuild(
-			__in_opt nomic::entity::chunk *right,
-			__in_opt nomic::entity::chunk *left,
-			__in_opt nomic::entity::chunk *back,
-			__in_opt nomic::entity::chunk *front
-			)
+		chunk::build_snapshot(void)
 		{
-			glm::vec3 position;
+			std::vector<uint8_t> &block = std::get<nomic::terrain::SNAPSHOT_BLOCK>(m_snapshot),
+				&light = std::get<nomic::terrain::SNAPSHOT_LIGHT>(m_snapshot);
+			std::vector<uint64_t> &mask = std::get<nomic::terrain::SNAPSHOT_MASK>(m_snapshot);
 
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Edge={%p, %p, %p, %p}", right, left, back, front);
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Edge={%p, %p, %p, %p}", m_chunk_right, m_chunk_left, m_chunk_back, m_chunk_front);
 
-			m_face.clear();
-			m_chunk_back = back;
-			m_chunk_front = front;
-			m_chunk_left = left;
-			m_chunk_right = right;
-			position.x = (nomic::terrain::chunk::position().x * (CHUNK_WIDTH - 1));
-			position.z = (nomic::terrain::chunk::position().y * (CHUNK_WIDTH - 1));
+			nomic::terrain::chunk::snapshot();
+			std::get<nomic::terrain::SNAPSHOT_LIGHT_BORDER>(m_snapshot) = ((m_chunk_right ? (1 << BLOCK_FACE_RIGHT) : 0)
+				| (m_chunk_left ? (1 << BLOCK_FACE_LEFT) : 0) | (m_chunk_back ? (1 << BLOCK_FACE_BACK) : 0)
+				| (m_chunk_front ? (1 << BLOCK_FACE_FRONT) : 0));
 
-			for(int32_t z = 0; z < CHUNK_WIDTH; ++z) {
+			for(int32_t x = -1; x <= CHUNK_WIDTH; ++x) {
 
-				for(int32_t x = 0; x < CHUNK_WIDTH; ++x) {
+				for(int32_t z = -1; z <= CHUNK_WIDTH; ++z) {
+					const nomic::entity::chunk *chunk;
+					glm::ivec3 position = glm::ivec3(x, 0, z);
 
-					for(int32_t y = (CHUNK_HEIGHT - 1); y >= 0; --y) {
-						uint8_t attributes;
-						uint32_t count = 0, type;
-						glm::vec3 position_relative = glm::vec3(x, y, z);
-
-						type = nomic::terrain::chunk::type(position_relative);
-						attributes = nomic::terrain::chunk::attributes(position_relative);
-
-						if((type != BLOCK_AIR) && !(attributes & BLOCK_ATTRIBUTE_HIDDEN)) {
-							std::map<uint8_t, chunk_data>::iterator face_iter;
-
-							if(nomic::utility::block_decoration(type)) { // decoration
-								face_iter = add_face_type(type, BLOCK_FACE_RIGHT, attributes); // right-to-left
-								add_face_decoration(position + position_relative, BLOCK_FACE_RIGHT, attributes,
-									face_iter);
-								++count;
-								face_iter = add_face_type(type, BLOCK_FACE_LEFT, attributes); // left-to-right
-								add_face_decoration(position + position_relative, BLOCK_FACE_LEFT, attributes,
-									face_iter);
-								++count;
-							} else {
-								bool small = nomic::utility::block_small(type);
-
-								if((type == BLOCK_CLOUD) || (type == BLOCK_WATER)) { // cloud/water
-
-									if(right) {
-
-										if((x + 1) < CHUNK_WIDTH) { // right
-
-											if(nomic::terrain::chunk::type(glm::uvec3(x + 1, y, z))
-													== BLOCK_AIR) {
-												face_iter = add_face_type(type, BLOCK_FACE_RIGHT,
-													attributes);
-
-												if(small) {
-													add_face_small(position + position_relative,
-														BLOCK_FACE_RIGHT, attributes,
-														face_iter);
-												} else {
-													add_face(position + position_relative,
-														BLOCK_FACE_RIGHT, attributes,
-														face_iter);
-												}
-
-												++count;
-											}
-										} else if((x + 1) == CHUNK_WIDTH) { // right (boundary)
-
-											if(right->block_type(glm::uvec3(0, y, z)) == BLOCK_AIR) {
-												face_iter = add_face_type(type, BLOCK_FACE_RIGHT,
-													attributes);
-
-												if(small) {
-													add_face_small(position + position_relative,
-														BLOCK_FACE_RIGHT, attributes,
-														face_iter);
-												} else {
-													add_face(position + position_relative,
-														BLOCK_FACE_RIGHT, attributes,
-														face_iter);
-												}
-
-												++count;
-											}
-										}
-									}
+					if((x >= 0) && (x < CHUNK_WIDTH) && (z >= 0) && (z < CHUNK_WIDTH)) {
+						continue;
+					}
 
-									if(left) {
-
-										if((x - 1) >= 0) { // left
-
-											if(nomic::terrain::chunk::type(glm::uvec3(x - 1, y, z))
-													== BLOCK_AIR) {
-												face_iter = add_face_type(type, BLOCK_FACE_LEFT,
-													attributes);
-
-												if(small) {
-													add_face_small(position + position_relative,
-														BLOCK_FACE_LEFT, attributes,
-														face_iter);
-												} else {
-													add_face(position + position_relative,
-														BLOCK_FACE_LEFT, attributes,
-														face_iter);
-												}
-
-												++count;
-											}
-										} else if((x - 1) < 0) { // left (boundary)
-
-											if(left->block_type(glm::uvec3(CHUNK_WIDTH - 1, y, z))
-													== BLOCK_AIR) {
-												face_iter = add_face_type(type, BLOCK_FACE_LEFT,
-													attributes);
-
-												if(small) {
-													add_face_small(position + position_relative,
-														BLOCK_FACE_LEFT, attributes,
-														face_iter);
-												} else {
-													add_face(position + position_relative,
-														BLOCK_FACE_LEFT, attributes,
-														face_iter);
-												}
-
-												++count;
-											}
-										}
-									}
+					chunk = adjacent(position);
+					if(!chunk) {
+						continue;
+					}
 
-									if(back) {
-
-										if((z + 1) < CHUNK_WIDTH) { // back
-
-											if(nomic::terrain::chunk::type(glm::uvec3(x, y, z + 1))
-													== BLOCK_AIR) {
-												face_iter = add_face_type(type, BLOCK_FACE_BACK,
-													attributes);
-
-												if(small) {
-													add_face_small(position + position_relative,
-														BLOCK_FACE_BACK, attributes,
-														face_iter);
-												} else {
-													add_face(position + position_relative,
-														BLOCK_FACE_BACK, attributes,
-														face_iter);
-												}
-
-												++count;
-											}
-										} else if((z + 1) == CHUNK_WIDTH) { // back (boundary)
-
-											if(back->block_type(glm::uvec3(x, y, 0)) == BLOCK_AIR) {
-												face_iter = add_face_type(type, BLOCK_FACE_BACK,
-													attributes);
-
-												if(small) {
-													add_face_small(position + position_relative,
-														BLOCK_FACE_BACK, attributes,
-														face_iter);
-												} else {
-													add_face(position + position_relative,
-														BLOCK_FACE_BACK, attributes,
-														face_iter);
-												}
-
-												++count;
-											}
-										}
-									}
+					for(uint32_t y = 0; y < CHUNK_HEIGHT; ++y) {
+						block[CHUNK_SNAPSHOT_INDEX(x, y, z)] = chunk->m_block[position.x][y][position.z];
+						light[CHUNK_SNAPSHOT_INDEX(x, y, z)] = chunk->m_light[position.x][y][position.z];
+					}
 
-									if(front) {
-
-										if((z - 1) >= 0) { // front
-
-											if(nomic::terrain::chunk::type(glm::uvec3(x, y, z - 1))
-													== BLOCK_AIR) {
-												face_iter = add_face_type(type, BLOCK_FACE_FRONT,
-													attributes);
-
-												if(small) {
-													add_face_small(position + position_relative,
-														BLOCK_FACE_FRONT, attributes,
-														face_iter);
-												} else {
-													add_face(position + position_relative,
-														BLOCK_FACE_FRONT, attributes,
-														face_iter);
-												}
-
-												++count;
-											}
-										} else if((z - 1) < 0) { // front (boundary)
-
-											if(front->block_type(glm::uvec3(x, y, CHUNK_WIDTH - 1))
-													== BLOCK_AIR) {
-												face_iter = add_face_type(type, BLOCK_FACE_FRONT,
-													attributes);
-
-												if(small) {
-													add_face_small(position + position_relative,
-														BLOCK_FACE_FRONT, attributes,
-														face_iter);
-												} else {
-													add_face(position + position_relative,
-														BLOCK_FACE_FRONT, attributes,
-														face_iter);
-												}
-
-												++count;
-											}
-										}
-									}
-								} else { // other
-
-									if(right) {
-
-										if((x + 1) < CHUNK_WIDTH) { // right
-
-											if(nomic::utility::block_transparent(
-													nomic::terrain::chunk::type(
-													glm::uvec3(x + 1, y, z)))) {
-												face_iter = add_face_type(type, BLOCK_FACE_RIGHT,
-													attributes);
-
-												if(small) {
-													add_face_small(position + position_relative,
-														BLOCK_FACE_RIGHT, attributes,
-														face_iter);
-												} else {
-													add_face(position + position_relative,
-														BLOCK_FACE_RIGHT, attributes,
-														face_iter);
-												}
-
-												++count;
-											}
-										} else if((x + 1) == CHUNK_WIDTH) { // right (boundary)
-
-											if(nomic::utility::block_transparent(right->block_type(
-													glm::uvec3(0, y, z)))) {
-												face_iter = add_face_type(type, BLOCK_FACE_RIGHT,
-													attributes);
-
-												if(small) {
-													add_face_small(position + position_relative,
-														BLOCK_FACE_RIGHT, attributes,
-														face_iter);
-												} else {
-													add_face(position + position_relative,
-														BLOCK_FACE_RIGHT, attributes,
-														face_iter);
-												}
-
-												++count;
-											}
-										}
-									}
+					for(uint32_t type = 0; type < CHUNK_MASK_COUNT; ++type) {
+						memcpy(&mask[CHUNK_SNAPSHOT_MASK_INDEX(type, x, z)], chunk->m_mask[type][position.x][position.z],
+							CHUNK_MASK_WORD_COUNT * sizeof(uint64_t));
+					}
+				}
+			}
 
-									if(left) {
-
-										if((x - 1) >= 0) { // left
-
-											if(nomic::utility::block_transparent(
-													nomic::terrain::chunk::type(
-													glm::uvec3(x - 1, y, z)))) {
-												face_iter = add_face_type(type, BLOCK_FACE_LEFT,
-													attributes);
-
-												if(small) {
-													add_face_small(position + position_relative,
-														BLOCK_FACE_LEFT, attributes,
-														face_iter);
-												} else {
-													add_face(position + position_relative,
-														BLOCK_FACE_LEFT, attributes,
-														face_iter);
-												}
-
-												++count;
-											}
-										} else if((x - 1) < 0) { // left (boundary)
-
-											if(nomic::utility::block_transparent(left->block_type(
-													glm::uvec3(CHUNK_WIDTH - 1, y, z)))) {
-												face_iter = add_face_type(type, BLOCK_FACE_LEFT,
-													attributes);
-
-												if(small) {
-													add_face_small(position + position_relative,
-														BLOCK_FACE_LEFT, attributes,
-														face_iter);
-												} else {
-													add_face(position + position_relative,
-														BLOCK_FACE_LEFT, attributes,
-														face_iter);
-												}
-
-												++count;
-											}
-										}
-									}
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
 
-									if(back) {
-
-										if((z + 1) < CHUNK_WIDTH) { // back
-
-											if(nomic::utility::block_transparent(
-													nomic::terrain::chunk::type(glm::uvec3(
-													x, y, z + 1)))) {
-												face_iter = add_face_type(type, BLOCK_FACE_BACK,
-													attributes);
-
-												if(small) {
-													add_face_small(position + position_relative,
-														BLOCK_FACE_BACK, attributes,
-														face_iter);
-												} else {
-													add_face(position + position_relative,
-														BLOCK_FACE_BACK, attributes,
-														face_iter);
-												}
-
-												++count;
-											}
-										} else if((z + 1) == CHUNK_WIDTH) { // back (boundary)
-
-											if(nomic::utility::block_transparent(back->block_type(
-													glm::uvec3(x, y, 0)))) {
-												face_iter = add_face_type(type, BLOCK_FACE_BACK,
-													attributes);
-
-												if(small) {
-													add_face_small(position + position_relative,
-														BLOCK_FACE_BACK, attributes,
-														face_iter);
-												} else {
-													add_face(position + position_relative,
-														BLOCK_FACE_BACK, attributes,
-														face_iter);
-												}
-
-												++count;
-											}
-										}
-									}
+		bool 
+		chunk::building(
+			__in nomic::job::manager &instance
+			) const
+		{
+			bool result;
 
-									if(front) {
-
-										if((z - 1) >= 0) { // front
-
-											if(nomic::utility::block_transparent(
-													nomic::terrain::chunk::type(
-													glm::uvec3(x, y, z - 1)))) {
-												face_iter = add_face_type(type, BLOCK_FACE_FRONT,
-													attributes);
-
-												if(small) {
-													add_face_small(position + position_relative,
-														BLOCK_FACE_FRONT, attributes,
-														face_iter);
-												} else {
-													add_face(position + position_relative,
-														BLOCK_FACE_FRONT, attributes,
-														face_iter);
-												}
-
-												++count;
-											}
-										} else if((z - 1) < 0) { // front (boundary)
-
-											if(nomic::utility::block_transparent(front->block_type(
-													glm::uvec3(x, y, CHUNK_WIDTH - 1)))) {
-												face_iter = add_face_type(type, BLOCK_FACE_FRONT,
-													attributes);
-
-												if(small) {
-													add_face_small(position + position_relative,
-														BLOCK_FACE_FRONT, attributes,
-														face_iter);
-												} else {
-													add_face(position + position_relative,
-														BLOCK_FACE_FRONT, attributes,
-														face_iter);
-												}
-
-												++count;
-											}
-										}
-									}
-								}
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Instance=%p", &instance);
 
-								if((y - 1) >= 0) { // bottom
+			result = ((m_job != JOB_INVALID) && !instance.complete(m_job));
 
-									if(nomic::utility::block_transparent(nomic::terrain::chunk::type(
-											glm::uvec3(x, y - 1, z)))) {
-										face_iter = add_face_type(type, BLOCK_FACE_BOTTOM, attributes);
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
+			return result;
+		}
 
-										if(small) {
-											add_face_small(position + position_relative, BLOCK_FACE_BOTTOM,
-												attributes, face_iter);
-										} else {
-											add_face(position + position_relative, BLOCK_FACE_BOTTOM,
-												attributes, face_iter);
-										}
+		std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>> 
+		chunk::edits(void) const
+		{
+			std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>> result;
 
-										++count;
-									}
-								}
+			TRACE_ENTRY(LEVEL_VERBOSE);
 
-								if((type != BLOCK_CLOUD) && ((y + 1) < CHUNK_HEIGHT)) { // top
+			if(!m_edited.empty()) {
 
-									if(nomic::utility::block_transparent(nomic::terrain::chunk::type(
-											glm::uvec3(x, y + 1, z)))) {
-										face_iter = add_face_type(type, BLOCK_FACE_TOP, attributes);
+				for(uint32_t x = 0; x < CHUNK_WIDTH; ++x) {
 
-										if(small) {
-											add_face_small(position + position_relative, BLOCK_FACE_TOP,
-												attributes, face_iter);
-										} else {
-											add_face(position + position_relative, BLOCK_FACE_TOP,
-												attributes, face_iter);
-										}
+					for(uint32_t y = 0; y < CHUNK_HEIGHT; ++y) {
 
-										++count;
-									}
-								}
-							}
+						for(uint32_t z = 0; z < CHUNK_WIDTH; ++z) {
 
-							if(!count) {
-								continue;
+							if(m_edited[CHUNK_BLOCK_INDEX(x, y, z)]) { // report what the cell holds now
+								glm::uvec3 position(x, y, z);
+
+								result.push_back(std::make_tuple(position, nomic::terrain::chunk::type(position),
+									nomic::terrain::chunk::attributes(position)));
 							}
 						}
 					}
 				}
 			}
 
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result[%u]", result.size());
+			return result;
+		}
+
+		bool 
+		chunk::face_occlusion(
+			__in const glm::vec3 &block,
+			__in uint32_t face,
+			__inout float *occlusion
+			)
+		{
+			bool result;
+			uint32_t level[BLOCK_FACE_COUNT];
+			const uint8_t *neighborhood = &chunk_scratch_occlusion[CHUNK_OCCLUSION_INDEX((int32_t) block.x, (int32_t) block.y,
+				(int32_t) block.z)];
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Block={%f, %f, %f}, Face=%x, Occlusion=%p", block.x, block.y, block.z, face, occlusion);
+
+			for(uint32_t iter = 0; iter < BLOCK_FACE_COUNT; ++iter) {
+				const int32_t *offset = CHUNK_OCCLUSION[(face * BLOCK_FACE_COUNT) + iter];
+				uint32_t corner = neighborhood[offset[OCCLUSION_CORNER]], side = neighborhood[offset[OCCLUSION_SIDE]],
+					side_other = neighborhood[offset[OCCLUSION_SIDE_OTHER]];
+
+				level[iter] = (CHUNK_OCCLUSION_LEVEL_MAX - (side + side_other + (corner | (side & side_other))));
+				occlusion[iter] = (level[iter] / (float) CHUNK_OCCLUSION_LEVEL_MAX);
+			}
+
+			result = ((level[CHUNK_QUAD_DIAGONAL[face][QUAD_DIAGONAL]] + level[CHUNK_QUAD_DIAGONAL[face][QUAD_DIAGONAL_OTHER]])
+				> (level[CHUNK_QUAD_DIAGONAL[face][QUAD_OPPOSITE]] + level[CHUNK_QUAD_DIAGONAL[face][QUAD_OPPOSITE_OTHER]]));
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
+			return result;
+		}
+
+		glm::vec2 
+		chunk::light_adjacent(
+			__in const glm::ivec3 &position
+			) const
+		{
+			glm::vec2 result;
+			uint8_t light = LIGHT_SKY_DEFAULT;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%i, %i, %i}", position.x, position.y, position.z);
+
+			if(position.y < 0) {
+				light = LIGHT_PACK(LIGHT_LEVEL_MIN, LIGHT_LEVEL_MIN);
+			} else if(position.y < CHUNK_HEIGHT) {
+				light = std::get<nomic::terrain::SNAPSHOT_LIGHT>(m_snapshot)[CHUNK_SNAPSHOT_INDEX(position.x, position.y, position.z)];
+			}
+
+			result = (glm::vec2(LIGHT_SKY(light), LIGHT_BLOCK(light)) / (float) LIGHT_LEVEL_MAX);
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result={%f, %f}", result.x, result.y);
+			return result;
+		}
+
+		void 
+		chunk::on_queue(
+			__in nomic::core::renderer &renderer,
+			__in const glm::vec3 &position,
+			__inout std::vector<nomic::core::entity_layer> &layer
+			)
+		{
+			float depth;
+			glm::vec2 center;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Renderer=%p, Position={%f, %f, %f}, Layer[%u]=%p", &renderer, position.x, position.y,
+				position.z, layer.size(), &layer);
+
+			center.x = ((nomic::terrain::chunk::position().x * (CHUNK_WIDTH - 1)) + (CHUNK_WIDTH / 2.f));
+			center.y = ((nomic::terrain::chunk::position().y * (CHUNK_WIDTH - 1)) + (CHUNK_WIDTH / 2.f));
+			depth = glm::distance(center, glm::vec2(position.x, position.z));
+
+			for(std::map<uint8_t, chunk_range>::iterator iter = m_face.begin(); iter != m_face.end(); ++iter) {
+				layer.push_back(std::make_tuple(nomic::utility::block_transparent(iter->first) ? RENDER_PASS_TRANSPARENT :
+					RENDER_PASS_OPAQUE, iter->first, depth));
+			}
+
+			if(m_decoration_array && (depth <= CHUNK_DECORATION_DISTANCE)) {
+
+				for(std::map<uint8_t, chunk_range>::iterator iter = m_decoration.begin(); iter != m_decoration.end(); ++iter) {
+					layer.push_back(std::make_tuple(RENDER_PASS_DECORATION, iter->first, depth));
+				}
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		chunk::on_render_layer(
+			__in nomic::core::renderer &renderer,
+			__in void *textures,
+			__in float delta,
+			__in uint32_t pass,
+			__in uint8_t texture
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Renderer=%p, Textures=%p, Delta=%f, Pass=%x(%s), Texture=%x", &renderer, textures, delta,
+				pass, RENDER_PASS_STRING(pass), texture);
+
+			if(pass == RENDER_PASS_DECORATION) {
+
+				std::map<uint8_t, chunk_range>::iterator iter = m_decoration.find(texture);
+				if(m_decoration_array && (iter != m_decoration.end())) {
+					m_decoration_array->set_pointer(CHUNK_INDEX_INSTANCE, CHUNK_SEGMENT_WIDTH_INSTANCE, GL_FLOAT, GL_FALSE, 0,
+						(GLvoid *) (std::get<RANGE_BASE>(iter->second) * CHUNK_SEGMENT_WIDTH_INSTANCE * sizeof(GLfloat)));
+					m_decoration_array->set_pointer(CHUNK_INDEX_LIGHT, CHUNK_SEGMENT_WIDTH_LIGHT, GL_FLOAT, GL_FALSE, 0,
+						(GLvoid *) (std::get<RANGE_BASE>(iter->second) * CHUNK_SEGMENT_WIDTH_LIGHT * sizeof(GLfloat)));
+					GL_CHECK(LEVEL_WARNING, glDrawArraysInstanced, GL_TRIANGLES, 0, CHUNK_SEGMENT_COUNT_DECORATION,
+						std::get<RANGE_OFFSET>(iter->second));
+				}
+			} else {
+
+				std::map<uint8_t, chunk_range>::iterator iter = m_face.find(texture);
+				if(iter != m_face.end()) {
+					nomic::graphic::vao &arr = vertex_array();
+					arr.bind();
+					GL_CHECK(LEVEL_WARNING, glDrawArrays, GL_TRIANGLES, std::get<RANGE_BASE>(iter->second),
+						std::get<RANGE_OFFSET>(iter->second));
+				}
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		chunk::on_update(
+			__in void *runtime,
+			__in void *camera
+			)
+		{
+			bool shown = true;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Runtime=%p, Camera=%p", runtime, camera);
+
+			nomic::terrain::chunk::update();
+
+			if(m_changed) {
+
+				nomic::job::manager &instance = nomic::job::manager::acquire();
+				if(instance.initialized()) {
+
+					// one build per neighborhood at a time, so each snapshot sees settled border light
+					if(!building(instance) && !(m_chunk_right && m_chunk_right->building(instance))
+							&& !(m_chunk_left && m_chunk_left->building(instance))
+							&& !(m_chunk_back && m_chunk_back->building(instance))
+							&& !(m_chunk_front && m_chunk_front->building(instance))) {
+						uint32_t priority = (m_mesh_retain ? JOB_PRIORITY_HIGH : JOB_PRIORITY_NORMAL);
+
+						m_changed = false;
+						build_snapshot();
+						m_job = instance.add(std::bind(&chunk::upload, this), priority, JOB_AFFINITY_MAIN,
+							std::vector<uint32_t>(1, instance.add(std::bind(&chunk::build, this), priority)));
+					}
+				} else {
+					m_changed = false;
+					build_snapshot();
+					build();
+					upload();
+				}
+
+				instance.release();
+			}
+
+#ifdef VIEW_SELECTIVE_SHOW
+			glm::vec3 camera_position = ((nomic::entity::camera *) camera)->position();
+			glm::ivec2 camera_position_chunk = glm::ivec2(camera_position.x / CHUNK_WIDTH, camera_position.z / CHUNK_WIDTH);
+			glm::ivec2 position_chunk = nomic::entity::chunk::position();
+			int32_t dx = (position_chunk.x - camera_position_chunk.x), dz = (position_chunk.y - camera_position_chunk.y),
+				radius = ((nomic::entity::camera *) camera)->view_radius();
+			shown = ((std::abs(dx * dx) + std::abs(dz * dz)) <= (radius * radius));
+#endif // VIEW_SELECTIVE_SHOW
+			show(shown);
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>> 
+		chunk::pending(void)
+		{
+			std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>> result;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			result = nomic::terrain::chunk::pending();
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result.size());
+			return result;
+		}
+
+		glm::ivec2 
+		chunk::position(void) const
+		{
+			glm::ivec2 result;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			result = nomic::terrain::chunk::position();
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Position={%i, %i}", result.x, result.y);
+			return result;
+		}
+
+		void 
+		chunk::rebuild(
+			__in_opt nomic::entity::chunk *right,
+			__in_opt nomic::entity::chunk *left,
+			__in_opt nomic::entity::chunk *back,
+			__in_opt nomic::entity::chunk *front
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Edge={%p, %p, %p, %p}", right, left, back, front);
+
+			synchronize();
+			m_chunk_back = back;
+			m_chunk_front = front;
+			m_chunk_left = left;
+			m_chunk_right = right;
+			build_snapshot();
+			build();
+			upload();
+
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
@@ -1349,11 +1380,15 @@ namespace nomic {
 
 				if(!nomic::utility::block_selectable(result)) {
 					result = nomic::terrain::chunk::set_block(position, type, attributes);
+					set_edited(position);
 					m_changed = true;
+					m_mesh_retain = (m_mesh_retain || m_mesh_capacity);
 				}
 			} else {
 				result = nomic::terrain::chunk::set_block(position, type, attributes);
+				set_edited(position);
 				m_changed = true;
+				m_mesh_retain = (m_mesh_retain || m_mesh_capacity);
 			}
 
 			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x(%u)", (uint16_t) result, (uint16_t) result);
@@ -1423,16 +1458,94 @@ namespace nomic {
 			return result;
 		}
 
+		void 
+		chunk::set_blocks(
+			__in const std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>> &blocks,
+			__in_opt bool edit
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Blocks[%u]=%p, Edit=%x", blocks.size(), &blocks, edit);
+
+			if(!blocks.empty()) {
+				nomic::terrain::chunk::set_blocks(blocks);
+
+				if(edit) {
+
+					for(std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>::const_iterator iter = blocks.begin();
+							iter != blocks.end(); ++iter) {
+						set_edited(std::get<BLOCK_POSITION>(*iter));
+					}
+				}
+
+				m_changed = true;
+				m_mesh_retain = (m_mesh_retain || m_mesh_capacity);
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		chunk::set_edited(
+			__in const glm::uvec3 &position
+			)
+		{
+			uint32_t index;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%u, %u, %u}", position.x, position.y, position.z);
+
+			index = CHUNK_BLOCK_INDEX(position.x, position.y, position.z);
+			if(index < CHUNK_BLOCK_COUNT) {
+
+				if(m_edited.empty()) { // most chunks are never edited
+					m_edited.resize(CHUNK_BLOCK_COUNT, false);
+				}
+
+				m_edited[index] = true;
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		chunk::synchronize(void)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			if(m_job != JOB_INVALID) {
+
+				nomic::job::manager &instance = nomic::job::manager::acquire();
+				if(instance.initialized()) {
+					instance.wait(m_job);
+				}
+
+				instance.release();
+				m_job = JOB_INVALID;
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
 		void 
 		chunk::teardown(void)
 		{
 			TRACE_ENTRY(LEVEL_VERBOSE);
 
+			synchronize();
 			m_chunk_back = nullptr;
 			m_chunk_front = nullptr;
 			m_chunk_left = nullptr;
 			m_chunk_right = nullptr;
+			m_decoration.clear();
+			m_decoration_build.clear();
+			m_edited.clear();
 			m_face.clear();
+			m_face_build.clear();
+			m_face_column.clear();
+			m_face_column_build.clear();
+			chunk_mesh().swap(m_mesh);
+			m_mesh_capacity = 0;
+			m_mesh_dirty.clear();
+			m_mesh_retain = false;
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
@@ -1452,7 +1565,10 @@ namespace nomic {
 				result << " Base=" << nomic::entity::object::to_string(verbose)
 					<< ", Chunk=" << nomic::terrain::chunk::to_string(verbose)
 					<< ", Face[" << m_face.size() << "]"
-					<< ", State=" << (m_changed ? "Changed" : "Unchanged");
+					<< ", Decoration[" << m_decoration.size() << "]"
+					<< ", Mesh=" << m_mesh_capacity << (m_mesh_retain ? " (Retained)" : "")
+					<< ", State=" << (m_changed ? "Changed" : "Unchanged")
+					<< ", Job=" << SCALAR_AS_HEX(uint32_t, m_job);
 			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
@@ -1464,7 +1580,10 @@ namespace nomic {
 		{
 			TRACE_ENTRY(LEVEL_VERBOSE);
 
+			// a neighbor's border changed; light it fed us may have dimmed, which only a full pass can undo
+			m_light_valid = false;
 			m_changed = true;
+			update_edge();
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
@@ -1484,6 +1603,201 @@ namespace nomic {
 			m_chunk_left = left;
 			m_chunk_right = right;
 			m_changed = true;
+			update_edge();
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		chunk::update_edge(void)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			// neighbors reach only the border columns, through the snapshot ring
+			for(uint32_t iter = 0; iter < CHUNK_WIDTH; ++iter) {
+				m_column_changed.set(CHUNK_COLUMN_INDEX(iter, 0));
+				m_column_changed.set(CHUNK_COLUMN_INDEX(iter, CHUNK_WIDTH - 1));
+				m_column_changed.set(CHUNK_COLUMN_INDEX(0, iter));
+				m_column_changed.set(CHUNK_COLUMN_INDEX(CHUNK_WIDTH - 1, iter));
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		chunk::upload(void)
+		{
+			uint32_t count, edge;
+			nomic::terrain::chunk_column column;
+			const std::vector<glm::vec2> &coordinate = std::get<MESH_COORDINATE>(m_mesh);
+			const std::vector<glm::vec4> &instance = std::get<MESH_INSTANCE>(m_mesh);
+			const std::vector<glm::vec3> &instance_light = std::get<MESH_INSTANCE_LIGHT>(m_mesh),
+				&light = std::get<MESH_LIGHT>(m_mesh), &normal = std::get<MESH_NORMAL>(m_mesh),
+				&vertex = std::get<MESH_VERTEX>(m_mesh);
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			edge = nomic::terrain::chunk::snapshot_commit(column);
+			if((edge & (1 << BLOCK_FACE_RIGHT)) && m_chunk_right) { // neighbors mesh their faces with our border light
+				m_chunk_right->update();
+			}
+
+			if((edge & (1 << BLOCK_FACE_LEFT)) && m_chunk_left) {
+				m_chunk_left->update();
+			}
+
+			if((edge & (1 << BLOCK_FACE_BACK)) && m_chunk_back) {
+				m_chunk_back->update();
+			}
+
+			if((edge & (1 << BLOCK_FACE_FRONT)) && m_chunk_front) {
+				m_chunk_front->update();
+			}
+
+			build_mesh_dirty(column);
+			m_face.swap(m_face_build);
+			m_face_build.clear();
+
+			if(m_mesh_retain) { // only edited chunks keep the column offsets for the next patch
+				m_face_column.swap(m_face_column_build);
+			} else {
+				m_face_column.clear();
+			}
+
+			m_face_column_build.clear();
+			count = vertex.size();
+
+			nomic::graphic::vao &arr = vertex_array();
+			if(m_mesh_retain && m_mesh_capacity && (count <= m_mesh_capacity)) { // patch dirty ranges in place
+
+				if(!m_mesh_dirty.empty()) {
+					arr.bind();
+				}
+
+				for(std::vector<chunk_range>::iterator iter = m_mesh_dirty.begin(); iter != m_mesh_dirty.end(); ++iter) {
+					uint32_t base = std::get<RANGE_BASE>(*iter), offset = std::get<RANGE_OFFSET>(*iter);
+
+					arr.set_subdata(CHUNK_INDEX_COORDINATE, base * CHUNK_SEGMENT_WIDTH_COORDINATE * sizeof(GLfloat),
+						offset * CHUNK_SEGMENT_WIDTH_COORDINATE * sizeof(GLfloat), &coordinate[base]);
+					arr.set_subdata(CHUNK_INDEX_NORMAL, base * CHUNK_SEGMENT_WIDTH_NORMAL * sizeof(GLfloat),
+						offset * CHUNK_SEGMENT_WIDTH_NORMAL * sizeof(GLfloat), &normal[base]);
+					arr.set_subdata(CHUNK_INDEX_VERTEX, base * CHUNK_SEGMENT_WIDTH_VERTEX * sizeof(GLfloat),
+						offset * CHUNK_SEGMENT_WIDTH_VERTEX * sizeof(GLfloat), &vertex[base]);
+					arr.set_subdata(CHUNK_INDEX_LIGHT, base * CHUNK_SEGMENT_WIDTH_LIGHT * sizeof(GLfloat),
+						offset * CHUNK_SEGMENT_WIDTH_LIGHT * sizeof(GLfloat), &light[base]);
+				}
+			} else {
+				m_mesh_capacity = (m_mesh_retain ? CHUNK_MESH_HEADROOM(count) : count);
+				arr.disable_all();
+				arr.remove_all();
+				arr.clear();
+				arr.bind();
+				upload_buffer(arr, CHUNK_INDEX_COORDINATE, CHUNK_SEGMENT_WIDTH_COORDINATE, coordinate.data(), count,
+					m_mesh_capacity);
+				upload_buffer(arr, CHUNK_INDEX_NORMAL, CHUNK_SEGMENT_WIDTH_NORMAL, normal.data(), count, m_mesh_capacity);
+				upload_buffer(arr, CHUNK_INDEX_VERTEX, CHUNK_SEGMENT_WIDTH_VERTEX, vertex.data(), count, m_mesh_capacity);
+				upload_buffer(arr, CHUNK_INDEX_LIGHT, CHUNK_SEGMENT_WIDTH_LIGHT, light.data(), count, m_mesh_capacity);
+				arr.enable(CHUNK_INDEX_COORDINATE);
+				arr.enable(CHUNK_INDEX_NORMAL);
+				arr.enable(CHUNK_INDEX_VERTEX);
+				arr.enable(CHUNK_INDEX_LIGHT);
+			}
+
+			m_decoration.swap(m_decoration_build);
+			m_decoration_build.clear();
+
+			if(!instance.empty()) {
+
+				if(chunk_decoration_shared.empty()) {
+					std::vector<glm::vec2> decoration_coordinate;
+					std::vector<glm::vec3> decoration_normal, decoration_vertex;
+
+					for(uint32_t face = BLOCK_FACE_RIGHT; face <= BLOCK_FACE_LEFT; ++face) {
+
+						for(uint32_t iter = 0; iter < BLOCK_FACE_COUNT; ++iter) {
+							decoration_coordinate.push_back(CHUNK_COORDINATE[(face * BLOCK_FACE_COUNT) + iter]);
+							decoration_normal.push_back(CHUNK_NORMAL_DECORATION[face]);
+							decoration_vertex.push_back(CHUNK_VERTEX_DECORATION[(face * BLOCK_FACE_COUNT) + iter]);
+						}
+					}
+
+					chunk_decoration_shared.insert(std::make_pair(CHUNK_INDEX_COORDINATE, nomic::graphic::vbo(GL_ARRAY_BUFFER,
+						decoration_coordinate.data(), CHUNK_SEGMENT_COUNT_DECORATION * CHUNK_SEGMENT_WIDTH_COORDINATE * sizeof(GLfloat),
+						GL_STATIC_DRAW)));
+					chunk_decoration_shared.insert(std::make_pair(CHUNK_INDEX_NORMAL, nomic::graphic::vbo(GL_ARRAY_BUFFER,
+						decoration_normal.data(), CHUNK_SEGMENT_COUNT_DECORATION * CHUNK_SEGMENT_WIDTH_NORMAL * sizeof(GLfloat),
+						GL_STATIC_DRAW)));
+					chunk_decoration_shared.insert(std::make_pair(CHUNK_INDEX_VERTEX, nomic::graphic::vbo(GL_ARRAY_BUFFER,
+						decoration_vertex.data(), CHUNK_SEGMENT_COUNT_DECORATION * CHUNK_SEGMENT_WIDTH_VERTEX * sizeof(GLfloat),
+						GL_STATIC_DRAW)));
+				}
+
+				if(!m_decoration_array) {
+
+					m_decoration_array = new nomic::graphic::vao;
+					if(!m_decoration_array) {
+						THROW_NOMIC_ENTITY_CHUNK_EXCEPTION(NOMIC_ENTITY_CHUNK_EXCEPTION_ALLOCATE);
+					}
+
+					++chunk_decoration_count;
+					m_decoration_array->bind();
+					m_decoration_array->add(chunk_decoration_shared.at(CHUNK_INDEX_COORDINATE), CHUNK_INDEX_COORDINATE,
+						CHUNK_SEGMENT_WIDTH_COORDINATE, GL_FLOAT);
+					m_decoration_array->add(chunk_decoration_shared.at(CHUNK_INDEX_NORMAL), CHUNK_INDEX_NORMAL,
+						CHUNK_SEGMENT_WIDTH_NORMAL, GL_FLOAT);
+					m_decoration_array->add(chunk_decoration_shared.at(CHUNK_INDEX_VERTEX), CHUNK_INDEX_VERTEX,
+						CHUNK_SEGMENT_WIDTH_VERTEX, GL_FLOAT);
+				}
+
+				m_decoration_array->bind();
+
+				if(m_decoration_array->contains(CHUNK_INDEX_INSTANCE)) {
+					m_decoration_array->disable(CHUNK_INDEX_INSTANCE);
+					m_decoration_array->remove(CHUNK_INDEX_INSTANCE);
+				}
+
+				if(m_decoration_array->contains(CHUNK_INDEX_LIGHT)) {
+					m_decoration_array->disable(CHUNK_INDEX_LIGHT);
+					m_decoration_array->remove(CHUNK_INDEX_LIGHT);
+				}
+
+				m_decoration_array->add(nomic::graphic::vbo(GL_ARRAY_BUFFER, instance.data(),
+					instance.size() * CHUNK_SEGMENT_WIDTH_INSTANCE * sizeof(GLfloat), GL_STATIC_DRAW),
+					CHUNK_INDEX_INSTANCE, CHUNK_SEGMENT_WIDTH_INSTANCE, GL_FLOAT);
+				m_decoration_array->add(nomic::graphic::vbo(GL_ARRAY_BUFFER, instance_light.data(),
+					instance_light.size() * CHUNK_SEGMENT_WIDTH_LIGHT * sizeof(GLfloat), GL_STATIC_DRAW),
+					CHUNK_INDEX_LIGHT, CHUNK_SEGMENT_WIDTH_LIGHT, GL_FLOAT);
+				m_decoration_array->set_divisor(CHUNK_INDEX_INSTANCE, 1);
+				m_decoration_array->set_divisor(CHUNK_INDEX_LIGHT, 1);
+				m_decoration_array->enable_all();
+			}
+
+			chunk_mesh().swap(m_mesh);
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Vertex[%u], Capacity=%u, Dirty[%u]", count, m_mesh_capacity, m_mesh_dirty.size());
+		}
+
+		void 
+		chunk::upload_buffer(
+			__in nomic::graphic::vao &arr,
+			__in GLuint index,
+			__in GLint width,
+			__in const GLvoid *data,
+			__in uint32_t count,
+			__in uint32_t capacity
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Array=%p, Index=%x, Width=%i, Data[%u]=%p, Capacity=%u", &arr, index, width, count,
+				data, capacity);
+
+			if(capacity > count) { // leave headroom for later in-place edits
+				arr.add(nomic::graphic::vbo(GL_ARRAY_BUFFER, capacity * width * sizeof(GLfloat), GL_DYNAMIC_DRAW), index, width,
+					GL_FLOAT);
+				arr.set_subdata(index, 0, count * width * sizeof(GLfloat), data);
+			} else {
+				arr.add(nomic::graphic::vbo(GL_ARRAY_BUFFER, data, count * width * sizeof(GLfloat), GL_STATIC_DRAW), index, width,
+					GL_FLOAT);
+			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
@@ -33,14 +33,14 @@ namespace nomic {
 #endif // NDEBUG
 
 		enum {
-			NOMIC_ENTITY_CHUNK_EXCEPTION_FACE_INVALID = 0,
+			NOMIC_ENTITY_CHUNK_EXCEPTION_ALLOCATE = 0,
 			NOMIC_ENTITY_CHUNK_EXCEPTION_TYPE_INVALID,
 		};
 
 		#define NOMIC_ENTITY_CHUNK_EXCEPTION_MAX NOMIC_ENTITY_CHUNK_EXCEPTION_TYPE_INVALID
 
 		static const std::string NOMIC_ENTITY_CHUNK_EXCEPTION_STR[] = {
-			NOMIC_ENTITY_CHUNK_EXCEPTION_HEADER "Invalid chunk block face",
+			NOMIC_ENTITY_CHUNK_EXCEPTION_HEADER "Failed to allocate chunk decoration vertex array",
 			NOMIC_ENTITY_CHUNK_EXCEPTION_HEADER "Invalid chunk block type",
 			};
 
@@ -0,0 +1,393 @@
+/**
+ * Nomic
+ * Copyright (C) 2017 David Jolly
+ *
+ * Nomic is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Nomic is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/entity/cloud.h"
+#include "../../include/entity/camera.h"
+#include "../../include/runtime.h"
+#include "../../include/trace.h"
+#include "./cloud_type.h"
+
+namespace nomic {
+
+	namespace entity {
+
+		#define CLOUD_SEGMENT_COUNT 36
+		#define CLOUD_SEGMENT_WIDTH_INSTANCE 4
+		#define CLOUD_SEGMENT_WIDTH_NORMAL 3
+		#define CLOUD_SEGMENT_WIDTH_SIDE 1
+		#define CLOUD_SEGMENT_WIDTH_VERTEX 3
+
+		enum {
+			CLOUD_INDEX_INSTANCE = 0,
+			CLOUD_INDEX_NORMAL,
+			CLOUD_INDEX_SIDE,
+			CLOUD_INDEX_VERTEX,
+		};
+
+		enum {
+			CLOUD_SIDE_RIGHT = 1,
+			CLOUD_SIDE_LEFT = 2,
+			CLOUD_SIDE_BACK = 4,
+			CLOUD_SIDE_FRONT = 8,
+		};
+
+		static const glm::vec3 CLOUD_NORMAL[] = {
+			{ 1.f, 0.f, 0.f, }, // right
+			{ -1.f, 0.f, 0.f, }, // left
+			{ 0.f, 1.f, 0.f, }, // top
+			{ 0.f, -1.f, 0.f, }, // bottom
+			{ 0.f, 0.f, 1.f, }, // back
+			{ 0.f, 0.f, -1.f, }, // front
+			};
+
+		static const glm::vec3 CLOUD_VERTEX[] = {
+			{ 1.f, 0.f, 1.f, }, { 1.f, 0.f, 0.f, }, { 1.f, 1.f, 0.f, }, // right
+			{ 1.f, 0.f, 1.f, }, { 1.f, 1.f, 0.f, }, { 1.f, 1.f, 1.f, },
+			{ 0.f, 0.f, 0.f, }, { 0.f, 0.f, 1.f, }, { 0.f, 1.f, 1.f, }, // left
+			{ 0.f, 0.f, 0.f, }, { 0.f, 1.f, 1.f, }, { 0.f, 1.f, 0.f, },
+			{ 0.f, 1.f, 1.f, }, { 1.f, 1.f, 1.f, }, { 1.f, 1.f, 0.f, }, // top
+			{ 0.f, 1.f, 1.f, }, { 1.f, 1.f, 0.f, }, { 0.f, 1.f, 0.f, },
+			{ 0.f, 0.f, 0.f, }, { 1.f, 0.f, 0.f, }, { 1.f, 0.f, 1.f, }, // bottom
+			{ 0.f, 0.f, 0.f, }, { 1.f, 0.f, 1.f, }, { 0.f, 0.f, 1.f, },
+			{ 0.f, 0.f, 1.f, }, { 1.f, 0.f, 1.f, }, { 1.f, 1.f, 1.f, }, // back
+			{ 0.f, 0.f, 1.f, }, { 1.f, 1.f, 1.f, }, { 0.f, 1.f, 1.f, },
+			{ 1.f, 0.f, 0.f, }, { 0.f, 0.f, 0.f, }, { 0.f, 1.f, 0.f, }, // front
+			{ 1.f, 0.f, 0.f, }, { 0.f, 1.f, 0.f, }, { 1.f, 1.f, 0.f, },
+			};
+
+		cloud::cloud(
+			__in_opt uint32_t seed,
+			__in_opt uint32_t octaves,
+			__in_opt double amplitude
+			) :
+				nomic::entity::object(ENTITY_CLOUD),
+				m_count(0),
+				m_dirty(true),
+				m_noise(seed + seed, octaves, amplitude)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Seed=%u(%x), Octaves=%u, Amplitude=%g", seed, seed, octaves, amplitude);
+
+			setup();
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		cloud::cloud(
+			__in const cloud &other
+			) :
+				nomic::entity::object(other),
+				m_count(other.m_count),
+				m_dirty(other.m_dirty),
+				m_field(other.m_field),
+				m_noise(other.m_noise)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		cloud::~cloud(void)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		cloud &
+		cloud::operator=(
+			__in const cloud &other
+			)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			if(this != &other) {
+				nomic::entity::object::operator=(other);
+				m_count = other.m_count;
+				m_dirty = other.m_dirty;
+				m_field = other.m_field;
+				m_noise = other.m_noise;
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%p", this);
+			return *this;
+		}
+
+		void 
+		cloud::build(
+			__in const glm::ivec2 &position
+			)
+		{
+			int32_t radius_inner = 0;
+			std::vector<GLfloat> side;
+			std::vector<glm::vec4> instance;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%i, %i}", position.x, position.y);
+
+			for(uint32_t lod = 0; lod < CLOUD_LOD_COUNT; ++lod) {
+				std::vector<bool> cell;
+				int32_t count, radius, width = (CLOUD_WIDTH << lod);
+
+				if(lod < (CLOUD_LOD_COUNT - 1)) {
+					radius = (CLOUD_LOD_RADIUS << lod);
+				} else {
+					radius = std::max(((CLOUD_RADIUS + width - 1) / width) * width, radius_inner + width);
+				}
+
+				count = ((radius * 2) / width);
+				cell.resize(count * count, false);
+
+				for(int32_t z = 0; z < count; ++z) {
+
+					for(int32_t x = 0; x < count; ++x) {
+						cell.at((z * count) + x) = sample(position.x + (x * width) - radius + (width / 2),
+							position.y + (z * width) - radius + (width / 2));
+					}
+				}
+
+				for(int32_t z = 0; (z < count) && (instance.size() < CLOUD_INSTANCE_MAX); ++z) {
+
+					for(int32_t x = 0; (x < count) && (instance.size() < CLOUD_INSTANCE_MAX); ++x) {
+						uint32_t mask = 0;
+						glm::ivec2 offset((x * width) - radius, (z * width) - radius);
+
+						if(!cell.at((z * count) + x)) {
+							continue;
+						}
+
+						if(lod && (offset.x >= -radius_inner) && (offset.x < radius_inner)
+								&& (offset.y >= -radius_inner) && (offset.y < radius_inner)) { // covered by finer lod
+							continue;
+						}
+
+						if((x == (count - 1)) || !cell.at((z * count) + x + 1)) {
+							mask |= CLOUD_SIDE_RIGHT;
+						}
+
+						if(!x || !cell.at((z * count) + x - 1)) {
+							mask |= CLOUD_SIDE_LEFT;
+						}
+
+						if((z == (count - 1)) || !cell.at(((z + 1) * count) + x)) {
+							mask |= CLOUD_SIDE_BACK;
+						}
+
+						if(!z || !cell.at(((z - 1) * count) + x)) {
+							mask |= CLOUD_SIDE_FRONT;
+						}
+
+						instance.push_back(glm::vec4(position.x + offset.x, CLOUD_HEIGHT, position.y + offset.y, width));
+						side.push_back(mask);
+					}
+				}
+
+				radius_inner = radius;
+			}
+
+			m_count = instance.size();
+			if(m_count) {
+				nomic::graphic::vao &arr = vertex_array();
+				arr.bind();
+				arr.set_subdata(CLOUD_INDEX_INSTANCE, 0, m_count * CLOUD_SEGMENT_WIDTH_INSTANCE * sizeof(GLfloat), &instance[0]);
+				arr.set_subdata(CLOUD_INDEX_SIDE, 0, m_count * CLOUD_SEGMENT_WIDTH_SIDE * sizeof(GLfloat), &side[0]);
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		bool 
+		cloud::contains(
+			__in const glm::vec3 &position
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%f, %f, %f}", position.x, position.y, position.z);
+
+			result = ((position.y >= CLOUD_HEIGHT) && (position.y < (CLOUD_HEIGHT + CLOUD_THICKNESS)));
+			if(result) {
+				result = sample((std::floor((position.x - m_position.x) / CLOUD_WIDTH) * CLOUD_WIDTH) + (CLOUD_WIDTH / 2),
+					(std::floor((position.z - m_position.z) / CLOUD_WIDTH) * CLOUD_WIDTH) + (CLOUD_WIDTH / 2));
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
+			return result;
+		}
+
+		uint32_t 
+		cloud::count(void) const
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", m_count);
+			return m_count;
+		}
+
+		void 
+		cloud::on_queue(
+			__in nomic::core::renderer &renderer,
+			__in const glm::vec3 &position,
+			__inout std::vector<nomic::core::entity_layer> &layer
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Renderer=%p, Position={%f, %f, %f}, Layer[%u]=%p", &renderer, position.x, position.y,
+				position.z, layer.size(), &layer);
+
+			if(m_count) {
+				layer.push_back(std::make_tuple(RENDER_PASS_TRANSPARENT, RENDER_TEXTURE_NONE,
+					std::abs(position.y - CLOUD_HEIGHT) + CLOUD_RADIUS));
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		cloud::on_render(
+			__in nomic::core::renderer &renderer,
+			__in void *textures,
+			__in float delta
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Renderer=%p, Textures=%p, Delta=%f", &renderer, textures, delta);
+
+			if(m_count) {
+				nomic::graphic::vao &arr = vertex_array();
+				arr.bind();
+				arr.enable(CLOUD_INDEX_INSTANCE);
+				arr.enable(CLOUD_INDEX_NORMAL);
+				arr.enable(CLOUD_INDEX_SIDE);
+				arr.enable(CLOUD_INDEX_VERTEX);
+				GL_CHECK(LEVEL_WARNING, glDrawArraysInstanced, GL_TRIANGLES, 0, CLOUD_SEGMENT_COUNT, m_count);
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		cloud::on_update(
+			__in void *runtime,
+			__in void *camera
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Runtime=%p, Camera=%p", runtime, camera);
+
+			if(runtime && camera) {
+				glm::ivec2 field;
+				glm::vec3 position = ((nomic::entity::camera *) camera)->position();
+				int32_t width = (CLOUD_WIDTH << (CLOUD_LOD_COUNT - 1));
+
+				m_position.x = (((nomic::runtime *) runtime)->tick() * CLOUD_SPEED);
+				field.x = (std::floor((position.x - m_position.x) / width) * width);
+				field.y = (std::floor((position.z - m_position.z) / width) * width);
+
+				if(m_dirty || (field != m_field)) {
+					build(field);
+					m_dirty = false;
+					m_field = field;
+				}
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		bool 
+		cloud::sample(
+			__in int32_t x,
+			__in int32_t z
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%i, %i}", x, z);
+
+			result = (std::abs(m_noise.generate(x / NOISE_SCALE_CLOUD, z / NOISE_SCALE_CLOUD)) >= CLOUD_THRESHOLD);
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
+			return result;
+		}
+
+		void 
+		cloud::set_seed(
+			__in uint32_t seed,
+			__in_opt uint32_t octaves,
+			__in_opt double amplitude
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Seed=%u(%x), Octaves=%u, Amplitude=%g", seed, seed, octaves, amplitude);
+
+			m_noise.setup(seed + seed, octaves, amplitude);
+			m_dirty = true;
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		cloud::setup(void)
+		{
+			std::vector<glm::vec3> normal, vertex;
+			glm::vec3 scale = glm::vec3(BLOCK_WIDTH, CLOUD_THICKNESS, BLOCK_WIDTH);
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			for(uint32_t iter = 0; iter < CLOUD_SEGMENT_COUNT; ++iter) {
+				normal.push_back(CLOUD_NORMAL[iter / 6]);
+				vertex.push_back(CLOUD_VERTEX[iter] * scale);
+			}
+
+			nomic::graphic::vao &arr = vertex_array();
+			arr.bind();
+			arr.add(nomic::graphic::vbo(GL_ARRAY_BUFFER, CLOUD_INSTANCE_MAX * CLOUD_SEGMENT_WIDTH_INSTANCE * sizeof(GLfloat),
+				GL_DYNAMIC_DRAW), CLOUD_INDEX_INSTANCE, CLOUD_SEGMENT_WIDTH_INSTANCE, GL_FLOAT);
+			arr.add(nomic::graphic::vbo(GL_ARRAY_BUFFER, std::vector<uint8_t>((uint8_t *) &normal[0],
+				((uint8_t *) &normal[0]) + (CLOUD_SEGMENT_COUNT * CLOUD_SEGMENT_WIDTH_NORMAL * sizeof(GLfloat))),
+				GL_STATIC_DRAW), CLOUD_INDEX_NORMAL, CLOUD_SEGMENT_WIDTH_NORMAL, GL_FLOAT);
+			arr.add(nomic::graphic::vbo(GL_ARRAY_BUFFER, CLOUD_INSTANCE_MAX * CLOUD_SEGMENT_WIDTH_SIDE * sizeof(GLfloat),
+				GL_DYNAMIC_DRAW), CLOUD_INDEX_SIDE, CLOUD_SEGMENT_WIDTH_SIDE, GL_FLOAT);
+			arr.add(nomic::graphic::vbo(GL_ARRAY_BUFFER, std::vector<uint8_t>((uint8_t *) &vertex[0],
+				((uint8_t *) &vertex[0]) + (CLOUD_SEGMENT_COUNT * CLOUD_SEGMENT_WIDTH_VERTEX * sizeof(GLfloat))),
+				GL_STATIC_DRAW), CLOUD_INDEX_VERTEX, CLOUD_SEGMENT_WIDTH_VERTEX, GL_FLOAT);
+			arr.set_divisor(CLOUD_INDEX_INSTANCE, 1);
+			arr.set_divisor(CLOUD_INDEX_SIDE, 1);
+			arr.enable(CLOUD_INDEX_INSTANCE);
+			arr.enable(CLOUD_INDEX_NORMAL);
+			arr.enable(CLOUD_INDEX_SIDE);
+			arr.enable(CLOUD_INDEX_VERTEX);
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		std::string 
+		cloud::to_string(
+			__in_opt bool verbose
+			) const
+		{
+			std::stringstream result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Verbose=%x", verbose);
+
+			result << NOMIC_ENTITY_CLOUD_HEADER << "(" << SCALAR_AS_HEX(uintptr_t, this) << ")";
+
+			if(verbose) {
+				result << " Base=" << nomic::entity::object::to_string(verbose)
+					<< ", Noise=" << m_noise.to_string(verbose)
+					<< ", Field={" << m_field.x << ", " << m_field.y << "}"
+					<< ", State=" << (m_dirty ? "Dirty" : "Clean")
+					<< ", Instance[" << m_count << "]";
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+			return result.str();
+		}
+	}
+}
@@ -18,6 +18,8 @@
 
 #include "../../include/entity/diagnostic.h"
 #include "../../include/entity/camera.h"
+#include "../../include/graphic/manager.h"
+#include "../../include/render/manager.h"
 #include "../../include/runtime.h"
 #include "../../include/trace.h"
 #include "./diagnostic_type.h"
@@ -97,6 +99,29 @@ namespace nomic {
 						<< " (Day " << ((runtime_ref->tick() / TICKS_PER_CYCLE) + runtime_ref->tick_cycle()) << ")";
 				}
 
+				nomic::render::manager &render_ref = nomic::render::manager::acquire();
+				if(render_ref.initialized()) {
+					result << std::endl << "Draw=" << render_ref.queued();
+
+					for(uint32_t state = 0; state <= RENDER_STATE_MAX; ++state) {
+						result << ", " << RENDER_STATE_STRING(state) << "=" << render_ref.state_changes(state)
+							<< " (-" << render_ref.state_changes_avoided(state) << ")";
+					}
+				}
+
+				render_ref.release();
+
+				nomic::graphic::manager &graphic_ref = nomic::graphic::manager::acquire();
+				if(graphic_ref.initialized()) {
+					result << std::endl << "Texture=" << graphic_ref.count(PRIMITIVE_TEXTURE)
+						<< " (" << (graphic_ref.size(PRIMITIVE_TEXTURE) / KILOBYTE) << " KB)"
+						<< ", Vao=" << graphic_ref.count(PRIMITIVE_VAO)
+						<< ", Vbo=" << graphic_ref.count(PRIMITIVE_VBO)
+						<< " (" << (graphic_ref.size(PRIMITIVE_VBO) / KILOBYTE) << " KB)";
+				}
+
+				graphic_ref.release();
+
 				nomic::entity::camera *camera_ref = (nomic::entity::camera *) camera;
 				if(camera_ref) {
 					glm::vec3 position = camera_ref->position();
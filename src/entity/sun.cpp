@@ -250,6 +250,18 @@ namespace nomic {
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
+		void 
+		sun::set_radius(
+			__in float radius
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Radius=%f", radius);
+
+			m_radius = radius;
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
 		void 
 		sun::setup(void)
 		{
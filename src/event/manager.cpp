@@ -24,7 +24,10 @@ namespace nomic {
 
 	namespace event {
 
-		manager::manager(void)
+		manager::manager(void) :
+			m_dispatch(false),
+			m_dispatch_id(JOB_INVALID),
+			m_manager_job(nomic::job::manager::acquire())
 		{
 			TRACE_ENTRY(LEVEL_VERBOSE);
 			TRACE_EXIT(LEVEL_VERBOSE);
@@ -33,6 +36,33 @@ namespace nomic {
 		manager::~manager(void)
 		{
 			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			m_manager_job.release();
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		manager::dispatch(void)
+		{
+			nomic::core::event event;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			for(;;) {
+				std::unique_lock<std::mutex> lock(m_mutex);
+
+				if(m_queue.empty()) {
+					m_dispatch = false;
+					break;
+				}
+
+				event = m_queue.front();
+				m_queue.pop();
+				lock.unlock();
+				send_event(event);
+			}
+
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
@@ -62,10 +92,7 @@ namespace nomic {
 			TRACE_ENTRY(LEVEL_VERBOSE);
 
 			while(poll_event(event)) {
-
-				if(nomic::core::thread::active()) {
-					send_event(event);
-				}
+				send_event(event);
 			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
@@ -80,40 +107,12 @@ namespace nomic {
 
 			TRACE_MESSAGE(LEVEL_INFORMATION, "Event manager initializing...");
 
-			nomic::core::thread::start(true);
-
 			TRACE_MESSAGE(LEVEL_INFORMATION, "Event manager initialized");
 
 			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
 			return result;
 		}
 
-		bool 
-		manager::on_run(void)
-		{
-			bool result = true;
-			nomic::core::event event;
-
-			TRACE_ENTRY(LEVEL_VERBOSE);
-
-			while(poll_event(event)) {
-				send_event(event);
-			}
-
-			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
-			return result;
-		}
-
-		void 
-		manager::on_stop(void)
-		{
-			TRACE_ENTRY(LEVEL_VERBOSE);
-
-			m_id.clear();
-
-			TRACE_EXIT(LEVEL_VERBOSE);
-		}
-
 		void 
 		manager::on_uninitialize(void)
 		{
@@ -121,11 +120,15 @@ namespace nomic {
 
 			TRACE_MESSAGE(LEVEL_INFORMATION, "Event manager uninitializing...");
 
-			if(nomic::core::thread::active()) {
-				flush_events();
-				nomic::core::thread::stop();
+			if((m_dispatch_id != JOB_INVALID) && m_manager_job.initialized()) {
+				m_manager_job.wait(m_dispatch_id);
 			}
 
+			flush_events();
+			m_dispatch = false;
+			m_dispatch_id = JOB_INVALID;
+			m_id.clear();
+
 			TRACE_MESSAGE(LEVEL_INFORMATION, "Event manager uninitialized");
 
 			TRACE_EXIT(LEVEL_VERBOSE);
@@ -157,11 +160,13 @@ namespace nomic {
 			__in const nomic::core::event &event
 			)
 		{
+			bool dispatch = false;
+
 			TRACE_ENTRY(LEVEL_VERBOSE);
 
-			std::lock_guard<std::mutex> lock(m_mutex);
+			std::unique_lock<std::mutex> lock(m_mutex);
 
-			if(!nomic::core::thread::active()) {
+			if(!m_initialized) {
 				THROW_NOMIC_EVENT_MANAGER_EXCEPTION(NOMIC_EVENT_MANAGER_EXCEPTION_UNINITIALIZED);
 			}
 
@@ -170,7 +175,23 @@ namespace nomic {
 			}
 
 			m_queue.push(event);
-			nomic::core::thread::notify();
+
+			if(!m_dispatch && m_manager_job.initialized()) {
+				m_dispatch = true;
+				dispatch = true;
+			}
+
+			lock.unlock();
+
+			if(dispatch) {
+				uint32_t id = m_manager_job.add(std::bind(&manager::dispatch, this), JOB_PRIORITY_HIGH);
+
+				lock.lock();
+				m_dispatch_id = id;
+				lock.unlock();
+			} else if(!m_manager_job.initialized()) {
+				flush_events();
+			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
@@ -185,7 +206,7 @@ namespace nomic {
 
 			std::lock_guard<std::mutex> lock(m_mutex);
 
-			if(!nomic::core::thread::active()) {
+			if(!m_initialized) {
 				THROW_NOMIC_EVENT_MANAGER_EXCEPTION(NOMIC_EVENT_MANAGER_EXCEPTION_UNINITIALIZED);
 			}
 
@@ -224,7 +245,7 @@ namespace nomic {
 
 			std::lock_guard<std::mutex> lock(m_mutex);
 
-			if(!nomic::core::thread::active()) {
+			if(!m_initialized) {
 				THROW_NOMIC_EVENT_MANAGER_EXCEPTION(NOMIC_EVENT_MANAGER_EXCEPTION_UNINITIALIZED);
 			}
 
@@ -318,7 +339,8 @@ namespace nomic {
 					result << "}";
 				}
 
-				result << ", Queue[" << m_queue.size() << "]";
+				result << ", Queue[" << m_queue.size() << "]"
+					<< ", Dispatch=" << m_dispatch << "(" << SCALAR_AS_HEX(uint32_t, m_dispatch_id) << ")";
 			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
@@ -336,7 +358,7 @@ namespace nomic {
 
 			std::lock_guard<std::mutex> lock(m_mutex);
 
-			if(!nomic::core::thread::active()) {
+			if(!m_initialized) {
 				THROW_NOMIC_EVENT_MANAGER_EXCEPTION(NOMIC_EVENT_MANAGER_EXCEPTION_UNINITIALIZED);
 			}
 
@@ -382,7 +404,7 @@ namespace nomic {
 
 			std::lock_guard<std::mutex> lock(m_mutex);
 
-			if(!nomic::core::thread::active()) {
+			if(!m_initialized) {
 				THROW_NOMIC_EVENT_MANAGER_EXCEPTION(NOMIC_EVENT_MANAGER_EXCEPTION_UNINITIALIZED);
 			}
 
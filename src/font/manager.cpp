@@ -96,8 +96,12 @@ namespace nomic {
 			__in uint32_t size
 			)
 		{
+			bool hit;
+			uint64_t key;
 			uint32_t result;
+			std::string data;
 			std::map<uint32_t, nomic::font::context>::iterator iter_cont;
+			glm::uvec2 range(FONT_CHARACTER_MIN, FONT_CHARACTER_MAX);
 
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Path[%u]=%s, Size=%u", path.size(), STRING_CHECK(path), size);
 
@@ -117,6 +121,33 @@ namespace nomic {
 			iter_cont->second.first.load(m_handle, path, size);
 			GL_CHECK(LEVEL_WARNING, glPixelStorei, GL_UNPACK_ALIGNMENT, 1);
 
+			data = nomic::utility::read_file(path);
+			key = nomic::utility::hash(&data[0], data.size());
+			key = nomic::utility::hash(&size, sizeof(size), key);
+			key = nomic::utility::hash(&range, sizeof(range), key);
+
+			nomic::graphic::cache cache;
+			std::vector<nomic::graphic::cache_entry> &glyph = cache.entries();
+
+			hit = (cache.load(key) && (glyph.size() == FONT_CHARACTER_COUNT));
+			for(std::vector<nomic::graphic::cache_entry>::iterator iter = glyph.begin(); hit && (iter != glyph.end()); ++iter) {
+				hit = ((std::get<nomic::graphic::CACHE_ENTRY_ATTRIBUTE>(*iter).size() == CHARACTER_ATTRIBUTE_COUNT)
+					&& !std::get<nomic::graphic::CACHE_ENTRY_LEVEL>(*iter).empty());
+			}
+
+			if(hit) {
+				TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Font loaded from cache. Path[%u]=%s, Size=%u", path.size(),
+					STRING_CHECK(path), size);
+			} else {
+				glyph.assign(FONT_CHARACTER_COUNT, nomic::graphic::cache_entry());
+
+				for(uint16_t value = FONT_CHARACTER_MIN; value <= FONT_CHARACTER_MAX; ++value) {
+					iter_cont->second.first.rasterize(glyph.at(value - FONT_CHARACTER_MIN), value);
+				}
+
+				cache.save();
+			}
+
 			for(uint16_t value = FONT_CHARACTER_MIN; value <= FONT_CHARACTER_MAX; ++value) {
 				iter_cont->second.second.insert(std::make_pair(value, nomic::graphic::character()));
 
@@ -126,7 +157,7 @@ namespace nomic {
 						value, std::isprint(value) ? value : CHARACTER_FILL);
 				}
 
-				iter_cont->second.first.generate(iter_set->second, value);
+				iter_set->second.set(glyph.at(value - FONT_CHARACTER_MIN));
 			}
 
 			TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Font loaded. Path[%u]=%s, Size=%u, Id=%x", path.size(), STRING_CHECK(path), size,
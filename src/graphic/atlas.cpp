@@ -16,7 +16,11 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <climits>
+#include <cstring>
+#include <functional>
 #include "../../include/graphic/atlas.h"
+#include "../../include/job/manager.h"
 #include "../../include/trace.h"
 #include "./atlas_type.h"
 
@@ -24,6 +28,17 @@ namespace nomic {
 
 	namespace graphic {
 
+		#define ATLAS_DEPTH sizeof(uint32_t)
+
+		enum {
+			ATLAS_ATTRIBUTE_WIDTH = 0,
+			ATLAS_ATTRIBUTE_HEIGHT,
+			ATLAS_ATTRIBUTE_DEPTH,
+		};
+
+		#define ATLAS_ATTRIBUTE_COUNT (ATLAS_ATTRIBUTE_MAX + 1)
+		#define ATLAS_ATTRIBUTE_MAX ATLAS_ATTRIBUTE_DEPTH
+
 		atlas::atlas(
 			__in_opt const std::string &path,
 			__in_opt const glm::uvec2 &dimensions,
@@ -81,6 +96,104 @@ namespace nomic {
 			return *this;
 		}
 
+		void 
+		atlas::decode(
+			__in const std::string &path,
+			__inout std::vector<nomic::graphic::cache_entry> &entry
+			)
+		{
+			uint32_t rows;
+			std::vector<uint32_t> dependency;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Path[%u]=%s, Entry[%u]=%p", path.size(), STRING_CHECK(path), entry.size(), &entry);
+
+			m_bitmap.load(path);
+			if((m_bitmap.width() % m_dimensions.x) || (m_bitmap.height() % m_dimensions.y)) {
+				THROW_NOMIC_GRAPHIC_ATLAS_EXCEPTION_FORMAT(NOMIC_GRAPHIC_ATLAS_EXCEPTION_DIMENSIONS_MISMATCH,
+					"Dimensions={%u, %u}", m_dimensions.x, m_dimensions.y);
+			}
+
+			if(m_bitmap.width() != (m_dimensions.x * m_width)) {
+				THROW_NOMIC_GRAPHIC_ATLAS_EXCEPTION_FORMAT(NOMIC_GRAPHIC_ATLAS_EXCEPTION_WIDTH_MISMATCH,
+					"Width=%u", m_width);
+			}
+
+			rows = (m_bitmap.height() / m_dimensions.y);
+			entry.clear();
+			entry.resize(rows * m_width);
+
+			nomic::job::manager &instance = nomic::job::manager::acquire();
+
+			for(uint32_t z = 0; z < rows; ++z) {
+
+				if(instance.initialized()) {
+					dependency.push_back(instance.add(std::bind(&atlas::decode_row, this, z, std::ref(entry)),
+						JOB_PRIORITY_HIGH));
+				} else {
+					decode_row(z, entry);
+				}
+			}
+
+			for(std::vector<uint32_t>::iterator iter = dependency.begin(); iter != dependency.end(); ++iter) {
+				instance.wait(*iter);
+			}
+
+			instance.release();
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		atlas::decode_row(
+			__in uint32_t z,
+			__inout std::vector<nomic::graphic::cache_entry> &entry
+			)
+		{
+			uint32_t pitch;
+			const uint8_t *pixels;
+			bool packed;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Row=%u, Entry[%u]=%p", z, entry.size(), &entry);
+
+			packed = ((m_bitmap.depth() / CHAR_WIDTH) == BITMAP_DEPTH_32);
+			pitch = m_bitmap.pitch();
+			pixels = (const uint8_t *) m_bitmap.pixels();
+
+			for(uint32_t x = 0; x < m_width; ++x) {
+				uint32_t base_x = (x * m_dimensions.x), base_z = (z * m_dimensions.y);
+				nomic::graphic::cache_entry &tile = entry.at((z * m_width) + x);
+
+				std::vector<int32_t> &attribute = std::get<CACHE_ENTRY_ATTRIBUTE>(tile);
+				std::vector<std::vector<uint8_t>> &level = std::get<CACHE_ENTRY_LEVEL>(tile);
+
+				attribute.resize(ATLAS_ATTRIBUTE_COUNT, 0);
+				attribute.at(ATLAS_ATTRIBUTE_WIDTH) = m_dimensions.x;
+				attribute.at(ATLAS_ATTRIBUTE_HEIGHT) = m_dimensions.y;
+				attribute.at(ATLAS_ATTRIBUTE_DEPTH) = ATLAS_DEPTH;
+				level.assign(1, std::vector<uint8_t>(m_dimensions.x * m_dimensions.y * ATLAS_DEPTH, 0));
+
+				std::vector<uint8_t> &buffer = level.front();
+
+				for(uint32_t offset_z = 0; offset_z < m_dimensions.y; ++offset_z) {
+
+					if(packed) {
+						memcpy(&buffer[offset_z * m_dimensions.x * ATLAS_DEPTH],
+							&pixels[((base_z + offset_z) * pitch) + (base_x * ATLAS_DEPTH)], m_dimensions.x * ATLAS_DEPTH);
+						continue;
+					}
+
+					for(uint32_t offset_x = 0; offset_x < m_dimensions.x; ++offset_x) {
+						uint32_t pixel = m_bitmap.pixel(base_x + offset_x, base_z + offset_z);
+						memcpy(&buffer[((offset_z * m_dimensions.x) + offset_x) * ATLAS_DEPTH], &pixel, ATLAS_DEPTH);
+					}
+				}
+
+				nomic::graphic::texture::generate_levels(level, m_dimensions, ATLAS_DEPTH);
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
 		void 
 		atlas::destroy(void)
 		{
@@ -144,6 +257,10 @@ namespace nomic {
 			__in_opt uint8_t width
 			)
 		{
+			bool hit;
+			uint64_t key;
+			std::string data;
+
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Path[%u]=%s, Dimensions={%u, %u}, Width=%u", path.size(), STRING_CHECK(path),
 				dimensions.x, dimensions.y, width);
 
@@ -157,44 +274,46 @@ namespace nomic {
 					"Width=%u", width);
 			}
 
-			m_bitmap.load(path);
-			if((m_bitmap.width() % dimensions.x) || (m_bitmap.height() % dimensions.y)) {
-				THROW_NOMIC_GRAPHIC_ATLAS_EXCEPTION_FORMAT(NOMIC_GRAPHIC_ATLAS_EXCEPTION_DIMENSIONS_MISMATCH,
-					"Dimensions={%u, %u}", dimensions.x, dimensions.y);
-			}
-
+			destroy();
 			m_dimensions = dimensions;
 			m_width = width;
 
-			if(m_bitmap.width() != (m_dimensions.x * m_width)) {
-				THROW_NOMIC_GRAPHIC_ATLAS_EXCEPTION_FORMAT(NOMIC_GRAPHIC_ATLAS_EXCEPTION_WIDTH_MISMATCH,
-					"Width=%u", width);
-			}
+			data = nomic::utility::read_file(path);
+			key = nomic::utility::hash(&data[0], data.size());
+			key = nomic::utility::hash(&m_dimensions, sizeof(m_dimensions), key);
+			key = nomic::utility::hash(&m_width, sizeof(m_width), key);
 
-			for(uint32_t z = 0; z < (m_bitmap.height() / m_dimensions.y); ++z) {
+			nomic::graphic::cache cache;
+			std::vector<nomic::graphic::cache_entry> &entry = cache.entries();
 
-				for(uint32_t x = 0; x < (m_bitmap.width() / m_dimensions.x); ++x) {
-					std::vector<uint8_t> buffer;
-					uint32_t base_x = (x * m_dimensions.x), base_z = (z * m_dimensions.y);
+			hit = cache.load(key);
+			for(std::vector<nomic::graphic::cache_entry>::iterator iter = entry.begin(); hit && (iter != entry.end()); ++iter) {
+				const std::vector<int32_t> &attribute = std::get<CACHE_ENTRY_ATTRIBUTE>(*iter);
 
-					for(uint32_t offset_z = 0; offset_z < m_dimensions.y; ++offset_z) {
+				hit = ((attribute.size() == ATLAS_ATTRIBUTE_COUNT)
+					&& (attribute.at(ATLAS_ATTRIBUTE_WIDTH) == (int32_t) m_dimensions.x)
+					&& (attribute.at(ATLAS_ATTRIBUTE_HEIGHT) == (int32_t) m_dimensions.y)
+					&& (attribute.at(ATLAS_ATTRIBUTE_DEPTH) == (int32_t) ATLAS_DEPTH));
+			}
 
-						for(uint32_t offset_x = 0; offset_x < m_dimensions.x; ++offset_x) {
-							uint32_t pixel = m_bitmap.pixel(base_x + offset_x, base_z + offset_z);
-							buffer.insert(buffer.end(), (uint8_t *) &pixel, ((uint8_t *) &pixel) + sizeof(uint32_t));
-						}
-					}
+			if(hit && !entry.empty()) {
+				TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Atlas loaded from cache. Path[%u]=%s, Texture[%u]", path.size(),
+					STRING_CHECK(path), entry.size());
+			} else {
+				decode(path, entry);
+				cache.save();
+			}
 
-					nomic::graphic::texture *texture_ref = new nomic::graphic::texture;
-					if(!texture_ref) {
-						THROW_NOMIC_GRAPHIC_ATLAS_EXCEPTION_FORMAT(NOMIC_GRAPHIC_ATLAS_EXCEPTION_ALLOCATE,
-							"Path[%u]=%s, Position={%u, %u}", path.size(), STRING_CHECK(path), x, z);
-					}
+			for(std::vector<nomic::graphic::cache_entry>::iterator iter = entry.begin(); iter != entry.end(); ++iter) {
 
-					texture_ref->set(buffer, m_dimensions, sizeof(uint32_t));
-					m_texture.push_back(texture_ref);
-					buffer.clear();
+				nomic::graphic::texture *texture_ref = new nomic::graphic::texture;
+				if(!texture_ref) {
+					THROW_NOMIC_GRAPHIC_ATLAS_EXCEPTION_FORMAT(NOMIC_GRAPHIC_ATLAS_EXCEPTION_ALLOCATE,
+						"Path[%u]=%s, Index=%u", path.size(), STRING_CHECK(path), m_texture.size());
 				}
+
+				texture_ref->set(std::get<CACHE_ENTRY_LEVEL>(*iter), m_dimensions, ATLAS_DEPTH);
+				m_texture.push_back(texture_ref);
 			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
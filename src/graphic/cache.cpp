@@ -0,0 +1,312 @@
+/**
+ * Nomic
+ * Copyright (C) 2017 David Jolly
+ *
+ * Nomic is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Nomic is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include "../../include/graphic/cache.h"
+#include "../../include/trace.h"
+#include "./cache_type.h"
+
+namespace nomic {
+
+	namespace graphic {
+
+		#define CACHE_EXTENSION ".bin"
+		#define CACHE_EXTENSION_TEMPORARY ".tmp"
+		#define CACHE_MAGIC 0x48434d4e
+
+		cache::cache(void) :
+			m_key(CACHE_KEY_INVALID)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		cache::cache(
+			__in const cache &other
+			) :
+				m_entry(other.m_entry),
+				m_key(other.m_key)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		cache::~cache(void)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		cache &
+		cache::operator=(
+			__in const cache &other
+			)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			if(this != &other) {
+				m_entry = other.m_entry;
+				m_key = other.m_key;
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%p", this);
+			return *this;
+		}
+
+		void 
+		cache::clear(void)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			m_entry.clear();
+			m_key = CACHE_KEY_INVALID;
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		std::vector<nomic::graphic::cache_entry> &
+		cache::entries(void)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result[%u]=%p", m_entry.size(), &m_entry);
+			return m_entry;
+		}
+
+		uint64_t 
+		cache::key(void) const
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%llx", (unsigned long long) m_key);
+			return m_key;
+		}
+
+		bool 
+		cache::load(
+			__in uint64_t key
+			)
+		{
+			size_t length, offset = 0;
+			bool result = false;
+			std::string data, path_cache;
+			std::ifstream file;
+			uint64_t key_file = CACHE_KEY_INVALID;
+			uint32_t count = 0, magic = 0, version = 0;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Key=%llx", (unsigned long long) key);
+
+			if(key == CACHE_KEY_INVALID) {
+				THROW_NOMIC_GRAPHIC_CACHE_EXCEPTION_FORMAT(NOMIC_GRAPHIC_CACHE_EXCEPTION_KEY_INVALID, "Key=%llx",
+					(unsigned long long) key);
+			}
+
+			m_entry.clear();
+			m_key = key;
+
+			path_cache = path(key);
+			file = std::ifstream(path_cache.c_str(), std::ios::in | std::ios::binary);
+			if(file) {
+				file.seekg(0, std::ios::end);
+				length = file.tellg();
+				file.seekg(0, std::ios::beg);
+
+				if(length) {
+					data.resize(length, 0);
+					file.read(&data[0], data.size());
+				}
+
+				file.close();
+
+				result = (read(data, offset, &magic, sizeof(magic)) && (magic == CACHE_MAGIC)
+					&& read(data, offset, &version, sizeof(version)) && (version == CACHE_VERSION)
+					&& read(data, offset, &key_file, sizeof(key_file)) && (key_file == key)
+					&& read(data, offset, &count, sizeof(count)));
+
+				for(uint32_t iter = 0; result && (iter < count); ++iter) {
+					uint32_t attributes = 0, levels = 0;
+					nomic::graphic::cache_entry entry;
+
+					std::vector<int32_t> &attribute = std::get<CACHE_ENTRY_ATTRIBUTE>(entry);
+					std::vector<std::vector<uint8_t>> &level = std::get<CACHE_ENTRY_LEVEL>(entry);
+
+					result = (read(data, offset, &attributes, sizeof(attributes))
+						&& (attributes <= ((data.size() - offset) / sizeof(int32_t))));
+					if(result && attributes) {
+						attribute.resize(attributes, 0);
+						result = read(data, offset, &attribute[0], attributes * sizeof(int32_t));
+					}
+
+					result = (result && read(data, offset, &levels, sizeof(levels))
+						&& (levels <= ((data.size() - offset) / sizeof(uint32_t))));
+
+					for(uint32_t index = 0; result && (index < levels); ++index) {
+						uint32_t size = 0;
+
+						result = (read(data, offset, &size, sizeof(size)) && (size <= (data.size() - offset)));
+						if(result) {
+							level.push_back(std::vector<uint8_t>(size, 0));
+
+							if(size) {
+								result = read(data, offset, &level.back()[0], size);
+							}
+						}
+					}
+
+					if(result) {
+						m_entry.push_back(entry);
+					}
+				}
+
+				result = (result && (offset == data.size()));
+				if(!result) {
+					m_entry.clear();
+					TRACE_MESSAGE_FORMAT(LEVEL_WARNING, "Cache file is stale or malformed, Path[%u]=%s", path_cache.size(),
+						STRING_CHECK(path_cache));
+				}
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
+			return result;
+		}
+
+		std::string 
+		cache::path(
+			__in uint64_t key
+			)
+		{
+			std::stringstream result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Key=%llx", (unsigned long long) key);
+
+			result << CACHE_PATH_DEFAULT << std::hex << std::setfill('0') << std::setw(sizeof(uint64_t) * 2) << key
+				<< CACHE_EXTENSION;
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+			return result.str();
+		}
+
+		bool 
+		cache::read(
+			__in const std::string &data,
+			__inout size_t &offset,
+			__inout void *output,
+			__in size_t length
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Data[%u]=%p, Offset=%u, Output=%p, Length=%u", data.size(), &data[0], offset,
+				output, length);
+
+			result = ((offset <= data.size()) && (length <= (data.size() - offset)));
+			if(result && length) {
+				memcpy(output, &data[offset], length);
+				offset += length;
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
+			return result;
+		}
+
+		bool 
+		cache::save(void)
+		{
+			bool result;
+			std::ofstream file;
+			std::string path_cache, path_temporary;
+			uint32_t count, magic = CACHE_MAGIC, version = CACHE_VERSION;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			if(m_key == CACHE_KEY_INVALID) {
+				THROW_NOMIC_GRAPHIC_CACHE_EXCEPTION_FORMAT(NOMIC_GRAPHIC_CACHE_EXCEPTION_KEY_INVALID, "Key=%llx",
+					(unsigned long long) m_key);
+			}
+
+			path_cache = path(m_key);
+			path_temporary = (path_cache + CACHE_EXTENSION_TEMPORARY);
+
+			file = std::ofstream(path_temporary.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+			result = file.good();
+			if(result) {
+				count = m_entry.size();
+				file.write((const char *) &magic, sizeof(magic));
+				file.write((const char *) &version, sizeof(version));
+				file.write((const char *) &m_key, sizeof(m_key));
+				file.write((const char *) &count, sizeof(count));
+
+				for(std::vector<nomic::graphic::cache_entry>::const_iterator iter = m_entry.begin(); iter != m_entry.end();
+						++iter) {
+					const std::vector<int32_t> &attribute = std::get<CACHE_ENTRY_ATTRIBUTE>(*iter);
+					const std::vector<std::vector<uint8_t>> &level = std::get<CACHE_ENTRY_LEVEL>(*iter);
+					uint32_t attributes = attribute.size(), levels = level.size();
+
+					file.write((const char *) &attributes, sizeof(attributes));
+					if(attributes) {
+						file.write((const char *) &attribute[0], attributes * sizeof(int32_t));
+					}
+
+					file.write((const char *) &levels, sizeof(levels));
+
+					for(std::vector<std::vector<uint8_t>>::const_iterator iter_level = level.begin(); iter_level != level.end();
+							++iter_level) {
+						uint32_t size = iter_level->size();
+
+						file.write((const char *) &size, sizeof(size));
+						if(size) {
+							file.write((const char *) &(*iter_level)[0], size);
+						}
+					}
+				}
+
+				file.close();
+				result = (!file.fail() && !std::rename(path_temporary.c_str(), path_cache.c_str()));
+			}
+
+			if(!result) {
+				std::remove(path_temporary.c_str());
+				TRACE_MESSAGE_FORMAT(LEVEL_WARNING, "Failed to write cache file, Path[%u]=%s", path_cache.size(),
+					STRING_CHECK(path_cache));
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
+			return result;
+		}
+
+		std::string 
+		cache::to_string(
+			__in_opt bool verbose
+			) const
+		{
+			std::stringstream result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Verbose=%x", verbose);
+
+			result << NOMIC_GRAPHIC_CACHE_HEADER << "(" << SCALAR_AS_HEX(uintptr_t, this) << ")";
+
+			if(verbose) {
+				result << " Key=" << SCALAR_AS_HEX(uint64_t, m_key)
+					<< ", Entry[" << m_entry.size() << "]";
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+			return result.str();
+		}
+	}
+}
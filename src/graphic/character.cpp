@@ -187,6 +187,59 @@ namespace nomic {
 			GL_CHECK(LEVEL_WARNING, glTexImage2D, GL_TEXTURE_2D, 0, GL_RED, face->glyph->bitmap.width, face->glyph->bitmap.rows,
 				0, GL_RED, GL_UNSIGNED_BYTE, face->glyph->bitmap.buffer);
 			GL_CHECK(LEVEL_WARNING, glGenerateMipmap, GL_TEXTURE_2D);
+			set_size(m_dimensions.x * m_dimensions.y);
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		character::set(
+			__in const nomic::graphic::cache_entry &entry,
+			__in_opt GLenum wrap_s,
+			__in_opt GLenum wrap_t,
+			__in_opt GLenum filter_min,
+			__in_opt GLenum filter_mag
+			)
+		{
+			glm::ivec2 current;
+
+			const std::vector<int32_t> &attribute = std::get<CACHE_ENTRY_ATTRIBUTE>(entry);
+			const std::vector<std::vector<uint8_t>> &level = std::get<CACHE_ENTRY_LEVEL>(entry);
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Entry=%p, Attribute[%u], Level[%u], Wrap={%x, %x}, Filter={%x, %x}", &entry,
+				attribute.size(), level.size(), wrap_s, wrap_t, filter_min, filter_mag);
+
+			if((attribute.size() != CHARACTER_ATTRIBUTE_COUNT) || level.empty()) {
+				THROW_NOMIC_GRAPHIC_CHARACTER_EXCEPTION_FORMAT(NOMIC_GRAPHIC_CHARACTER_EXCEPTION_INVALID,
+					"Entry=%p, Attribute[%u], Level[%u]", &entry, attribute.size(), level.size());
+			}
+
+			m_advance = attribute.at(CHARACTER_ATTRIBUTE_ADVANCE);
+			m_bearing = glm::ivec2(attribute.at(CHARACTER_ATTRIBUTE_LEFT), attribute.at(CHARACTER_ATTRIBUTE_TOP));
+			m_dimensions = glm::ivec2(attribute.at(CHARACTER_ATTRIBUTE_WIDTH), attribute.at(CHARACTER_ATTRIBUTE_HEIGHT));
+			GL_CHECK(LEVEL_WARNING, glBindTexture, GL_TEXTURE_2D, m_handle);
+			GL_CHECK(LEVEL_WARNING, glTexParameteri, GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrap_s);
+			GL_CHECK(LEVEL_WARNING, glTexParameteri, GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrap_t);
+			GL_CHECK(LEVEL_WARNING, glTexParameteri, GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter_min);
+			GL_CHECK(LEVEL_WARNING, glTexParameteri, GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter_mag);
+			GL_CHECK(LEVEL_WARNING, glTexParameteri, GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+			GL_CHECK(LEVEL_WARNING, glTexParameteri, GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level.size() - 1);
+
+			current = m_dimensions;
+
+			for(uint32_t iter = 0; iter < level.size(); ++iter) {
+
+				if(level.at(iter).size() != (size_t) (current.x * current.y)) {
+					THROW_NOMIC_GRAPHIC_CHARACTER_EXCEPTION_FORMAT(NOMIC_GRAPHIC_CHARACTER_EXCEPTION_INVALID,
+						"Level[%u]=%u, Dimension={%i, %i}", iter, level.at(iter).size(), current.x, current.y);
+				}
+
+				GL_CHECK(LEVEL_WARNING, glTexImage2D, GL_TEXTURE_2D, iter, GL_RED, current.x, current.y, 0, GL_RED, GL_UNSIGNED_BYTE,
+					level.at(iter).empty() ? nullptr : &level.at(iter)[0]);
+				current = glm::max(current / glm::ivec2(2), glm::ivec2(1));
+			}
+
+			set_size(m_dimensions.x * m_dimensions.y);
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
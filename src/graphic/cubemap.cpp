@@ -117,6 +117,8 @@ namespace nomic {
 			__in_opt GLenum filter_mag
 			)
 		{
+			size_t size = 0;
+
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Path[%u], Scale=%f, Wrap={%x, %x, %x}, Filter={%x, %x}", path.size(), scale,
 				wrap_s, wrap_t, wrap_r, filter_min, filter_mag);
 
@@ -159,8 +161,11 @@ namespace nomic {
 				}
 
 				GL_CHECK(LEVEL_WARNING, glTexImage2D, face, 0, mode, dimensions.x, dimensions.y, 0, mode, format, image.pixels());
+				size += (dimensions.x * dimensions.y * (depth / CHAR_WIDTH));
 			}
 
+			set_size(size);
+
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
@@ -24,9 +24,17 @@ namespace nomic {
 
 	namespace graphic {
 
+		#define GRAPHIC_HANDLE_EMPTY std::make_tuple(0, SUBTYPE_UNDEFINED, 0)
+
 		manager::manager(void)
 		{
 			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			for(uint32_t type = 0; type <= PRIMITIVE_MAX; ++type) {
+				m_count[type] = 0;
+				m_size[type] = 0;
+			}
+
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
@@ -56,17 +64,38 @@ namespace nomic {
 				THROW_NOMIC_GRAPHIC_MANAGER_EXCEPTION_FORMAT(NOMIC_GRAPHIC_MANAGER_EXCEPTION_HANDLE_INVALID, "Handle=%x", handle);
 			}
 
-			std::map<uint32_t, std::map<GLuint, std::pair<size_t, GLenum>>>::iterator iter = m_handle.find(type);
-
-			result = (iter != m_handle.end());
-			if(result) {
-				result = (iter->second.find(handle) != iter->second.end());
+			if(type > PRIMITIVE_MAX) {
+				THROW_NOMIC_GRAPHIC_MANAGER_EXCEPTION_FORMAT(NOMIC_GRAPHIC_MANAGER_EXCEPTION_TYPE_INVALID, "Type=%x", type);
 			}
 
+			result = ((handle < m_handle[type].size())
+				&& (std::get<GRAPHIC_HANDLE_REFERENCE>(m_handle[type].at(handle)) >= REFERENCE_INIT));
+
 			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
 			return result;
 		}
 
+		size_t 
+		manager::count(
+			__in uint32_t type
+			)
+		{
+			size_t result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Type=%x", type);
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			if(type > PRIMITIVE_MAX) {
+				THROW_NOMIC_GRAPHIC_MANAGER_EXCEPTION_FORMAT(NOMIC_GRAPHIC_MANAGER_EXCEPTION_TYPE_INVALID, "Type=%x", type);
+			}
+
+			result = m_count[type];
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
+			return result;
+		}
+
 		size_t 
 		manager::decrement(
 			__in uint32_t type,
@@ -74,7 +103,6 @@ namespace nomic {
 			)
 		{
 			size_t result = 0;
-			std::map<GLuint, std::pair<size_t, GLenum>>::iterator iter_handle;
 
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Type=%x, Handle=%x", type, handle);
 
@@ -84,20 +112,11 @@ namespace nomic {
 				THROW_NOMIC_GRAPHIC_MANAGER_EXCEPTION(NOMIC_GRAPHIC_MANAGER_EXCEPTION_UNINITIALIZED);
 			}
 
-			iter_handle = find(type, handle);
-			if(iter_handle->second.first <= REFERENCE_INIT) {
-				destroy(type, iter_handle);
-
-				std::map<uint32_t, std::map<GLuint, std::pair<size_t, GLenum>>>::iterator iter_type = m_handle.find(type);
-				if(iter_type != m_handle.end()) {
-					iter_type->second.erase(iter_handle);
-
-					if(iter_type->second.empty()) {
-						m_handle.erase(iter_type);
-					}
-				}
+			nomic::graphic::graphic_handle &entry = find(type, handle);
+			if(std::get<GRAPHIC_HANDLE_REFERENCE>(entry) <= REFERENCE_INIT) {
+				destroy(type, handle);
 			} else {
-				result = --iter_handle->second.first;
+				result = --std::get<GRAPHIC_HANDLE_REFERENCE>(entry);
 			}
 
 			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
@@ -107,67 +126,112 @@ namespace nomic {
 		void 
 		manager::destroy(
 			__in uint32_t type,
-			__in std::map<GLuint, std::pair<size_t, GLenum>>::iterator iter
+			__in GLuint handle
 			)
 		{
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Type=%x", type);
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Type=%x, Handle=%x", type, handle);
 
-			switch(type) {
-				case PRIMITIVE_CHARACTER:
-				case PRIMITIVE_CUBEMAP:
-				case PRIMITIVE_TEXTURE:
-					GL_CHECK(LEVEL_WARNING, glDeleteTextures, HANDLE_COUNT, &iter->first);
-					break;
-				case PRIMITIVE_FBO:
-					GL_CHECK(LEVEL_WARNING, glDeleteFramebuffers, HANDLE_COUNT, &iter->first);
-					break;
-				case PRIMITIVE_PROGRAM:
-					GL_CHECK(LEVEL_WARNING, glDeleteProgram, iter->first);
-					break;
-				case PRIMITIVE_SHADER:
-					GL_CHECK(LEVEL_WARNING, glDeleteShader, iter->first);
-					break;
-				case PRIMITIVE_VAO:
-					GL_CHECK(LEVEL_WARNING, glDeleteVertexArrays, HANDLE_COUNT, &iter->first);
-					break;
-				case PRIMITIVE_VBO:
-					GL_CHECK(LEVEL_WARNING, glDeleteBuffers, HANDLE_COUNT, &iter->first);
-					break;
-				default:
-					THROW_NOMIC_GRAPHIC_MANAGER_EXCEPTION_FORMAT(NOMIC_GRAPHIC_MANAGER_EXCEPTION_TYPE_INVALID, "Type=%x", type);
+			nomic::graphic::graphic_handle &entry = m_handle[type].at(handle);
+			m_size[type] -= std::get<GRAPHIC_HANDLE_SIZE>(entry);
+			--m_count[type];
+			entry = GRAPHIC_HANDLE_EMPTY;
+			m_pending[type].push_back(handle);
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		manager::destroy_pending(void)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			for(uint32_t type = 0; type <= PRIMITIVE_MAX; ++type) {
+				std::vector<GLuint> &pending = m_pending[type];
+
+				if(pending.empty()) {
+					continue;
+				}
+
+				switch(type) {
+					case PRIMITIVE_CHARACTER:
+					case PRIMITIVE_CUBEMAP:
+					case PRIMITIVE_TEXTURE:
+						GL_CHECK(LEVEL_WARNING, glDeleteTextures, pending.size(), &pending[0]);
+						break;
+					case PRIMITIVE_FBO:
+						GL_CHECK(LEVEL_WARNING, glDeleteFramebuffers, pending.size(), &pending[0]);
+						break;
+					case PRIMITIVE_PROGRAM:
+
+						for(std::vector<GLuint>::iterator iter = pending.begin(); iter != pending.end(); ++iter) {
+							GL_CHECK(LEVEL_WARNING, glDeleteProgram, *iter);
+						}
+						break;
+					case PRIMITIVE_SHADER:
+
+						for(std::vector<GLuint>::iterator iter = pending.begin(); iter != pending.end(); ++iter) {
+							GL_CHECK(LEVEL_WARNING, glDeleteShader, *iter);
+						}
+						break;
+					case PRIMITIVE_VAO:
+						GL_CHECK(LEVEL_WARNING, glDeleteVertexArrays, pending.size(), &pending[0]);
+						break;
+					case PRIMITIVE_VBO:
+						GL_CHECK(LEVEL_WARNING, glDeleteBuffers, pending.size(), &pending[0]);
+						break;
+					default:
+						THROW_NOMIC_GRAPHIC_MANAGER_EXCEPTION_FORMAT(NOMIC_GRAPHIC_MANAGER_EXCEPTION_TYPE_INVALID, "Type=%x", type);
+				}
+
+				pending.clear();
 			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
-		std::map<GLuint, std::pair<size_t, GLenum>>::iterator 
+		nomic::graphic::graphic_handle &
 		manager::find(
 			__in uint32_t type,
 			__in GLuint handle
 			)
 		{
-			std::map<GLuint, std::pair<size_t, GLenum>>::iterator result;
-
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Type=%x, Handle=%x", type, handle);
 
 			if(handle == HANDLE_INVALID) {
 				THROW_NOMIC_GRAPHIC_MANAGER_EXCEPTION_FORMAT(NOMIC_GRAPHIC_MANAGER_EXCEPTION_HANDLE_INVALID, "Handle=%x", handle);
 			}
 
-			std::map<uint32_t, std::map<GLuint, std::pair<size_t, GLenum>>>::iterator iter = m_handle.find(type);
-			if(iter == m_handle.end()) {
-				THROW_NOMIC_GRAPHIC_MANAGER_EXCEPTION_FORMAT(NOMIC_GRAPHIC_MANAGER_EXCEPTION_TYPE_NOT_FOUND, "Type=%x", type);
+			if(type > PRIMITIVE_MAX) {
+				THROW_NOMIC_GRAPHIC_MANAGER_EXCEPTION_FORMAT(NOMIC_GRAPHIC_MANAGER_EXCEPTION_TYPE_INVALID, "Type=%x", type);
 			}
 
-			result = iter->second.find(handle);
-			if(result == iter->second.end()) {
+			if((handle >= m_handle[type].size())
+					|| (std::get<GRAPHIC_HANDLE_REFERENCE>(m_handle[type].at(handle)) < REFERENCE_INIT)) {
 				THROW_NOMIC_GRAPHIC_MANAGER_EXCEPTION_FORMAT(NOMIC_GRAPHIC_MANAGER_EXCEPTION_HANDLE_NOT_FOUND, "Handle=%x", handle);
 			}
 
+			nomic::graphic::graphic_handle &result = m_handle[type].at(handle);
+
 			TRACE_EXIT(LEVEL_VERBOSE);
 			return result;
 		}
 
+		void 
+		manager::flush(void)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			if(!m_initialized) {
+				THROW_NOMIC_GRAPHIC_MANAGER_EXCEPTION(NOMIC_GRAPHIC_MANAGER_EXCEPTION_UNINITIALIZED);
+			}
+
+			destroy_pending();
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
 		GLuint 
 		manager::generate(
 			__in uint32_t type,
@@ -175,7 +239,6 @@ namespace nomic {
 			)
 		{
 			GLuint result = HANDLE_INVALID;
-			std::map<uint32_t, std::map<GLuint, std::pair<size_t, GLenum>>>::iterator iter;
 
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Type=%x, Subtype=%x", type, subtype);
 
@@ -210,16 +273,18 @@ namespace nomic {
 				THROW_NOMIC_GRAPHIC_MANAGER_EXCEPTION_FORMAT(NOMIC_GRAPHIC_MANAGER_EXCEPTION_HANDLE_INVALID, "Handle=%x", result);
 			}
 
-			if(m_handle.find(type) == m_handle.end()) {
-				m_handle.insert(std::make_pair(type, std::map<GLuint, std::pair<size_t, GLenum>>()));
+			std::vector<nomic::graphic::graphic_handle> &table = m_handle[type];
+			if(result >= table.size()) {
+				table.resize(result + 1, GRAPHIC_HANDLE_EMPTY);
 			}
 
-			iter = m_handle.find(type);
-			if(iter->second.find(result) != iter->second.end()) {
+			nomic::graphic::graphic_handle &entry = table.at(result);
+			if(std::get<GRAPHIC_HANDLE_REFERENCE>(entry) != 0) {
 				THROW_NOMIC_GRAPHIC_MANAGER_EXCEPTION_FORMAT(NOMIC_GRAPHIC_MANAGER_EXCEPTION_HANDLE_DUPLICATE, "Handle=%x", result);
 			}
 
-			iter->second.insert(std::make_pair(result, std::make_pair(REFERENCE_INIT, subtype)));
+			entry = std::make_tuple(REFERENCE_INIT, subtype, 0);
+			++m_count[type];
 
 			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
 			return result;
@@ -233,24 +298,14 @@ namespace nomic {
 			)
 		{
 			GLuint result = HANDLE_INVALID;
-			std::map<GLuint, std::pair<size_t, GLenum>>::iterator iter_handle;
 
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Type=%x, Subtype=%x, Handle=%x", type, subtype, handle);
 
 			if(handle != HANDLE_INVALID) {
 				std::lock_guard<std::mutex> lock(m_mutex);
 
-				iter_handle = find(type, handle);
-				destroy(type, iter_handle);
-
-				std::map<uint32_t, std::map<GLuint, std::pair<size_t, GLenum>>>::iterator iter_type = m_handle.find(type);
-				if(iter_type != m_handle.end()) {
-					iter_type->second.erase(iter_handle);
-
-					if(iter_type->second.empty()) {
-						m_handle.erase(iter_type);
-					}
-				}
+				find(type, handle);
+				destroy(type, handle);
 			}
 
 			result = generate(type, subtype);
@@ -275,7 +330,7 @@ namespace nomic {
 				THROW_NOMIC_GRAPHIC_MANAGER_EXCEPTION(NOMIC_GRAPHIC_MANAGER_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = ++find(type, handle)->second.first;
+			result = ++std::get<GRAPHIC_HANDLE_REFERENCE>(find(type, handle));
 
 			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
 			return result;
@@ -302,18 +357,21 @@ namespace nomic {
 
 			TRACE_MESSAGE(LEVEL_INFORMATION, "Graphic manager uninitializing...");
 
-			for(std::map<uint32_t, std::map<GLuint, std::pair<size_t, GLenum>>>::iterator iter_type = m_handle.begin();
-					iter_type != m_handle.end(); ++iter_type) {
+			for(uint32_t type = 0; type <= PRIMITIVE_MAX; ++type) {
 
-				for(std::map<GLuint, std::pair<size_t, GLenum>>::iterator iter_handle = iter_type->second.begin();
-						iter_handle != iter_type->second.end(); ++iter_handle) {
-					destroy(iter_type->first, iter_handle);
+				for(GLuint handle = 0; handle < m_handle[type].size(); ++handle) {
+
+					if(std::get<GRAPHIC_HANDLE_REFERENCE>(m_handle[type].at(handle)) >= REFERENCE_INIT) {
+						destroy(type, handle);
+					}
 				}
 
-				iter_type->second.clear();
+				m_handle[type].clear();
+				m_count[type] = 0;
+				m_size[type] = 0;
 			}
 
-			m_handle.clear();
+			destroy_pending();
 
 			TRACE_MESSAGE(LEVEL_INFORMATION, "Graphic manager uninitialized");
 
@@ -336,7 +394,51 @@ namespace nomic {
 				THROW_NOMIC_GRAPHIC_MANAGER_EXCEPTION(NOMIC_GRAPHIC_MANAGER_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = find(type, handle)->second.first;
+			result = std::get<GRAPHIC_HANDLE_REFERENCE>(find(type, handle));
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
+			return result;
+		}
+
+		void 
+		manager::set_size(
+			__in uint32_t type,
+			__in GLuint handle,
+			__in size_t size
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Type=%x, Handle=%x, Size=%u", type, handle, size);
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			if(!m_initialized) {
+				THROW_NOMIC_GRAPHIC_MANAGER_EXCEPTION(NOMIC_GRAPHIC_MANAGER_EXCEPTION_UNINITIALIZED);
+			}
+
+			nomic::graphic::graphic_handle &entry = find(type, handle);
+			m_size[type] -= std::get<GRAPHIC_HANDLE_SIZE>(entry);
+			m_size[type] += size;
+			std::get<GRAPHIC_HANDLE_SIZE>(entry) = size;
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		size_t 
+		manager::size(
+			__in uint32_t type
+			)
+		{
+			size_t result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Type=%x", type);
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			if(type > PRIMITIVE_MAX) {
+				THROW_NOMIC_GRAPHIC_MANAGER_EXCEPTION_FORMAT(NOMIC_GRAPHIC_MANAGER_EXCEPTION_TYPE_INVALID, "Type=%x", type);
+			}
+
+			result = m_size[type];
 
 			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
 			return result;
@@ -355,44 +457,38 @@ namespace nomic {
 
 			if(verbose) {
 				result << " Base=" << SINGLETON_CLASS(nomic::graphic::manager)::to_string(verbose)
-					<< ", Handle[" << m_handle.size() << "]";
+					<< ", Handle[" << (PRIMITIVE_MAX + 1) << "]={";
 
-				if(!m_handle.empty()) {
-					result << "={";
+				for(uint32_t type = 0; type <= PRIMITIVE_MAX; ++type) {
+					size_t count = 0;
 
-					for(std::map<uint32_t, std::map<GLuint, std::pair<size_t, GLenum>>>::const_iterator iter_type = m_handle.begin();
-							iter_type != m_handle.end(); ++iter_type) {
-
-						if(iter_type != m_handle.begin()) {
-							result << ", ";
-						}
-
-						result << "(" << SCALAR_AS_HEX(uint32_t, iter_type->first) << "[" << iter_type->second.size() << "]";
-
-						if(!iter_type->second.empty()) {
-							result << "={";
-
-							for(std::map<GLuint, std::pair<size_t, GLenum>>::const_iterator iter_handle
-									= iter_type->second.begin(); iter_handle != iter_type->second.end();
-									++iter_handle) {
+					if(type) {
+						result << ", ";
+					}
 
-								if(iter_handle != iter_type->second.begin()) {
-									result << ", ";
-								}
+					result << "(" << SCALAR_AS_HEX(uint32_t, type) << "[" << m_count[type] << "]";
 
-								result << "(Handle=" << SCALAR_AS_HEX(GLuint, iter_handle->first)
-									<< ", Enum=" << SCALAR_AS_HEX(GLenum, iter_handle->second.second)
-									<< ", Reference=" << iter_handle->second.first << ")";
-							}
+					for(GLuint handle = 0; handle < m_handle[type].size(); ++handle) {
+						const nomic::graphic::graphic_handle &entry = m_handle[type].at(handle);
 
-							result << "}";
+						if(std::get<GRAPHIC_HANDLE_REFERENCE>(entry) < REFERENCE_INIT) {
+							continue;
 						}
 
-						result << ")";
+						result << (count++ ? ", " : "={") << "(Handle=" << SCALAR_AS_HEX(GLuint, handle)
+							<< ", Enum=" << SCALAR_AS_HEX(GLenum, std::get<GRAPHIC_HANDLE_SUBTYPE>(entry))
+							<< ", Reference=" << std::get<GRAPHIC_HANDLE_REFERENCE>(entry)
+							<< ", Size=" << std::get<GRAPHIC_HANDLE_SIZE>(entry) << ")";
 					}
 
-					result << "}";
+					if(count) {
+						result << "}";
+					}
+
+					result << ", Size=" << m_size[type] << ", Pending=" << m_pending[type].size() << ")";
 				}
+
+				result << "}";
 			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
@@ -448,6 +448,19 @@ namespace nomic {
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
+		void 
+		program::set_uniform_block(
+			__in GLuint index,
+			__in GLuint binding
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Index=%x, Binding=%x", index, binding);
+
+			GL_CHECK(LEVEL_WARNING, glUniformBlockBinding, m_handle, index, binding);
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
 		size_t 
 		program::shader_count(void)
 		{
@@ -515,6 +528,26 @@ namespace nomic {
 			return result.str();
 		}
 
+		GLuint 
+		program::uniform_block_index(
+			__in const std::string &name
+			)
+		{
+			GLuint result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Name[%u]=%s", name.size(), STRING_CHECK(name));
+
+			if(name.empty()) {
+				THROW_NOMIC_GRAPHIC_PROGRAM_EXCEPTION_FORMAT(NOMIC_GRAPHIC_PROGRAM_LOCATION_INVALID, "Name[%u]=%s",
+					name.size(), STRING_CHECK(name));
+			}
+
+			GL_CHECK_RESULT(LEVEL_WARNING, glGetUniformBlockIndex, result, m_handle, (const GLchar *) &name[0]);
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
+			return result;
+		}
+
 		GLint 
 		program::uniform_location(
 			__in const std::string &name
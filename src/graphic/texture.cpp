@@ -178,6 +178,54 @@ namespace nomic {
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
+		void 
+		texture::generate_levels(
+			__inout std::vector<std::vector<uint8_t>> &level,
+			__in const glm::uvec2 &dimensions,
+			__in uint32_t depth
+			)
+		{
+			glm::uvec2 current = dimensions;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Level[%u]=%p, Dimensions={%u, %u}, Depth=%u", level.size(), &level, dimensions.x,
+				dimensions.y, depth);
+
+			if(level.empty() || (level.front().size() != (dimensions.x * dimensions.y * depth))) {
+				THROW_NOMIC_GRAPHIC_TEXTURE_EXCEPTION_FORMAT(NOMIC_GRAPHIC_TEXTURE_EXCEPTION_LEVEL_INVALID,
+					"Level[%u]=%p, Dimensions={%u, %u}, Depth=%u", level.size(), &level, dimensions.x, dimensions.y, depth);
+			}
+
+			level.resize(1);
+
+			while(current.x && current.y && ((current.x > 1) || (current.y > 1))) {
+				glm::uvec2 next = glm::max(current / glm::uvec2(2), glm::uvec2(1));
+				std::vector<uint8_t> output(next.x * next.y * depth, 0);
+				const std::vector<uint8_t> &input = level.back();
+
+				for(uint32_t y = 0; y < next.y; ++y) {
+					uint32_t y_first = std::min(y * 2, current.y - 1), y_second = std::min((y * 2) + 1, current.y - 1);
+
+					for(uint32_t x = 0; x < next.x; ++x) {
+						uint32_t x_first = std::min(x * 2, current.x - 1), x_second = std::min((x * 2) + 1, current.x - 1);
+
+						for(uint32_t channel = 0; channel < depth; ++channel) {
+							uint32_t sum = input[(((y_first * current.x) + x_first) * depth) + channel]
+								+ input[(((y_first * current.x) + x_second) * depth) + channel]
+								+ input[(((y_second * current.x) + x_first) * depth) + channel]
+								+ input[(((y_second * current.x) + x_second) * depth) + channel];
+
+							output[(((y * next.x) + x) * depth) + channel] = ((sum + 2) / 4);
+						}
+					}
+				}
+
+				level.push_back(output);
+				current = next;
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Level[%u]", level.size());
+		}
+
 		uint32_t 
 		texture::height(void) const
 		{
@@ -240,6 +288,7 @@ namespace nomic {
 			GL_CHECK(LEVEL_WARNING, glTexImage2D, GL_TEXTURE_2D, 0, m_mode, m_dimensions.x, m_dimensions.y, 0, m_mode, format,
 				image.pixels());
 			GL_CHECK(LEVEL_WARNING, glGenerateMipmap, GL_TEXTURE_2D);
+			set_size(m_dimensions.x * m_dimensions.y * (m_depth / CHAR_WIDTH));
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
@@ -284,6 +333,72 @@ namespace nomic {
 			GL_CHECK(LEVEL_WARNING, glTexImage2D, GL_TEXTURE_2D, 0, m_mode, m_dimensions.x, m_dimensions.y, 0, m_mode, format,
 				&data[0]);
 			GL_CHECK(LEVEL_WARNING, glGenerateMipmap, GL_TEXTURE_2D);
+			set_size(m_dimensions.x * m_dimensions.y * (m_depth / CHAR_WIDTH));
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		texture::set(
+			__in const std::vector<std::vector<uint8_t>> &level,
+			__in const glm::uvec2 &dimensions,
+			__in uint32_t depth,
+			__in_opt GLenum wrap_s,
+			__in_opt GLenum wrap_t,
+			__in_opt GLenum filter_min,
+			__in_opt GLenum filter_mag
+			)
+		{
+			glm::uvec2 current;
+			GLenum format = GL_UNSIGNED_BYTE;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Level[%u]=%p, Dimensions={%u, %u}, Depth=%u, Wrap={%x, %x}, Filter={%x, %x}",
+				level.size(), &level, dimensions.x, dimensions.y, depth, wrap_s, wrap_t, filter_min, filter_mag);
+
+			if(level.empty()) {
+				THROW_NOMIC_GRAPHIC_TEXTURE_EXCEPTION_FORMAT(NOMIC_GRAPHIC_TEXTURE_EXCEPTION_LEVEL_INVALID, "Level[%u]=%p",
+					level.size(), &level);
+			}
+
+			m_depth = (depth * CHAR_WIDTH);
+			switch(m_depth / CHAR_WIDTH) {
+				case BITMAP_DEPTH_24:
+					m_mode = GL_RGB;
+					format = GL_UNSIGNED_BYTE;
+					break;
+				case BITMAP_DEPTH_32:
+					m_mode = GL_RGBA;
+					format = GL_UNSIGNED_INT_8_8_8_8;
+					break;
+				default:
+					THROW_NOMIC_GRAPHIC_TEXTURE_EXCEPTION_FORMAT(NOMIC_GRAPHIC_TEXTURE_EXCEPTION_DEPTH_INVALID,
+						"Depth=%u", m_depth);
+			}
+
+			m_dimensions = dimensions;
+			GL_CHECK(LEVEL_WARNING, glBindTexture, GL_TEXTURE_2D, m_handle);
+			GL_CHECK(LEVEL_WARNING, glTexParameteri, GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrap_s);
+			GL_CHECK(LEVEL_WARNING, glTexParameteri, GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrap_t);
+			GL_CHECK(LEVEL_WARNING, glTexParameteri, GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter_min);
+			GL_CHECK(LEVEL_WARNING, glTexParameteri, GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter_mag);
+			GL_CHECK(LEVEL_WARNING, glTexParameteri, GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+			GL_CHECK(LEVEL_WARNING, glTexParameteri, GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level.size() - 1);
+
+			current = m_dimensions;
+
+			for(uint32_t iter = 0; iter < level.size(); ++iter) {
+
+				if(level.at(iter).size() != (current.x * current.y * depth)) {
+					THROW_NOMIC_GRAPHIC_TEXTURE_EXCEPTION_FORMAT(NOMIC_GRAPHIC_TEXTURE_EXCEPTION_LEVEL_INVALID,
+						"Level[%u]=%u, Dimensions={%u, %u}", iter, level.at(iter).size(), current.x, current.y);
+				}
+
+				GL_CHECK(LEVEL_WARNING, glTexImage2D, GL_TEXTURE_2D, iter, m_mode, current.x, current.y, 0, m_mode, format,
+					&level.at(iter)[0]);
+				current = glm::max(current / glm::uvec2(2), glm::uvec2(1));
+			}
+
+			set_size(m_dimensions.x * m_dimensions.y * (m_depth / CHAR_WIDTH));
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
@@ -319,6 +434,18 @@ namespace nomic {
 			GL_CHECK(LEVEL_WARNING, glTexParameteri, GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter_min);
 			GL_CHECK(LEVEL_WARNING, glTexParameteri, GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter_mag);
 
+			switch(format) {
+				case GL_RED:
+					set_size(width * height);
+					break;
+				case GL_RGB:
+					set_size(width * height * BITMAP_DEPTH_24);
+					break;
+				default:
+					set_size(width * height * BITMAP_DEPTH_32);
+					break;
+			}
+
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
@@ -34,12 +34,14 @@ namespace nomic {
 
 		enum {
 			NOMIC_GRAPHIC_TEXTURE_EXCEPTION_DEPTH_INVALID = 0,
+			NOMIC_GRAPHIC_TEXTURE_EXCEPTION_LEVEL_INVALID,
 		};
 
-		#define NOMIC_GRAPHIC_TEXTURE_EXCEPTION_MAX NOMIC_GRAPHIC_TEXTURE_EXCEPTION_DEPTH_INVALID
+		#define NOMIC_GRAPHIC_TEXTURE_EXCEPTION_MAX NOMIC_GRAPHIC_TEXTURE_EXCEPTION_LEVEL_INVALID
 
 		static const std::string NOMIC_GRAPHIC_TEXTURE_EXCEPTION_STR[] = {
 			NOMIC_GRAPHIC_TEXTURE_EXCEPTION_HEADER "Invalid texture depth",
+			NOMIC_GRAPHIC_TEXTURE_EXCEPTION_HEADER "Invalid texture level",
 			};
 
 		#define NOMIC_GRAPHIC_TEXTURE_EXCEPTION_STRING(_TYPE_) \
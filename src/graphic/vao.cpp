@@ -224,6 +224,44 @@ namespace nomic {
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
+		void 
+		vao::set_divisor(
+			__in GLuint index,
+			__in GLuint divisor
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Index=%x, Divisor=%u", index, divisor);
+
+			if(m_vbo.find(index) == m_vbo.end()) {
+				THROW_NOMIC_GRAPHIC_VAO_EXCEPTION_FORMAT(NOMIC_GRAPHIC_VAO_EXCEPTION_NOT_FOUND, "Index=%x", index);
+			}
+
+			GL_CHECK(LEVEL_WARNING, glVertexAttribDivisor, index, divisor);
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		vao::set_pointer(
+			__in GLuint index,
+			__in GLint size,
+			__in GLenum type,
+			__in_opt GLboolean normalized,
+			__in_opt GLsizei stride,
+			__in_opt const GLvoid *pointer
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Index=%x, Size=%u, Type=%x, Normalized=%x, Stride=%u, Pointer=%p", index, size, type,
+				normalized, stride, pointer);
+
+			std::map<GLuint, nomic::graphic::vbo>::iterator iter = find(index);
+			bind();
+			iter->second.bind();
+			GL_CHECK(LEVEL_WARNING, glVertexAttribPointer, index, size, type, normalized, stride, pointer);
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
 		void 
 		vao::set_subdata(
 			__in GLuint index,
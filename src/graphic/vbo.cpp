@@ -64,6 +64,22 @@ namespace nomic {
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
+		vbo::vbo(
+			__in GLenum target,
+			__in const GLvoid *data,
+			__in uint32_t size,
+			__in GLenum usage
+			) :
+				nomic::core::primitive(PRIMITIVE_VBO, target),
+				m_usage(GL_STATIC_DRAW)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Target=%x, Data[%u]=%p, Usage=%x", target, size, data, usage);
+
+			set(data, size, usage);
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
 		vbo::vbo(
 			__in const vbo &other
 			) :
@@ -110,6 +126,18 @@ namespace nomic {
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
+		void 
+		vbo::bind_base(
+			__in GLuint index
+			) const
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Index=%x", index);
+
+			GL_CHECK(LEVEL_WARNING, glBindBufferBase, m_subtype, index, m_handle);
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
 		void 
 		vbo::set(
 			__in uint32_t size,
@@ -122,6 +150,7 @@ namespace nomic {
 			GL_CHECK(LEVEL_WARNING, glBufferData, m_subtype, size, nullptr, usage);
 			m_data.clear();
 			m_usage = usage;
+			set_size(size);
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
@@ -138,6 +167,25 @@ namespace nomic {
 			GL_CHECK(LEVEL_WARNING, glBufferData, m_subtype, data.size(), &data[0], usage);
 			m_data = data;
 			m_usage = usage;
+			set_size(data.size());
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		vbo::set(
+			__in const GLvoid *data,
+			__in uint32_t size,
+			__in GLenum usage
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Data[%u]=%p, Usage=%x", size, data, usage);
+
+			bind();
+			GL_CHECK(LEVEL_WARNING, glBufferData, m_subtype, size, data, usage);
+			m_data.clear();
+			m_usage = usage;
+			set_size(size);
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
@@ -149,7 +197,7 @@ namespace nomic {
 			__in const GLvoid *data
 			)
 		{
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Offset=%p, Data[%u]=%p", index, offset, size, data);
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Offset=%p, Data[%u]=%p", offset, size, data);
 
 			bind();
 			GL_CHECK(LEVEL_WARNING, glBufferSubData, m_subtype, offset, size, data);
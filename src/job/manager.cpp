@@ -0,0 +1,574 @@
+/**
+ * Nomic
+ * Copyright (C) 2017 David Jolly
+ *
+ * Nomic is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Nomic is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/job/manager.h"
+#include "../../include/trace.h"
+#include "./manager_type.h"
+
+namespace nomic {
+
+	namespace job {
+
+		static thread_local uint32_t job_worker_current = JOB_WORKER_NONE;
+
+		manager::manager(void) :
+			m_job_next(JOB_INVALID + 1),
+			m_ready(0)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		manager::~manager(void)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		bool 
+		manager::acquire_any(
+			__in uint32_t index,
+			__inout uint32_t &id
+			)
+		{
+			bool result = false;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Index=%u", index);
+
+			if(index < m_worker.size()) {
+				result = m_worker.at(index)->pop(id);
+			}
+
+			if(!result) {
+				std::lock_guard<std::mutex> lock(m_mutex_queue);
+
+				for(uint32_t priority = 0; priority <= JOB_PRIORITY_MAX; ++priority) {
+					std::deque<uint32_t> &queue = m_queue[priority];
+
+					if(!queue.empty()) {
+						id = queue.front();
+						queue.pop_front();
+						result = true;
+						break;
+					}
+				}
+			}
+
+			for(uint32_t offset = 1; !result && (offset <= m_worker.size()); ++offset) {
+				uint32_t victim = (((index < m_worker.size()) ? index : 0) + offset) % m_worker.size();
+
+				if(victim != index) {
+					result = m_worker.at(victim)->steal(id);
+				}
+			}
+
+			if(result) {
+				--m_ready;
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x, Id=%x", result, id);
+			return result;
+		}
+
+		bool 
+		manager::acquire_main(
+			__inout uint32_t &id
+			)
+		{
+			bool result = false;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			std::lock_guard<std::mutex> lock(m_mutex_queue);
+
+			for(uint32_t priority = 0; priority <= JOB_PRIORITY_MAX; ++priority) {
+				std::deque<uint32_t> &queue = m_queue_main[priority];
+
+				if(!queue.empty()) {
+					id = queue.front();
+					queue.pop_front();
+					result = true;
+					break;
+				}
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x, Id=%x", result, id);
+			return result;
+		}
+
+		uint32_t 
+		manager::add(
+			__in const std::function<void(void)> &task,
+			__in_opt uint32_t priority,
+			__in_opt uint32_t affinity,
+			__in_opt const std::vector<uint32_t> &dependency
+			)
+		{
+			uint32_t count = 0, result = JOB_INVALID;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Priority=%u, Affinity=%u, Dependency[%u]", priority, affinity, dependency.size());
+
+			if(priority > JOB_PRIORITY_MAX) {
+				THROW_NOMIC_JOB_MANAGER_EXCEPTION_FORMAT(NOMIC_JOB_MANAGER_EXCEPTION_PRIORITY_INVALID, "Priority=%u", priority);
+			}
+
+			if(affinity > JOB_AFFINITY_MAX) {
+				THROW_NOMIC_JOB_MANAGER_EXCEPTION_FORMAT(NOMIC_JOB_MANAGER_EXCEPTION_AFFINITY_INVALID, "Affinity=%u", affinity);
+			}
+
+			if(!task) {
+				THROW_NOMIC_JOB_MANAGER_EXCEPTION(NOMIC_JOB_MANAGER_EXCEPTION_INVALID);
+			}
+
+			std::unique_lock<std::mutex> lock(m_mutex);
+
+			if(!m_initialized) {
+				THROW_NOMIC_JOB_MANAGER_EXCEPTION(NOMIC_JOB_MANAGER_EXCEPTION_UNINITIALIZED);
+			}
+
+			result = m_job_next++;
+			if(m_job_next == JOB_INVALID) {
+				++m_job_next;
+			}
+
+			for(std::vector<uint32_t>::const_iterator iter = dependency.begin(); iter != dependency.end(); ++iter) {
+
+				std::map<uint32_t, nomic::job::job_entry>::iterator entry = m_job.find(*iter);
+				if(entry != m_job.end()) {
+					std::get<JOB_ENTRY_DEPENDENT>(entry->second).push_back(result);
+					++count;
+				}
+			}
+
+			m_job.insert(std::make_pair(result, std::make_tuple(task, priority, affinity, count, std::vector<uint32_t>())));
+			lock.unlock();
+
+			if(!count) {
+				schedule(result, priority, affinity);
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
+			return result;
+		}
+
+		bool 
+		manager::complete(
+			__in uint32_t id
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Id=%x", id);
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			result = (m_job.find(id) == m_job.end());
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
+			return result;
+		}
+
+		void 
+		manager::execute(
+			__in uint32_t id
+			)
+		{
+			std::function<void(void)> task;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Id=%x", id);
+
+			std::unique_lock<std::mutex> lock(m_mutex);
+
+			std::map<uint32_t, nomic::job::job_entry>::iterator iter = m_job.find(id);
+			if(iter == m_job.end()) {
+				THROW_NOMIC_JOB_MANAGER_EXCEPTION_FORMAT(NOMIC_JOB_MANAGER_EXCEPTION_NOT_FOUND, "Id=%x", id);
+			}
+
+			task.swap(std::get<JOB_ENTRY_TASK>(iter->second));
+			lock.unlock();
+
+			try {
+				task();
+			} catch(nomic::exception &exc) {
+				lock.lock();
+
+				if(m_exception.empty()) {
+					m_exception = exc;
+				}
+
+				lock.unlock();
+			} catch(std::exception &exc) {
+				lock.lock();
+
+				if(m_exception.empty()) {
+					m_exception = nomic::exception(exc.what(), __FILE__, __FUNCTION__, __LINE__);
+				}
+
+				lock.unlock();
+			}
+
+			finish(id);
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		manager::finish(
+			__in uint32_t id
+			)
+		{
+			std::vector<uint32_t> dependent;
+			std::vector<std::tuple<uint32_t, uint32_t, uint32_t>> ready;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Id=%x", id);
+
+			std::unique_lock<std::mutex> lock(m_mutex);
+
+			std::map<uint32_t, nomic::job::job_entry>::iterator iter = m_job.find(id);
+			if(iter == m_job.end()) {
+				THROW_NOMIC_JOB_MANAGER_EXCEPTION_FORMAT(NOMIC_JOB_MANAGER_EXCEPTION_NOT_FOUND, "Id=%x", id);
+			}
+
+			dependent.swap(std::get<JOB_ENTRY_DEPENDENT>(iter->second));
+			m_job.erase(iter);
+
+			for(std::vector<uint32_t>::iterator entry = dependent.begin(); entry != dependent.end(); ++entry) {
+
+				iter = m_job.find(*entry);
+				if((iter != m_job.end()) && !--std::get<JOB_ENTRY_DEPENDENCY>(iter->second)) {
+					ready.push_back(std::make_tuple(iter->first, std::get<JOB_ENTRY_PRIORITY>(iter->second),
+						std::get<JOB_ENTRY_AFFINITY>(iter->second)));
+				}
+			}
+
+			lock.unlock();
+			m_condition_complete.notify_all();
+
+			for(std::vector<std::tuple<uint32_t, uint32_t, uint32_t>>::iterator entry = ready.begin(); entry != ready.end();
+					++entry) {
+				schedule(std::get<0>(*entry), std::get<1>(*entry), std::get<2>(*entry));
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		bool 
+		manager::on_initialize(void)
+		{
+			bool result = true;
+			uint32_t count = std::thread::hardware_concurrency();
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			TRACE_MESSAGE(LEVEL_INFORMATION, "Job manager initializing...");
+
+			count = ((count > (JOB_WORKER_MIN + 1)) ? (count - 1) : JOB_WORKER_MIN);
+			m_main = std::this_thread::get_id();
+
+			for(uint32_t index = 0; index < count; ++index) {
+
+				nomic::job::worker *entry = new nomic::job::worker(index, this);
+				if(!entry) {
+					THROW_NOMIC_JOB_MANAGER_EXCEPTION_FORMAT(NOMIC_JOB_MANAGER_EXCEPTION_ALLOCATE, "Index=%u", index);
+				}
+
+				m_worker.push_back(entry);
+			}
+
+			for(std::vector<nomic::job::worker *>::iterator iter = m_worker.begin(); iter != m_worker.end(); ++iter) {
+				(*iter)->start();
+			}
+
+			TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Job manager workers=%u", m_worker.size());
+			TRACE_MESSAGE(LEVEL_INFORMATION, "Job manager initialized");
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
+			return result;
+		}
+
+		void 
+		manager::on_uninitialize(void)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			TRACE_MESSAGE(LEVEL_INFORMATION, "Job manager uninitializing...");
+
+			for(;;) {
+				uint32_t id;
+
+				std::unique_lock<std::mutex> lock(m_mutex);
+
+				if(m_job.empty()) {
+					break;
+				}
+
+				lock.unlock();
+
+				if(acquire_main(id) || acquire_any(job_worker_current, id)) {
+					execute(id);
+				} else {
+					lock.lock();
+					m_condition_complete.wait_for(lock, std::chrono::milliseconds(JOB_IDLE_TIMEOUT));
+				}
+			}
+
+			m_condition.notify_all();
+
+			for(std::vector<nomic::job::worker *>::iterator iter = m_worker.begin(); iter != m_worker.end(); ++iter) {
+
+				if(*iter) {
+					(*iter)->stop();
+					delete *iter;
+					*iter = nullptr;
+				}
+			}
+
+			m_worker.clear();
+
+			for(uint32_t priority = 0; priority <= JOB_PRIORITY_MAX; ++priority) {
+				m_queue[priority].clear();
+				m_queue_main[priority].clear();
+			}
+
+			if(!m_exception.empty()) {
+				TRACE_MESSAGE_FORMAT(LEVEL_WARNING, "Job manager exception discarded: %s", STRING_CHECK(m_exception.to_string(true)));
+				m_exception.clear();
+			}
+
+			m_job_next = (JOB_INVALID + 1);
+			m_ready = 0;
+
+			TRACE_MESSAGE(LEVEL_INFORMATION, "Job manager uninitialized");
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		size_t 
+		manager::pending(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			result = m_job.size();
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
+			return result;
+		}
+
+		void 
+		manager::raise(void)
+		{
+			nomic::exception exception;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			std::unique_lock<std::mutex> lock(m_mutex);
+
+			if(!m_exception.empty()) {
+				exception = m_exception;
+				m_exception.clear();
+				lock.unlock();
+				THROW_NOMIC_JOB_MANAGER_EXCEPTION_FORMAT(NOMIC_JOB_MANAGER_EXCEPTION_INTERNAL, "%s",
+					STRING_CHECK(exception.to_string(true)));
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		manager::run_main(
+			__in_opt uint32_t limit
+			)
+		{
+			uint32_t id;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Limit=%u", limit);
+
+			if(!m_initialized) {
+				THROW_NOMIC_JOB_MANAGER_EXCEPTION(NOMIC_JOB_MANAGER_EXCEPTION_UNINITIALIZED);
+			}
+
+			for(uint32_t count = 0; (count < limit) && acquire_main(id); ++count) {
+				execute(id);
+			}
+
+			raise();
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		manager::run_worker(
+			__in uint32_t index
+			)
+		{
+			uint32_t id;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Index=%u", index);
+
+			job_worker_current = index;
+
+			if(acquire_any(index, id)) {
+				execute(id);
+			} else {
+				std::unique_lock<std::mutex> lock(m_mutex_queue);
+				m_condition.wait_for(lock, std::chrono::milliseconds(JOB_IDLE_TIMEOUT), [this]() { return (m_ready > 0); });
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		manager::schedule(
+			__in uint32_t id,
+			__in uint32_t priority,
+			__in uint32_t affinity
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Id=%x, Priority=%u, Affinity=%u", id, priority, affinity);
+
+			if(affinity == JOB_AFFINITY_MAIN) {
+				std::lock_guard<std::mutex> lock(m_mutex_queue);
+
+				m_queue_main[priority].push_back(id);
+				m_condition_complete.notify_all();
+			} else {
+
+				// count the job before it becomes visible, so a thief cannot decrement past zero
+				++m_ready;
+
+				if(job_worker_current < m_worker.size()) {
+					m_worker.at(job_worker_current)->push(id, priority);
+				}
+
+				std::lock_guard<std::mutex> lock(m_mutex_queue);
+
+				if(job_worker_current >= m_worker.size()) {
+					m_queue[priority].push_back(id);
+				}
+
+				m_condition.notify_one();
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		manager::set_main(void)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			m_main = std::this_thread::get_id();
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		std::string 
+		manager::to_string(
+			__in_opt bool verbose
+			) const
+		{
+			std::stringstream result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Verbose=%x", verbose);
+
+			result << NOMIC_JOB_MANAGER_HEADER << "(" << SCALAR_AS_HEX(uintptr_t, this) << ")";
+
+			if(verbose) {
+				result << " Base=" << SINGLETON_CLASS(nomic::job::manager)::to_string(verbose);
+
+				if(m_initialized) {
+					result << ", Job[" << m_job.size() << "], Ready=" << m_ready.load()
+						<< ", Main=" << m_main
+						<< ", Worker[" << m_worker.size() << "]";
+
+					if(!m_worker.empty()) {
+						result << "={";
+
+						for(std::vector<nomic::job::worker *>::const_iterator iter = m_worker.begin(); iter != m_worker.end();
+								++iter) {
+
+							if(iter != m_worker.begin()) {
+								result << ", ";
+							}
+
+							result << (*iter)->to_string(verbose);
+						}
+
+						result << "}";
+					}
+				}
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+			return result.str();
+		}
+
+		void 
+		manager::wait(
+			__in uint32_t id
+			)
+		{
+			uint32_t next;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Id=%x", id);
+
+			if(id == JOB_INVALID) {
+				THROW_NOMIC_JOB_MANAGER_EXCEPTION_FORMAT(NOMIC_JOB_MANAGER_EXCEPTION_INVALID, "Id=%x", id);
+			}
+
+			for(;;) {
+				bool main;
+
+				std::unique_lock<std::mutex> lock(m_mutex);
+
+				if(m_job.find(id) == m_job.end()) {
+					break;
+				}
+
+				main = (std::this_thread::get_id() == m_main);
+				lock.unlock();
+
+				if((main && acquire_main(next)) || acquire_any(job_worker_current, next)) {
+					execute(next);
+				} else {
+					lock.lock();
+					m_condition_complete.wait_for(lock, std::chrono::milliseconds(JOB_IDLE_TIMEOUT),
+						[this, id]() { return (m_job.find(id) == m_job.end()); });
+				}
+			}
+
+			raise();
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		uint32_t 
+		manager::workers(void) const
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", m_worker.size());
+			return m_worker.size();
+		}
+	}
+}
@@ -0,0 +1,216 @@
+/**
+ * Nomic
+ * Copyright (C) 2017 David Jolly
+ *
+ * Nomic is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Nomic is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/job/manager.h"
+#include "../../include/trace.h"
+#include "./worker_type.h"
+
+namespace nomic {
+
+	namespace job {
+
+		worker::worker(
+			__in uint32_t index,
+			__in void *owner
+			) :
+				m_index(index),
+				m_owner(owner)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Index=%u, Owner=%p", index, owner);
+
+			if(!owner) {
+				THROW_NOMIC_JOB_WORKER_EXCEPTION_FORMAT(NOMIC_JOB_WORKER_EXCEPTION_OWNER_INVALID, "Owner=%p", owner);
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		worker::~worker(void)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			stop();
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		uint32_t 
+		worker::index(void) const
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", m_index);
+			return m_index;
+		}
+
+		bool 
+		worker::on_run(void)
+		{
+			bool result = true;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			((nomic::job::manager *) m_owner)->run_worker(m_index);
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
+			return result;
+		}
+
+		bool 
+		worker::pop(
+			__inout uint32_t &id
+			)
+		{
+			bool result = false;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			for(uint32_t priority = 0; priority <= JOB_PRIORITY_MAX; ++priority) {
+				std::deque<uint32_t> &queue = m_queue[priority];
+
+				if(!queue.empty()) {
+					id = queue.back();
+					queue.pop_back();
+					result = true;
+					break;
+				}
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x, Id=%x", result, id);
+			return result;
+		}
+
+		void 
+		worker::push(
+			__in uint32_t id,
+			__in uint32_t priority
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Id=%x, Priority=%u", id, priority);
+
+			if(priority > JOB_PRIORITY_MAX) {
+				THROW_NOMIC_JOB_WORKER_EXCEPTION_FORMAT(NOMIC_JOB_WORKER_EXCEPTION_PRIORITY_INVALID, "Priority=%u", priority);
+			}
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			m_queue[priority].push_back(id);
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		size_t 
+		worker::size(void)
+		{
+			size_t result = 0;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			for(uint32_t priority = 0; priority <= JOB_PRIORITY_MAX; ++priority) {
+				result += m_queue[priority].size();
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
+			return result;
+		}
+
+		void 
+		worker::start(void)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			nomic::core::thread::start(false);
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		bool 
+		worker::steal(
+			__inout uint32_t &id
+			)
+		{
+			bool result = false;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			for(uint32_t priority = 0; priority <= JOB_PRIORITY_MAX; ++priority) {
+				std::deque<uint32_t> &queue = m_queue[priority];
+
+				if(!queue.empty()) {
+					id = queue.front();
+					queue.pop_front();
+					result = true;
+					break;
+				}
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x, Id=%x", result, id);
+			return result;
+		}
+
+		void 
+		worker::stop(void)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			if(nomic::core::thread::active()) {
+				nomic::core::thread::stop();
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		std::string 
+		worker::to_string(
+			__in_opt bool verbose
+			) const
+		{
+			std::stringstream result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Verbose=%x", verbose);
+
+			result << NOMIC_JOB_WORKER_HEADER << "(" << SCALAR_AS_HEX(uintptr_t, this) << ")";
+
+			if(verbose) {
+				result << " Base=" << nomic::core::thread::to_string(verbose)
+					<< ", Index=" << m_index
+					<< ", Owner=" << SCALAR_AS_HEX(uintptr_t, m_owner)
+					<< ", Queue={";
+
+				for(uint32_t priority = 0; priority <= JOB_PRIORITY_MAX; ++priority) {
+
+					if(priority) {
+						result << ", ";
+					}
+
+					result << m_queue[priority].size();
+				}
+
+				result << "}";
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+			return result.str();
+		}
+	}
+}
@@ -16,8 +16,9 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cstring>
 #include "../../include/render/manager.h"
-#include "../../include/entity/chunk.h"
 #include "../../include/trace.h"
 #include "./manager_type.h"
 
@@ -25,9 +26,48 @@ namespace nomic {
 
 	namespace render {
 
-		manager::manager(void)
+		#define RENDER_FRAME_OFFSET_AMBIENT 192
+		#define RENDER_FRAME_OFFSET_AMBIENT_BACKGROUND 208
+		#define RENDER_FRAME_OFFSET_AMBIENT_POSITION 224
+		#define RENDER_FRAME_OFFSET_CLOUDS 272
+		#define RENDER_FRAME_OFFSET_CYCLE 268
+		#define RENDER_FRAME_OFFSET_POSITION 240
+		#define RENDER_FRAME_OFFSET_PROJECTION 0
+		#define RENDER_FRAME_OFFSET_PROJECTION_ORTHOGONAL 64
+		#define RENDER_FRAME_OFFSET_ROTATION 256
+		#define RENDER_FRAME_OFFSET_UNDERWATER 276
+		#define RENDER_FRAME_OFFSET_VIEW 128
+
+		#define RENDER_KEY_DEPTH_MAX 0x00ffffff
+		#define RENDER_KEY_DEPTH_SCALE 256.f
+		#define RENDER_KEY_DEPTH_SHIFT 0
+		#define RENDER_KEY_DEPTH_SHIFT_TRANSPARENT 16
+		#define RENDER_KEY_PASS_SHIFT 56
+		#define RENDER_KEY_RENDERER_SHIFT 48
+		#define RENDER_KEY_TEXTURE_SHIFT 32
+		#define RENDER_KEY_TEXTURE_SHIFT_TRANSPARENT 0
+		#define RENDER_KEY_WIDTH 64
+		#define RENDER_RADIX_BUCKETS (1 << RENDER_RADIX_WIDTH)
+		#define RENDER_RADIX_MASK (RENDER_RADIX_BUCKETS - 1)
+		#define RENDER_RADIX_WIDTH 8
+
+		enum {
+			RENDER_ITEM_KEY = 0,
+			RENDER_ITEM_RENDERER,
+			RENDER_ITEM_ENTITY,
+			RENDER_ITEM_PASS,
+			RENDER_ITEM_TEXTURE,
+		};
+
+		manager::manager(void) :
+			m_frame(nullptr),
+			m_frame_data(UNIFORM_BLOCK_FRAME_SIZE, 0)
 		{
 			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			std::fill(m_state_changes, m_state_changes + (RENDER_STATE_MAX + 1), 0);
+			std::fill(m_state_changes_avoided, m_state_changes_avoided + (RENDER_STATE_MAX + 1), 0);
+
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
@@ -193,6 +233,11 @@ namespace nomic {
 
 			TRACE_MESSAGE(LEVEL_INFORMATION, "Render manager uninitializing...");
 
+			if(m_frame) {
+				delete m_frame;
+				m_frame = nullptr;
+			}
+
 			m_entry.clear();
 
 			TRACE_MESSAGE(LEVEL_INFORMATION, "Render manager uninitialized.");
@@ -234,6 +279,122 @@ namespace nomic {
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
+		void 
+		manager::queue(
+			__in const glm::vec3 &position
+			)
+		{
+			std::map<uint32_t, std::pair<nomic::core::renderer *, std::set<nomic::core::entity *>>>::iterator iter;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%f, %f, %f}", position.x, position.y, position.z);
+
+			m_queue.clear();
+
+			for(iter = m_entry.begin(); iter != m_entry.end(); ++iter) {
+				nomic::core::renderer *rend = iter->second.first;
+				std::set<nomic::core::entity *> &entity = iter->second.second;
+
+				if(!rend || entity.empty()) {
+					continue;
+				}
+
+				for(std::set<nomic::core::entity *>::iterator iter_entity = entity.begin(); iter_entity != entity.end();
+						++iter_entity) {
+
+					if(!*iter_entity || !(*iter_entity)->shown()) {
+						continue;
+					}
+
+					m_layer.clear();
+					(*iter_entity)->on_queue(*rend, position, m_layer);
+
+					for(std::vector<nomic::core::entity_layer>::iterator iter_layer = m_layer.begin();
+							iter_layer != m_layer.end(); ++iter_layer) {
+						uint64_t key, depth;
+						uint32_t pass = std::get<nomic::core::ENTITY_LAYER_PASS>(*iter_layer);
+						uint8_t texture = std::get<nomic::core::ENTITY_LAYER_TEXTURE>(*iter_layer);
+
+						depth = (uint64_t) std::min(std::max(std::get<nomic::core::ENTITY_LAYER_DEPTH>(*iter_layer)
+							* RENDER_KEY_DEPTH_SCALE, 0.f), (float) RENDER_KEY_DEPTH_MAX);
+
+						key = (((uint64_t) pass << RENDER_KEY_PASS_SHIFT) | ((uint64_t) iter->first << RENDER_KEY_RENDERER_SHIFT));
+
+						if(pass == RENDER_PASS_TRANSPARENT) { // back-to-front
+							key |= (((RENDER_KEY_DEPTH_MAX - depth) << RENDER_KEY_DEPTH_SHIFT_TRANSPARENT)
+								| ((uint64_t) texture << RENDER_KEY_TEXTURE_SHIFT_TRANSPARENT));
+						} else { // front-to-back
+							key |= (((uint64_t) texture << RENDER_KEY_TEXTURE_SHIFT) | (depth << RENDER_KEY_DEPTH_SHIFT));
+						}
+
+						m_queue.push_back(std::make_tuple(key, rend, *iter_entity, pass, texture));
+					}
+				}
+			}
+
+			queue_sort();
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		manager::queue_sort(void)
+		{
+			size_t count;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			count = m_queue.size();
+			if(count > 1) {
+				m_queue_sorted.resize(count);
+
+				for(uint32_t shift = 0; shift < RENDER_KEY_WIDTH; shift += RENDER_RADIX_WIDTH) {
+					size_t bucket[RENDER_RADIX_BUCKETS] = { 0 }, offset = 0;
+					std::vector<nomic::render::render_item>::iterator iter;
+
+					for(iter = m_queue.begin(); iter != m_queue.end(); ++iter) {
+						++bucket[(std::get<RENDER_ITEM_KEY>(*iter) >> shift) & RENDER_RADIX_MASK];
+					}
+
+					if(bucket[(std::get<RENDER_ITEM_KEY>(m_queue.front()) >> shift) & RENDER_RADIX_MASK] == count) {
+						continue;
+					}
+
+					for(uint32_t index = 0; index < RENDER_RADIX_BUCKETS; ++index) {
+						size_t current = bucket[index];
+						bucket[index] = offset;
+						offset += current;
+					}
+
+					for(iter = m_queue.begin(); iter != m_queue.end(); ++iter) {
+						m_queue_sorted[bucket[(std::get<RENDER_ITEM_KEY>(*iter) >> shift) & RENDER_RADIX_MASK]++] = *iter;
+					}
+
+					m_queue.swap(m_queue_sorted);
+				}
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		size_t 
+		manager::queued(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			if(!m_initialized) {
+				THROW_NOMIC_RENDER_MANAGER_EXCEPTION(NOMIC_RENDER_MANAGER_EXCEPTION_UNINITIALIZED);
+			}
+
+			result = m_queue.size();
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
+			return result;
+		}
+
 		void 
 		manager::register_entity(
 			__in nomic::core::entity *entity,
@@ -291,7 +452,10 @@ namespace nomic {
 			__in bool underwater
 			)
 		{
-			std::map<uint32_t, std::pair<nomic::core::renderer *, std::set<nomic::core::entity *>>>::iterator iter;
+			bool cull = false;
+			nomic::core::entity *entity = nullptr;
+			nomic::core::renderer *rend = nullptr;
+			uint8_t texture = RENDER_TEXTURE_NONE;
 
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE,
 "Position=%p, Rotation=%p, Projection=%p, View=%p, Dimensions={%u, %u}, Textures=%p, Cycle=%f, Delta=%f, Ambient={%f, %f, %f, %f} (Background={%f, %f, %f, %f}, Position={%f, %f, %f}), Clouds=%x, Underwater=%x",
@@ -301,54 +465,120 @@ namespace nomic {
 
 			std::lock_guard<std::mutex> lock(m_mutex);
 
-			for(iter = m_entry.begin(); iter != m_entry.end(); ++iter) {
-				nomic::core::renderer *rend = iter->second.first;
-				std::set<nomic::core::entity *> &entity = iter->second.second;
-
-				if(!rend || entity.empty()) {
-					continue;
-				}
-
-				switch(rend->mode()) {
-					case RENDER_PERSPECTIVE:
-						rend->use(position, rotation, cycle, ambient, ambient_background, ambient_position, clouds, underwater,
-							projection, view);
-						break;
-					default:
-						rend->use(position, rotation, cycle, ambient, ambient_background, ambient_position, clouds, underwater,
-							glm::ortho(0.f, (float) view_dimensions.x, 0.f, (float) view_dimensions.y, -1.f, 1.f));
-						break;
+			queue(position);
+			std::fill(m_state_changes, m_state_changes + (RENDER_STATE_MAX + 1), 0);
+			std::fill(m_state_changes_avoided, m_state_changes_avoided + (RENDER_STATE_MAX + 1), 0);
+			update_frame(position, rotation, projection, glm::ortho(0.f, (float) view_dimensions.x, 0.f,
+				(float) view_dimensions.y, -1.f, 1.f), view, cycle, ambient, ambient_background, ambient_position, clouds,
+				underwater);
+
+			for(std::vector<nomic::render::render_item>::iterator iter = m_queue.begin(); iter != m_queue.end(); ++iter) {
+				bool cull_current;
+				uint32_t pass = std::get<RENDER_ITEM_PASS>(*iter);
+				uint8_t texture_current = std::get<RENDER_ITEM_TEXTURE>(*iter);
+
+				if(rend != std::get<RENDER_ITEM_RENDERER>(*iter)) {
+					rend = std::get<RENDER_ITEM_RENDERER>(*iter);
+
+					rend->use();
+					cull = rend->culled();
+					entity = nullptr;
+					texture = RENDER_TEXTURE_NONE;
+					++m_state_changes[RENDER_STATE_PROGRAM];
+				} else {
+					++m_state_changes_avoided[RENDER_STATE_PROGRAM];
 				}
 
-				for(std::set<nomic::core::entity *>::iterator iter_entity = entity.begin(); iter_entity != entity.end();
-						++iter_entity) {
+				cull_current = (rend->culled() && (pass != RENDER_PASS_DECORATION));
+				if(cull != cull_current) {
 
-					if(!*iter_entity || !(*iter_entity)->shown()) {
-						continue;
+					if(cull_current) {
+						GL_CHECK(LEVEL_WARNING, glEnable, GL_CULL_FACE);
+					} else {
+						GL_CHECK(LEVEL_WARNING, glDisable, GL_CULL_FACE);
 					}
 
-					rend->set_model((*iter_entity)->model());
-					(*iter_entity)->on_render(*rend, &textures, delta);
+					cull = cull_current;
+					++m_state_changes[RENDER_STATE_CULL];
+				} else if(pass == RENDER_PASS_DECORATION) {
+					++m_state_changes_avoided[RENDER_STATE_CULL];
 				}
 
-				if(iter->first == RENDERER_CHUNK) {
-
-					for(std::set<nomic::core::entity *>::iterator iter_entity = entity.begin(); iter_entity != entity.end();
-							++iter_entity) {
+				if(entity != std::get<RENDER_ITEM_ENTITY>(*iter)) {
+					entity = std::get<RENDER_ITEM_ENTITY>(*iter);
+					rend->set_model(entity->model());
+					++m_state_changes[RENDER_STATE_MODEL];
+				} else {
+					++m_state_changes_avoided[RENDER_STATE_MODEL];
+				}
 
-						if(!*iter_entity || !(*iter_entity)->shown()) {
-							continue;
-						}
+				if(texture_current != RENDER_TEXTURE_NONE) {
 
-						rend->set_model((*iter_entity)->model());
-						((nomic::entity::chunk *) (*iter_entity))->on_render_transparent(*rend, &textures, delta);
+					if(texture != texture_current) {
+						textures.enable(texture_current);
+						++m_state_changes[RENDER_STATE_TEXTURE];
+					} else {
+						++m_state_changes_avoided[RENDER_STATE_TEXTURE];
 					}
 				}
+
+				entity->on_render_layer(*rend, &textures, delta, pass, texture_current);
+				texture = texture_current;
 			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
+		uint32_t 
+		manager::state_changes(
+			__in uint32_t state
+			)
+		{
+			uint32_t result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "State=%x(%s)", state, RENDER_STATE_STRING(state));
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			if(!m_initialized) {
+				THROW_NOMIC_RENDER_MANAGER_EXCEPTION(NOMIC_RENDER_MANAGER_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(state > RENDER_STATE_MAX) {
+				THROW_NOMIC_RENDER_MANAGER_EXCEPTION_FORMAT(NOMIC_RENDER_MANAGER_EXCEPTION_STATE_INVALID, "State=%x", state);
+			}
+
+			result = m_state_changes[state];
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
+			return result;
+		}
+
+		uint32_t 
+		manager::state_changes_avoided(
+			__in uint32_t state
+			)
+		{
+			uint32_t result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "State=%x(%s)", state, RENDER_STATE_STRING(state));
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			if(!m_initialized) {
+				THROW_NOMIC_RENDER_MANAGER_EXCEPTION(NOMIC_RENDER_MANAGER_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(state > RENDER_STATE_MAX) {
+				THROW_NOMIC_RENDER_MANAGER_EXCEPTION_FORMAT(NOMIC_RENDER_MANAGER_EXCEPTION_STATE_INVALID, "State=%x", state);
+			}
+
+			result = m_state_changes_avoided[state];
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
+			return result;
+		}
+
 		std::string 
 		manager::to_string(
 			__in_opt bool verbose
@@ -396,6 +626,13 @@ namespace nomic {
 
 					result << "}";
 				}
+
+				result << ", Queue[" << m_queue.size() << "]";
+
+				for(uint32_t state = 0; state <= RENDER_STATE_MAX; ++state) {
+					result << ", " << RENDER_STATE_STRING(state) << "=" << m_state_changes[state]
+						<< " (Avoided=" << m_state_changes_avoided[state] << ")";
+				}
 			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
@@ -477,5 +714,58 @@ namespace nomic {
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
+
+		void 
+		manager::update_frame(
+			__in const glm::vec3 &position,
+			__in const glm::vec3 &rotation,
+			__in const glm::mat4 &projection,
+			__in const glm::mat4 &projection_orthogonal,
+			__in const glm::mat4 &view,
+			__in float cycle,
+			__in const glm::vec4 &ambient,
+			__in const glm::vec4 &ambient_background,
+			__in const glm::vec3 &ambient_position,
+			__in bool clouds,
+			__in bool underwater
+			)
+		{
+			GLuint state;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE,
+"Position={%f, %f, %f}, Rotation={%f, %f, %f}, Projection=%p (Orthogonal=%p), View=%p, Cycle=%f, Ambient={%f, %f, %f, %f} (Background={%f, %f, %f, %f}, Position={%f, %f, %f}), Clouds=%x, Underwater=%x",
+				position.x, position.y, position.z, rotation.x, rotation.y, rotation.z, &projection, &projection_orthogonal, &view,
+				cycle, ambient.x, ambient.y, ambient.z, ambient.w, ambient_background.x, ambient_background.y, ambient_background.z,
+				ambient_background.w, ambient_position.x, ambient_position.y, ambient_position.z, clouds, underwater);
+
+			if(!m_frame) {
+				m_frame = new nomic::graphic::vbo(GL_UNIFORM_BUFFER, UNIFORM_BLOCK_FRAME_SIZE, GL_DYNAMIC_DRAW);
+				if(!m_frame) {
+					THROW_NOMIC_RENDER_MANAGER_EXCEPTION_FORMAT(NOMIC_RENDER_MANAGER_EXCEPTION_ALLOCATE,
+						"%s", "nomic::graphic::vbo");
+				}
+
+				m_frame->bind_base(UNIFORM_BLOCK_FRAME_BINDING);
+			}
+
+			std::memcpy(&m_frame_data[RENDER_FRAME_OFFSET_PROJECTION], glm::value_ptr(projection), sizeof(glm::mat4));
+			std::memcpy(&m_frame_data[RENDER_FRAME_OFFSET_PROJECTION_ORTHOGONAL], glm::value_ptr(projection_orthogonal),
+				sizeof(glm::mat4));
+			std::memcpy(&m_frame_data[RENDER_FRAME_OFFSET_VIEW], glm::value_ptr(view), sizeof(glm::mat4));
+			std::memcpy(&m_frame_data[RENDER_FRAME_OFFSET_AMBIENT], glm::value_ptr(ambient), sizeof(glm::vec4));
+			std::memcpy(&m_frame_data[RENDER_FRAME_OFFSET_AMBIENT_BACKGROUND], glm::value_ptr(ambient_background),
+				sizeof(glm::vec4));
+			std::memcpy(&m_frame_data[RENDER_FRAME_OFFSET_AMBIENT_POSITION], glm::value_ptr(ambient_position), sizeof(glm::vec3));
+			std::memcpy(&m_frame_data[RENDER_FRAME_OFFSET_POSITION], glm::value_ptr(position), sizeof(glm::vec3));
+			std::memcpy(&m_frame_data[RENDER_FRAME_OFFSET_ROTATION], glm::value_ptr(rotation), sizeof(glm::vec3));
+			std::memcpy(&m_frame_data[RENDER_FRAME_OFFSET_CYCLE], &cycle, sizeof(GLfloat));
+			state = (clouds ? GL_TRUE : GL_FALSE);
+			std::memcpy(&m_frame_data[RENDER_FRAME_OFFSET_CLOUDS], &state, sizeof(GLuint));
+			state = (underwater ? GL_TRUE : GL_FALSE);
+			std::memcpy(&m_frame_data[RENDER_FRAME_OFFSET_UNDERWATER], &state, sizeof(GLuint));
+			m_frame->set_subdata(0, m_frame_data.size(), &m_frame_data[0]);
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
 	}
 }
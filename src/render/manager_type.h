@@ -33,24 +33,28 @@ namespace nomic {
 #endif // NDEBUG
 
 		enum {
-			NOMIC_RENDER_MANAGER_EXCEPTION_ENTITY_DUPLICATE = 0,
+			NOMIC_RENDER_MANAGER_EXCEPTION_ALLOCATE = 0,
+			NOMIC_RENDER_MANAGER_EXCEPTION_ENTITY_DUPLICATE,
 			NOMIC_RENDER_MANAGER_EXCEPTION_ENTITY_INVALID,
 			NOMIC_RENDER_MANAGER_EXCEPTION_ENTITY_NOT_FOUND,
 			NOMIC_RENDER_MANAGER_EXCEPTION_RENDERER_INVALID,
 			NOMIC_RENDER_MANAGER_EXCEPTION_RENDERER_INVALID_TYPE,
 			NOMIC_RENDER_MANAGER_EXCEPTION_RENDERER_NOT_FOUND,
+			NOMIC_RENDER_MANAGER_EXCEPTION_STATE_INVALID,
 			NOMIC_RENDER_MANAGER_EXCEPTION_UNINITIALIZED,
 		};
 
 		#define NOMIC_RENDER_MANAGER_EXCEPTION_MAX NOMIC_RENDER_MANAGER_EXCEPTION_UNINITIALIZED
 
 		static const std::string NOMIC_RENDER_MANAGER_EXCEPTION_STR[] = {
+			NOMIC_RENDER_MANAGER_EXCEPTION_HEADER "Failed to allocate render frame buffer",
 			NOMIC_RENDER_MANAGER_EXCEPTION_HEADER "Duplicate entity",
 			NOMIC_RENDER_MANAGER_EXCEPTION_HEADER "Invalid entity",
 			NOMIC_RENDER_MANAGER_EXCEPTION_HEADER "Entity does not exist",
 			NOMIC_RENDER_MANAGER_EXCEPTION_HEADER "Invalid renderer",
 			NOMIC_RENDER_MANAGER_EXCEPTION_HEADER "Invalid renderer type",
 			NOMIC_RENDER_MANAGER_EXCEPTION_HEADER "Renderer does not exist",
+			NOMIC_RENDER_MANAGER_EXCEPTION_HEADER "Invalid render state",
 			NOMIC_RENDER_MANAGER_EXCEPTION_HEADER "Renderer manager is uninitialized",
 			};
 
@@ -16,6 +16,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cctype>
+#include <cstdlib>
 #include "../include/runtime.h"
 #include "./runtime_type.h"
 
@@ -26,6 +28,7 @@ namespace nomic {
 		m_paused(false),
 		m_paused_change(false),
 		m_manager_event(nomic::event::manager::acquire()),
+		m_manager_job(nomic::job::manager::acquire()),
 		m_manager_session(nomic::session::manager::acquire()),
 		m_manager_trace(nomic::trace::acquire()),
 		m_manager_uuid(nomic::uuid::manager::acquire()),
@@ -43,6 +46,7 @@ namespace nomic {
 		TRACE_ENTRY(LEVEL_VERBOSE);
 
 		m_manager_event.release();
+		m_manager_job.release();
 		m_manager_session.release();
 		m_manager_uuid.release();
 
@@ -244,6 +248,7 @@ namespace nomic {
 		TRACE_MESSAGE(LEVEL_INFORMATION, "Runtime initializing...");
 
 		m_manager_uuid.initialize();
+		m_manager_job.initialize();
 		m_manager_event.initialize();
 
 		TRACE_MESSAGE(LEVEL_INFORMATION, "Runtime initialized");
@@ -261,6 +266,32 @@ namespace nomic {
 		bool result = true;
 
 		TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Argv[%u]=%p", argc, argv);
+
+		for(int iter = 1; iter < argc; ++iter) {
+			std::string argument = argv[iter];
+
+			if(argument == RUNTIME_ARGUMENT_VIEW) {
+
+				if((iter + 1) >= argc) {
+					TRACE_MESSAGE_FORMAT(LEVEL_ERROR, "Missing argument value: %s", argument.c_str());
+					result = false;
+					break;
+				}
+
+				m_manager_session.set_view_radius(std::strtoul(argv[++iter], nullptr, 10));
+			} else if(argument == RUNTIME_ARGUMENT_VIEW_GOVERNOR) {
+				float target = VIEW_GOVERNOR_TARGET_DEFAULT;
+
+				if(((iter + 1) < argc) && std::isdigit((unsigned char) argv[iter + 1][0])) {
+					target = std::strtof(argv[++iter], nullptr);
+				}
+
+				m_manager_session.set_view_governor(true, target);
+			} else {
+				TRACE_MESSAGE_FORMAT(LEVEL_WARNING, "Unsupported argument: %s", argument.c_str());
+			}
+		}
+
 		TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
 		return result;
 	}
@@ -291,6 +322,7 @@ namespace nomic {
 	runtime::on_run(void)
 	{
 		bool result = false;
+		uint64_t begin;
 		float delta, delta_previous = 0.f;
 		uint32_t duration, frame, next, skip;
 
@@ -298,6 +330,7 @@ namespace nomic {
 
 		TRACE_MESSAGE(LEVEL_INFORMATION, "Runtime loop entered");
 
+		m_manager_job.set_main();
 		m_manager_session.set_runtime(this);
 		m_manager_session.initialize();
 		duration = (MILLISECONDS_PER_SECOND / RUNTIME_TICKS_PER_SECOND);
@@ -311,6 +344,12 @@ namespace nomic {
 				break;
 			}
 
+			// main-affinity jobs (chunk uploads, joins) count toward the governor frame cost
+			begin = SDL_GetPerformanceCounter();
+			m_manager_job.run_main();
+			m_manager_session.add_view_cost(((SDL_GetPerformanceCounter() - begin) * MILLISECONDS_PER_SECOND)
+				/ (float) SDL_GetPerformanceFrequency());
+
 			if(!m_paused) {
 
 				if(m_paused_change) {
@@ -412,6 +451,7 @@ namespace nomic {
 		}
 
 		m_manager_event.uninitialize();
+		m_manager_job.uninitialize();
 		m_manager_uuid.uninitialize();
 
 		TRACE_MESSAGE(LEVEL_INFORMATION, "Runtime uninitialized");
@@ -22,6 +22,7 @@
 #include "../../include/core/renderer.h"
 #include "../../include/entity/axis.h"
 #include "../../include/entity/block.h"
+#include "../../include/entity/cloud.h"
 #include "../../include/entity/diagnostic.h"
 #include "../../include/entity/message.h"
 #include "../../include/entity/panel.h"
@@ -52,6 +53,10 @@ namespace nomic {
 			RENDERER_DEPTH_MODE,
 		};
 
+		#define STREAM_WINDOW_CONTAINS(_CENTER_, _RADIUS_, _X_, _Z_) \
+			(((_X_) >= ((_CENTER_).x - (_RADIUS_))) && ((_X_) < ((_CENTER_).x + (_RADIUS_))) \
+				&& ((_Z_) >= ((_CENTER_).y - (_RADIUS_))) && ((_Z_) < ((_CENTER_).y + (_RADIUS_))))
+
 		typedef std::tuple<std::string, std::string, uint32_t, bool, uint32_t, uint32_t, bool, uint32_t, bool, uint32_t> renderer_config;
 
 		static const renderer_config BACKDROP_RENDERER_CONFIGURATION = {
@@ -102,9 +107,10 @@ namespace nomic {
 		enum {
 			ENTITY_OBJECT_BACKGROUND_SKYBOX = 0,
 			ENTITY_OBJECT_BACKGROUND_SUN,
+			ENTITY_OBJECT_BACKGROUND_CLOUD,
 		};
 
-		#define ENTITY_OBJECT_BACKGROUND_MAX ENTITY_OBJECT_BACKGROUND_SUN
+		#define ENTITY_OBJECT_BACKGROUND_MAX ENTITY_OBJECT_BACKGROUND_CLOUD
 
 		static const std::vector<renderer_config> ENTITY_RENDERER_BACKGROUND_CONFIGURATION = {
 			{ "./asset/shader/vert_skybox.glsl", "./asset/shader/frag_skybox.glsl", RENDER_PERSPECTIVE, RENDERER_BLEND_DEFAULT,
@@ -113,6 +119,9 @@ namespace nomic {
 			{ "./asset/shader/vert_sun.glsl", "./asset/shader/frag_sun.glsl", RENDER_PERSPECTIVE, RENDERER_BLEND_DEFAULT,
 				RENDERER_BLEND_DFACTOR_DEFAULT, RENDERER_BLEND_SFACTOR_DEFAULT, RENDERER_CULL_DEFAULT, GL_FRONT,
 				false, RENDERER_DEPTH_MODE_DEFAULT }, // sun
+			{ "./asset/shader/vert_cloud.glsl", "./asset/shader/frag_cloud.glsl", RENDER_PERSPECTIVE, RENDERER_BLEND_DEFAULT,
+				RENDERER_BLEND_DFACTOR_DEFAULT, RENDERER_BLEND_SFACTOR_DEFAULT, RENDERER_CULL_DEFAULT, RENDERER_CULL_MODE_DEFAULT,
+				RENDERER_DEPTH_DEFAULT, RENDERER_DEPTH_MODE_DEFAULT }, // cloud
 			};
 
 		static const std::map<uint32_t, std::string> ENTITY_SKYBOX_FACE = {
@@ -153,8 +162,8 @@ namespace nomic {
 			BLOCK_SAND,
 			BLOCK_GLASS,
 			BLOCK_WOOD_OAK,
-			BLOCK_LEAVES_OAK,
 			BLOCK_PLANK_OAK,
+			BLOCK_LAMP,
 			};
 
 		static const std::map<SDL_GLattr, GLint> SDL_ATTRIBUTE = {
@@ -177,17 +186,30 @@ namespace nomic {
 			m_block_selected(false),
 			m_block_selected_face(BLOCK_FACE_UNDEFINED),
 			m_camera(nullptr),
+			m_chunk_heading(0.f, 0.f),
+			m_chunk_inflight(0),
+			m_chunk_predicted(0, 0),
+			m_chunk_previous(0.f, 0.f, 0.f),
 			m_chunk_renderer(nullptr),
+			m_chunk_velocity(0.f, 0.f, 0.f),
 			m_clouds(false),
 			m_debug(SESSION_DEBUG_DEFAULT),
 			m_manager_display(nomic::graphic::display::acquire()),
 			m_manager_entity(nomic::entity::manager::acquire()),
 			m_manager_font(nomic::font::manager::acquire()),
 			m_manager_graphic(nomic::graphic::manager::acquire()),
+			m_manager_job(nomic::job::manager::acquire()),
 			m_manager_render(nomic::render::manager::acquire()),
 			m_manager_terrain(nomic::terrain::manager::acquire()),
 			m_runtime(nullptr),
-			m_underwater(false)
+			m_underwater(false),
+			m_view_changed(false),
+			m_view_cost(0.f),
+			m_view_cost_update(0.f),
+			m_view_frame(0),
+			m_view_governor(VIEW_GOVERNOR_DEFAULT),
+			m_view_governor_target(VIEW_GOVERNOR_TARGET_DEFAULT),
+			m_view_radius(VIEW_RADIUS_DEFAULT)
 		{
 			TRACE_ENTRY(LEVEL_VERBOSE);
 			TRACE_EXIT(LEVEL_VERBOSE);
@@ -201,12 +223,29 @@ namespace nomic {
 			m_manager_entity.release();
 			m_manager_font.release();
 			m_manager_graphic.release();
+			m_manager_job.release();
 			m_manager_render.release();
 			m_manager_terrain.release();
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
+		void 
+		manager::add_view_cost(
+			__in float cost
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Cost=%f ms", cost);
+
+			if(!m_initialized) {
+				THROW_NOMIC_SESSION_MANAGER_EXCEPTION(NOMIC_SESSION_MANAGER_EXCEPTION_UNINITIALIZED);
+			}
+
+			m_view_cost_update += cost;
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
 		glm::vec3 
 		manager::ambient_position(void)
 		{
@@ -275,77 +314,331 @@ namespace nomic {
 		}
 
 		void 
-		manager::generate_chunks_runtime(void)
+		manager::generate_chunk(
+			__in const glm::ivec2 &position,
+			__in nomic::terrain::generator &generator
+			)
+		{
+			nomic::terrain::chunk entry;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%i, %i}, Generator=%p", position.x, position.y, &generator);
+
+			std::unique_lock<std::mutex> lock(m_chunk_mutex);
+
+			if(m_chunk_pending.find(std::make_pair(position.x, position.y)) == m_chunk_pending.end()) { // cancelled
+				--m_chunk_inflight;
+				TRACE_EXIT(LEVEL_VERBOSE);
+				return;
+			}
+
+			lock.unlock();
+			generator.chunk(position, entry);
+			lock.lock();
+
+			// a chunk cancelled mid-generation still counted against the in-flight limit until now
+			if(m_chunk_pending.find(std::make_pair(position.x, position.y)) != m_chunk_pending.end()) {
+				m_chunk_generated.insert(std::make_pair(std::make_pair(position.x, position.y), entry));
+			}
+
+			--m_chunk_inflight;
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		float 
+		manager::generate_chunk_priority(
+			__in const glm::ivec2 &position,
+			__inout bool &visible
+			)
+		{
+			float alignment = 1.f, distance, result;
+			glm::vec3 position_camera = m_camera->position();
+			glm::vec2 offset = glm::vec2(((position.x + 0.5f) * CHUNK_WIDTH) - position_camera.x,
+				((position.y + 0.5f) * CHUNK_WIDTH) - position_camera.z);
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%i, %i}", position.x, position.y);
+
+			distance = glm::length(offset);
+
+			visible = true;
+			if(distance > STREAM_CHUNK_RADIUS) {
+				float angle, aspect = 1.f;
+				glm::uvec2 dimensions = m_camera->dimensions();
+
+				if(dimensions.y) {
+					aspect = (dimensions.x / (float) dimensions.y);
+				}
+
+				angle = (std::atan(std::tan(glm::radians(m_camera->fov()) / 2.f) * aspect)
+					+ std::asin(STREAM_CHUNK_RADIUS / distance));
+				alignment = glm::dot(offset / distance, m_chunk_heading);
+				visible = (alignment >= std::cos(std::min(angle, glm::pi<float>())));
+			}
+
+			result = ((distance / CHUNK_WIDTH) * (1.f + (STREAM_WEIGHT_ALIGNMENT * ((1.f - alignment) / 2.f))));
+			if(!visible) {
+				result *= STREAM_WEIGHT_HIDDEN;
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%f, Visible=%x", result, visible);
+			return result;
+		}
+
+		void 
+		manager::generate_chunks_join(void)
 		{
 			glm::vec3 position;
 			glm::ivec2 position_chunk;
+			int32_t radius = m_view_radius;
+			std::map<std::pair<int32_t, int32_t>, nomic::terrain::chunk> generated;
 
 			TRACE_ENTRY(LEVEL_VERBOSE);
 
+			std::unique_lock<std::mutex> lock(m_chunk_mutex);
+
+			generated.swap(m_chunk_generated);
+
+			for(std::map<std::pair<int32_t, int32_t>, nomic::terrain::chunk>::iterator iter = generated.begin();
+					iter != generated.end(); ++iter) {
+				m_chunk_pending.erase(iter->first);
+			}
+
+			lock.unlock();
+
+			for(std::map<std::pair<int32_t, int32_t>, nomic::terrain::chunk>::iterator iter = generated.begin();
+					iter != generated.end(); ++iter) {
+
+				nomic::entity::chunk *entry = m_manager_terrain.insert(iter->second);
+				if(!entry) {
+					THROW_NOMIC_SESSION_MANAGER_EXCEPTION_FORMAT(NOMIC_SESSION_MANAGER_EXCEPTION_ALLOCATE,
+						"Position={%i, %i}", iter->first.first, iter->first.second);
+				}
+
+				entry->enable(false);
+				entry->show(false);
+				entry->register_renderer(m_chunk_renderer->type());
+			}
+
 			position = m_camera->position();
 			position_chunk = glm::ivec2(position.x / CHUNK_WIDTH, position.z / CHUNK_WIDTH);
 
-			for(int32_t z = -VIEW_RADIUS_RUNTIME; z < VIEW_RADIUS_RUNTIME; ++z) {
+			for(uint32_t iter = 0; iter < ((m_chunk_predicted != position_chunk) ? 2 : 1); ++iter) {
+				const glm::ivec2 &center = (iter ? m_chunk_predicted : position_chunk);
 
-				for(int32_t x = -VIEW_RADIUS_RUNTIME; x < VIEW_RADIUS_RUNTIME; ++x) {
-					glm::ivec2 position_chunk_offset = glm::ivec2(position_chunk.x + x, position_chunk.y + z);
+				for(int32_t z = -radius; z < radius; ++z) {
 
-					if(!m_manager_terrain.contains(position_chunk_offset)) {
+					for(int32_t x = -radius; x < radius; ++x) {
+						glm::ivec2 position_chunk_offset = glm::ivec2(center.x + x, center.y + z);
 
-						nomic::entity::chunk *entry = m_manager_terrain.at(position_chunk_offset);
-						if(!entry) {
-							THROW_NOMIC_SESSION_MANAGER_EXCEPTION_FORMAT(NOMIC_SESSION_MANAGER_EXCEPTION_ALLOCATE,
-								"Position={%i, %i}", position_chunk_offset.x, position_chunk_offset.y);
+						if(!m_manager_terrain.contains(position_chunk_offset)) { // still streaming in
+							continue;
 						}
 
-						entry->enable(false);
-						entry->show(false);
-						entry->register_renderer(m_chunk_renderer->type());
+						nomic::entity::chunk *chunk_ref = m_manager_terrain.at(position_chunk_offset, false);
+						if(!chunk_ref || chunk_ref->enabled()) {
+							continue;
+						}
+
+						uint32_t count = 0;
+						nomic::entity::chunk *back = nullptr, *front = nullptr, *left = nullptr, *right = nullptr;
+
+						if(m_manager_terrain.contains(glm::ivec2(position_chunk_offset.x + 1, position_chunk_offset.y))) { // right
+							right = m_manager_terrain.at(glm::ivec2(position_chunk_offset.x + 1, position_chunk_offset.y), false);
+							++count;
+						}
+
+						if(m_manager_terrain.contains(glm::ivec2(position_chunk_offset.x - 1, position_chunk_offset.y))) { // left
+							left = m_manager_terrain.at(glm::ivec2(position_chunk_offset.x - 1, position_chunk_offset.y), false);
+							++count;
+						}
+
+						if(m_manager_terrain.contains(glm::ivec2(position_chunk_offset.x, position_chunk_offset.y + 1))) { // back
+							back = m_manager_terrain.at(glm::ivec2(position_chunk_offset.x, position_chunk_offset.y + 1), false);
+							++count;
+						}
+
+						if(m_manager_terrain.contains(glm::ivec2(position_chunk_offset.x, position_chunk_offset.y - 1))) { // front
+							front = m_manager_terrain.at(glm::ivec2(position_chunk_offset.x, position_chunk_offset.y - 1), false);
+							++count;
+						}
+
+						if(count > CHUNK_ADJOIN_MIN) {
+							chunk_ref->update(right, left, back, front);
+							chunk_ref->enable(true);
+						} else {
+							chunk_ref->enable(false);
+						}
 					}
 				}
 			}
 
-			for(int32_t z = -VIEW_RADIUS_RUNTIME; z < VIEW_RADIUS_RUNTIME; ++z) {
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		manager::generate_chunks_queue(void)
+		{
+			bool visible;
+			glm::vec3 position;
+			glm::ivec2 position_chunk;
+			int32_t radius = m_view_radius;
 
-				for(int32_t x = -VIEW_RADIUS_RUNTIME; x < VIEW_RADIUS_RUNTIME; ++x) {
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			position = m_camera->position();
+			position_chunk = glm::ivec2(position.x / CHUNK_WIDTH, position.z / CHUNK_WIDTH);
+
+			std::unique_lock<std::mutex> lock(m_chunk_mutex);
+
+			for(std::set<std::pair<int32_t, int32_t>>::iterator iter = m_chunk_pending.begin(); iter != m_chunk_pending.end();) {
+
+				if(!STREAM_WINDOW_CONTAINS(position_chunk, radius, iter->first, iter->second)
+						&& !STREAM_WINDOW_CONTAINS(m_chunk_predicted, radius, iter->first, iter->second)) {
+					iter = m_chunk_pending.erase(iter);
+				} else {
+					++iter;
+				}
+			}
+
+			lock.unlock();
+
+			// the margin keeps chunks at the window edge from thrashing between eviction and regeneration
+			m_manager_terrain.evict(position_chunk, m_chunk_predicted, radius + STREAM_EVICT_MARGIN);
+
+			m_chunk_queue = std::priority_queue<std::pair<float, std::pair<int32_t, int32_t>>, std::vector<std::pair<float,
+				std::pair<int32_t, int32_t>>>, std::greater<std::pair<float, std::pair<int32_t, int32_t>>>>();
+
+			for(int32_t z = -radius; z < radius; ++z) {
+
+				for(int32_t x = -radius; x < radius; ++x) {
 					glm::ivec2 position_chunk_offset = glm::ivec2(position_chunk.x + x, position_chunk.y + z);
-					nomic::entity::chunk *chunk_ref = m_manager_terrain.at(glm::ivec2(position_chunk_offset.x,
-						position_chunk_offset.y), false);
 
-					if(!chunk_ref || chunk_ref->enabled()) {
-						continue;
+					if(!m_manager_terrain.contains(position_chunk_offset)) {
+						float priority = generate_chunk_priority(position_chunk_offset, visible);
+
+						m_chunk_queue.push(std::make_pair(priority, std::make_pair(position_chunk_offset.x,
+							position_chunk_offset.y)));
 					}
+				}
+			}
 
-					uint32_t count = 0;
-					nomic::entity::chunk *back = nullptr, *front = nullptr, *left = nullptr, *right = nullptr;
+			if(m_chunk_predicted != position_chunk) { // prefetch
 
-					if(m_manager_terrain.contains(glm::ivec2(position_chunk_offset.x + 1, position_chunk_offset.y))) { // right
-						right = m_manager_terrain.at(glm::ivec2(position_chunk_offset.x + 1, position_chunk_offset.y), false);
-						++count;
-					}
+				for(int32_t z = -radius; z < radius; ++z) {
 
-					if(m_manager_terrain.contains(glm::ivec2(position_chunk_offset.x - 1, position_chunk_offset.y))) { // left
-						left = m_manager_terrain.at(glm::ivec2(position_chunk_offset.x - 1, position_chunk_offset.y), false);
-						++count;
-					}
+					for(int32_t x = -radius; x < radius; ++x) {
+						glm::ivec2 position_chunk_offset = glm::ivec2(m_chunk_predicted.x + x, m_chunk_predicted.y + z);
 
-					if(m_manager_terrain.contains(glm::ivec2(position_chunk_offset.x, position_chunk_offset.y + 1))) { // back
-						back = m_manager_terrain.at(glm::ivec2(position_chunk_offset.x, position_chunk_offset.y + 1), false);
-						++count;
-					}
+						if(STREAM_WINDOW_CONTAINS(position_chunk, radius, position_chunk_offset.x, position_chunk_offset.y)
+								|| m_manager_terrain.contains(position_chunk_offset)) {
+							continue;
+						}
+
+						float priority = (STREAM_PREFETCH_PRIORITY + generate_chunk_priority(position_chunk_offset, visible));
 
-					if(m_manager_terrain.contains(glm::ivec2(position_chunk_offset.x, position_chunk_offset.y - 1))) { // front
-						front = m_manager_terrain.at(glm::ivec2(position_chunk_offset.x, position_chunk_offset.y - 1), false);
-						++count;
+						m_chunk_queue.push(std::make_pair(priority, std::make_pair(position_chunk_offset.x,
+							position_chunk_offset.y)));
 					}
+				}
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Queue[%u]", m_chunk_queue.size());
+		}
+
+		void 
+		manager::generate_chunks_runtime(void)
+		{
+			bool join, visible;
+			glm::vec2 heading;
+			glm::ivec2 predicted;
+			std::vector<uint32_t> dependency;
+			glm::vec3 delta, position, rotation;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			for(std::vector<uint32_t>::iterator iter = m_chunk_job.begin(); iter != m_chunk_job.end();) {
+
+				if(m_manager_job.complete(*iter)) {
+					iter = m_chunk_job.erase(iter);
+				} else {
+					++iter;
+				}
+			}
+
+			rotation = m_camera->rotation();
+			heading = glm::vec2(rotation.x, rotation.z);
+			if(glm::length(heading) > 0.f) {
+				heading = glm::normalize(heading);
+			}
+
+			position = m_camera->position();
+			delta = (position - m_chunk_previous);
+			m_chunk_previous = position;
+
+			if(glm::length(delta) > STREAM_PREFETCH_DELTA_MAX) { // teleport
+				m_chunk_velocity = glm::vec3(0.f, 0.f, 0.f);
+			} else {
+				m_chunk_velocity = glm::mix(m_chunk_velocity, delta * (float) RUNTIME_TICKS_PER_SECOND, STREAM_PREFETCH_SMOOTHING);
+			}
+
+			position += (m_chunk_velocity * STREAM_PREFETCH_TIME);
+			predicted = glm::ivec2(position.x / CHUNK_WIDTH, position.z / CHUNK_WIDTH);
+
+			join = m_camera->chunk_changed();
+			if(join || m_view_changed || (predicted != m_chunk_predicted)
+					|| (glm::dot(heading, m_chunk_heading) < STREAM_HEADING_THRESHOLD)) {
+				m_chunk_heading = heading;
+				m_chunk_predicted = predicted;
+				m_view_changed = false;
+				generate_chunks_queue();
+			}
+
+			while(!m_chunk_queue.empty()) {
+				uint32_t priority = JOB_PRIORITY_NORMAL;
+				float score = m_chunk_queue.top().first;
+				std::pair<int32_t, int32_t> entry = m_chunk_queue.top().second;
+				glm::ivec2 position_chunk = glm::ivec2(entry.first, entry.second);
+
+				std::unique_lock<std::mutex> lock(m_chunk_mutex);
+
+				if(m_chunk_inflight >= STREAM_INFLIGHT_MAX) { // cancelled jobs still count until they finish
+					break;
+				}
 
-					if(count > CHUNK_ADJOIN_MIN) {
-						chunk_ref->update(right, left, back, front);
-						chunk_ref->enable(true);
-					} else {
-						chunk_ref->enable(false);
+				m_chunk_queue.pop();
+
+				if((m_chunk_pending.find(entry) != m_chunk_pending.end()) || m_manager_terrain.contains(position_chunk)) {
+					continue;
+				}
+
+				m_chunk_pending.insert(entry);
+				++m_chunk_inflight;
+				lock.unlock();
+
+				if(!m_manager_job.initialized()) {
+					generate_chunk(position_chunk, m_manager_terrain.generator());
+					join = true;
+					continue;
+				}
+
+				if(score >= STREAM_PREFETCH_PRIORITY) {
+					priority = JOB_PRIORITY_LOW;
+				} else {
+					generate_chunk_priority(position_chunk, visible);
+					if(visible) {
+						priority = JOB_PRIORITY_HIGH;
 					}
 				}
+
+				dependency.push_back(m_manager_job.add(std::bind(&manager::generate_chunk, this, position_chunk,
+					m_manager_terrain.generator()), priority));
+			}
+
+			if(!dependency.empty()) {
+				m_chunk_job.push_back(m_manager_job.add(std::bind(&manager::generate_chunks_join, this), JOB_PRIORITY_NORMAL,
+					JOB_AFFINITY_MAIN, dependency));
+			} else if(join) {
+				generate_chunks_join();
 			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
@@ -358,7 +651,10 @@ namespace nomic {
 			std::vector<nomic::entity::plain *> backdrop;
 			nomic::entity::diagnostic *diagnostic = nullptr;
 			nomic::graphic::bitmap *backdrop_texture = nullptr;
-			uint32_t completed = 0, current, previous = 0, total = (VIEW_WIDTH * VIEW_WIDTH);
+			std::vector<uint32_t> job;
+			glm::vec3 position_camera;
+			glm::ivec2 position_chunk;
+			uint32_t completed = 0, current, previous = 0, total;
 			nomic::core::renderer *backdrop_renderer = nullptr, *diagnostic_renderer = nullptr, *message_renderer = nullptr;
 
 			TRACE_ENTRY(LEVEL_VERBOSE);
@@ -468,85 +764,59 @@ namespace nomic {
 			update();
 			render();
 
-			for(int32_t z = -VIEW_RADIUS_SPAWN; z < VIEW_RADIUS_SPAWN; ++z) {
+			position_camera = m_camera->position();
+			position_chunk = glm::ivec2(FLOOR_DIVIDE((int32_t) position_camera.x, CHUNK_WIDTH),
+				FLOOR_DIVIDE((int32_t) position_camera.z, CHUNK_WIDTH));
 
-				for(int32_t x = -VIEW_RADIUS_SPAWN; x < VIEW_RADIUS_SPAWN; ++x, ++completed) {
+			for(int32_t ring = 0; ring <= VIEW_RADIUS_SPAWN; ++ring) {
 
-					current = (100 * (completed / (float) total));
-					if(current && (current != previous)) {
-						std::stringstream stream;
-						stream << "Generating chunk objects... " << current << "%";
-						message->text() = stream.str();
-						update();
-						render();
-						previous = current;
-					}
-
-					nomic::entity::chunk *entry = m_manager_terrain.at(glm::ivec2(x, z));
-					if(!entry) {
-						THROW_NOMIC_SESSION_MANAGER_EXCEPTION_FORMAT(NOMIC_SESSION_MANAGER_EXCEPTION_ALLOCATE,
-							"Position={%i, %i}", x, z);
-					}
-
-					entry->enable(false);
-					entry->show(false);
-					entry->register_renderer(m_chunk_renderer->type());
-				}
-			}
+				for(int32_t z = -ring; z <= ring; ++z) {
 
-			completed = 0;
+					for(int32_t x = -ring; x <= ring; ++x) {
 
-			for(int32_t z = -VIEW_RADIUS_SPAWN; z < VIEW_RADIUS_SPAWN; ++z) {
-
-				for(int32_t x = -VIEW_RADIUS_SPAWN; x < VIEW_RADIUS_SPAWN; ++x, ++completed) {
-
-					current = (100 * (completed / (float) total));
-					if(current && (current != previous)) {
-						std::stringstream stream;
-						stream << "Joining chunk objects... " << current << "%";
-						message->text() = stream.str();
-						update();
-						render();
-						previous = current;
-					}
+						if((std::abs(x) != ring) && (std::abs(z) != ring)) {
+							continue;
+						}
 
-					nomic::entity::chunk *chunk_ref = m_manager_terrain.at(glm::ivec2(x, z), false);
-					if(!chunk_ref || chunk_ref->enabled()) {
-						continue;
-					}
+						glm::ivec2 position_chunk_offset = glm::ivec2(position_chunk.x + x, position_chunk.y + z);
 
-					uint32_t count = 0;
-					nomic::entity::chunk *back = nullptr, *front = nullptr, *left = nullptr, *right = nullptr;
+						std::unique_lock<std::mutex> lock(m_chunk_mutex);
+						m_chunk_pending.insert(std::make_pair(position_chunk_offset.x, position_chunk_offset.y));
+						++m_chunk_inflight;
+						lock.unlock();
 
-					if(m_manager_terrain.contains(glm::ivec2(x + 1, z))) { // right
-						right = m_manager_terrain.at(glm::ivec2(x + 1, z), false);
-						++count;
-					}
+						if(!m_manager_job.initialized()) {
+							generate_chunk(position_chunk_offset, m_manager_terrain.generator());
+							continue;
+						}
 
-					if(m_manager_terrain.contains(glm::ivec2(x - 1, z))) { // left
-						left = m_manager_terrain.at(glm::ivec2(x - 1, z), false);
-						++count;
+						job.push_back(m_manager_job.add(std::bind(&manager::generate_chunk, this, position_chunk_offset,
+							m_manager_terrain.generator()), JOB_PRIORITY_HIGH));
 					}
+				}
+			}
 
-					if(m_manager_terrain.contains(glm::ivec2(x, z + 1))) { // back
-						back = m_manager_terrain.at(glm::ivec2(x, z + 1), false);
-						++count;
-					}
+			total = job.size();
 
-					if(m_manager_terrain.contains(glm::ivec2(x, z - 1))) { // front
-						front = m_manager_terrain.at(glm::ivec2(x, z - 1), false);
-						++count;
-					}
+			for(std::vector<uint32_t>::iterator iter = job.begin(); iter != job.end(); ++iter, ++completed) {
+				m_manager_job.wait(*iter);
 
-					if(count > CHUNK_ADJOIN_MIN) {
-						chunk_ref->update(right, left, back, front);
-						chunk_ref->enable(true);
-					} else {
-						chunk_ref->enable(false);
-					}
+				current = (100 * (completed / (float) total));
+				if(current && (current != previous)) {
+					std::stringstream stream;
+					stream << "Generating chunk objects... " << current << "%";
+					message->text() = stream.str();
+					update();
+					render();
+					previous = current;
 				}
 			}
 
+			message->text() = "Joining chunk objects...";
+			update();
+			render();
+			generate_chunks_join();
+
 			for(std::vector<nomic::entity::plain *>::iterator iter = backdrop.begin(); iter != backdrop.end(); ++iter) {
 
 				if(*iter) {
@@ -652,6 +922,9 @@ namespace nomic {
 					case ENTITY_OBJECT_BACKGROUND_SUN:
 						type = RENDERER_BACKGROUND_SUN;
 						break;
+					case ENTITY_OBJECT_BACKGROUND_CLOUD:
+						type = RENDERER_BACKGROUND_CLOUD;
+						break;
 					default:
 						break;
 				}
@@ -687,6 +960,9 @@ namespace nomic {
 					case ENTITY_OBJECT_BACKGROUND_SUN:
 						m_entity_object_background.push_back(new nomic::entity::sun);
 						break;
+					case ENTITY_OBJECT_BACKGROUND_CLOUD:
+						m_entity_object_background.push_back(new nomic::entity::cloud(m_manager_terrain.generator().seed()));
+						break;
 					default:
 						break;
 				}
@@ -900,6 +1176,27 @@ namespace nomic {
 				m_camera->key(scancode, modifier, state);
 			}
 
+			if(state == SDL_PRESSED) {
+
+				switch(scancode) {
+					case KEY_VIEW_DECREASE:
+						set_view_radius(m_view_radius - 1);
+						break;
+					case KEY_VIEW_GOVERNOR:
+						set_view_governor(!m_view_governor, m_view_governor_target);
+						break;
+					case KEY_VIEW_INCREASE:
+						set_view_radius(m_view_radius + 1);
+						break;
+					default:
+
+						if(m_debug && m_block_selected) {
+							region_edit(scancode);
+						}
+						break;
+				}
+			}
+
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
@@ -977,6 +1274,7 @@ namespace nomic {
 
 			m_camera->enable(false);
 			m_camera->show(false);
+			m_camera->set_view_radius(m_view_radius);
 			m_clouds = false;
 			m_manager_display.set_icon(DISPLAY_DEFAULT_ICON);
 			m_random_float.setup(m_manager_terrain.generator().seed());
@@ -984,11 +1282,11 @@ namespace nomic {
 			m_underwater = false;
 
 			initialize_entities();
+			set_view_radius(m_view_radius);
 			generate_spawn_location();
 
 			nomic::event::input::sync();
-			nomic::core::thread::start(true);
-			nomic::core::thread::notify();
+			generate_chunks_runtime();
 
 			TRACE_MESSAGE(LEVEL_INFORMATION, "Session manager initialized");
 
@@ -1015,19 +1313,6 @@ namespace nomic {
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
-		bool 
-		manager::on_run(void)
-		{
-			bool result = true;
-
-			TRACE_ENTRY(LEVEL_VERBOSE);
-
-			generate_chunks_runtime();
-
-			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
-			return result;
-		}
-
 		void 
 		manager::on_uninitialize(void)
 		{
@@ -1035,7 +1320,24 @@ namespace nomic {
 
 			TRACE_MESSAGE(LEVEL_INFORMATION, "Session manager uninitializing...");
 
-			nomic::core::thread::stop();
+			for(std::vector<uint32_t>::iterator iter = m_chunk_job.begin(); iter != m_chunk_job.end(); ++iter) {
+
+				if(m_manager_job.initialized()) {
+					m_manager_job.wait(*iter);
+				}
+			}
+
+			m_chunk_job.clear();
+			m_chunk_generated.clear();
+			m_chunk_heading = glm::vec2(0.f, 0.f);
+			m_chunk_inflight = 0;
+			m_chunk_pending.clear();
+			m_chunk_predicted = glm::ivec2(0, 0);
+			m_chunk_previous = glm::vec3(0.f, 0.f, 0.f);
+			m_chunk_queue = std::priority_queue<std::pair<float, std::pair<int32_t, int32_t>>, std::vector<std::pair<float,
+				std::pair<int32_t, int32_t>>>, std::greater<std::pair<float, std::pair<int32_t, int32_t>>>>();
+			m_chunk_velocity = glm::vec3(0.f, 0.f, 0.f);
+			m_water.clear();
 
 			uninitialize_entities();
 
@@ -1130,13 +1432,72 @@ namespace nomic {
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
+		void 
+		manager::region_edit(
+			__in uint16_t scancode
+			)
+		{
+			uint32_t count = 0;
+			std::vector<std::pair<glm::ivec2, glm::uvec3>> boundary;
+			glm::ivec3 extent(REGION_DEBUG_EXTENT, REGION_DEBUG_EXTENT, REGION_DEBUG_EXTENT), position;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Scancode=%x", scancode);
+
+			uint8_t type = ((nomic::entity::panel *) m_entity_object_foreground.at(ENTITY_OBJECT_FOREGROUND_PANEL))->selected();
+			position = glm::ivec3((m_block_selected_chunk.x * CHUNK_WIDTH) + m_block_selected_block.x, m_block_selected_block.y,
+				(m_block_selected_chunk.y * CHUNK_WIDTH) + m_block_selected_block.z);
+
+			switch(scancode) {
+				case KEY_REGION_CLEAR:
+					count = m_manager_terrain.region_sphere(position, REGION_DEBUG_RADIUS, BLOCK_AIR, BLOCK_ATTRIBUTES_DEFAULT,
+						&boundary);
+					break;
+				case KEY_REGION_COPY:
+					m_region = m_manager_terrain.region_copy(position - extent, position + extent);
+					TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Region copied. Position={%i, %i, %i}", position.x, position.y,
+						position.z);
+					break;
+				case KEY_REGION_FILL:
+					count = m_manager_terrain.region_fill(position - extent, position + extent, type, BLOCK_ATTRIBUTES_DEFAULT,
+						&boundary);
+					break;
+				case KEY_REGION_PASTE:
+					count = m_manager_terrain.region_paste(position, m_region, &boundary);
+					break;
+				case KEY_REGION_REPLACE:
+					count = m_manager_terrain.region_replace(position - extent, position + extent,
+						m_manager_terrain.at(m_block_selected_chunk)->block_type(m_block_selected_block), type,
+						BLOCK_ATTRIBUTES_DEFAULT, &boundary);
+					break;
+				default:
+					break;
+			}
+
+			if(count) {
+				TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Region edited. Position={%i, %i, %i}, Count=%u", position.x, position.y,
+					position.z, count);
+
+				for(std::vector<std::pair<glm::ivec2, glm::uvec3>>::iterator iter = boundary.begin(); iter != boundary.end();
+						++iter) { // wake water along the whole edited surface, not just the selected block
+					m_water.activate(iter->first, iter->second);
+				}
+
+				m_block_selected = false;
+				m_block_selected_face = BLOCK_FACE_UNDEFINED;
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
 		void 
 		manager::render(
 			__in_opt float delta
 			)
 		{
+			float cost;
 			glm::vec3 position = glm::vec3(0.f);
 			nomic::entity::sun *sun_ref = nullptr;
+			uint64_t begin = SDL_GetPerformanceCounter();
 			glm::vec4 color = glm::vec4(1.f), color_background = glm::vec4(1.f);
 
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Delta=%f", delta);
@@ -1162,7 +1523,17 @@ namespace nomic {
 			m_manager_render.render(m_camera->position(), m_camera->rotation(), m_camera->projection(), m_camera->view(),
 				m_camera->dimensions(), *m_atlas, ((nomic::runtime *) m_runtime)->tick_cycle(), delta, color, color_background,
 				position, m_clouds, m_underwater);
+
+			cost = ((((SDL_GetPerformanceCounter() - begin) * MILLISECONDS_PER_SECOND) / (float) SDL_GetPerformanceFrequency())
+				+ m_view_cost_update);
+			m_view_cost_update = 0.f;
+
 			m_manager_display.show();
+			m_manager_graphic.flush();
+
+			if(m_view_governor) {
+				update_view(cost);
+			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
@@ -1320,6 +1691,7 @@ namespace nomic {
 							type, chunk.x, chunk.y, block.x, block.y, block.z);
 
 						m_manager_terrain.at(chunk)->set_block(block, type, attribute, true);
+						m_water.activate(chunk, block);
 						m_block_selected = false;
 						m_block_selected_face = BLOCK_FACE_UNDEFINED;
 					}
@@ -1343,58 +1715,8 @@ namespace nomic {
 					m_block_selected_chunk.x, m_block_selected_chunk.y, m_block_selected_block.x,
 					m_block_selected_block.y, m_block_selected_block.z);
 
-				if(((m_block_selected_block.y + 1) < CHUNK_HEIGHT)
-						&& (chunk->block_type(m_block_selected_block + glm::uvec3(0, 1, 0)) == BLOCK_WATER)) { // top
-					attributes |= BLOCK_ATTRIBUTE_HIDDEN;
-					type = BLOCK_WATER;
-				} else {
-
-					if(((m_block_selected_block.x + 1) < CHUNK_WIDTH)
-						&& (chunk->block_type(m_block_selected_block + glm::uvec3(1, 0, 0)) == BLOCK_WATER)) { // right
-						type = BLOCK_WATER;
-					} else if((m_block_selected_block.x == CHUNK_WIDTH)
-							&& m_manager_terrain.contains(m_block_selected_chunk + glm::ivec2(1, 0))
-							&& (m_manager_terrain.at(m_block_selected_chunk + glm::ivec2(1, 0))->block_type(
-								glm::uvec3(0, m_block_selected_block.y, m_block_selected_block.z))
-							== BLOCK_WATER)) { // right (boundary)
-						type = BLOCK_WATER;
-					} else if(m_block_selected_block.x
-							&& (chunk->block_type(m_block_selected_block - glm::uvec3(1, 0, 0)) == BLOCK_WATER)) { // left
-						type = BLOCK_WATER;
-					} else if(!m_block_selected_block.x
-							&& m_manager_terrain.contains(m_block_selected_chunk - glm::ivec2(1, 0))
-							&& (m_manager_terrain.at(m_block_selected_chunk - glm::ivec2(1, 0))->block_type(
-								glm::uvec3(CHUNK_WIDTH - 1, m_block_selected_block.y, m_block_selected_block.z))
-							== BLOCK_WATER)) { // left (boundary)
-						type = BLOCK_WATER;
-					} else if(((m_block_selected_block.z + 1) < CHUNK_WIDTH)
-							&& (chunk->block_type(m_block_selected_block + glm::uvec3(0, 0, 1)) == BLOCK_WATER)) { // back
-						type = BLOCK_WATER;
-					} else if((m_block_selected_block.z == CHUNK_WIDTH)
-							&& m_manager_terrain.contains(m_block_selected_chunk + glm::ivec2(0, 1))
-							&& (m_manager_terrain.at(m_block_selected_chunk + glm::ivec2(0, 1))->block_type(
-								glm::uvec3(m_block_selected_block.x, m_block_selected_block.y, 0))
-							== BLOCK_WATER)) { // back (boundary)
-						type = BLOCK_WATER;
-					} else if(m_block_selected_block.z
-							&& (chunk->block_type(m_block_selected_block - glm::uvec3(0, 0, 1)) == BLOCK_WATER)) { // front
-						type = BLOCK_WATER;
-					} else if(!m_block_selected_block.z
-							&& m_manager_terrain.contains(m_block_selected_chunk - glm::ivec2(0, 1))
-							&& (m_manager_terrain.at(m_block_selected_chunk - glm::ivec2(0, 1))->block_type(
-								glm::uvec3(m_block_selected_block.x, m_block_selected_block.y, CHUNK_WIDTH - 1))
-							== BLOCK_WATER)) { // front (boundary)
-						type = BLOCK_WATER;
-					}
-
-					if((type == BLOCK_WATER)
-							&& ((m_block_selected_block.y + 1) < CHUNK_HEIGHT)
-							&& (chunk->block_type(m_block_selected_block + glm::uvec3(0, 1, 0)) != BLOCK_AIR)) { // top
-						attributes |= BLOCK_ATTRIBUTE_HIDDEN;
-					}
-				}
-
 				chunk->set_block(m_block_selected_block, type, attributes, true);
+				m_water.activate(m_block_selected_chunk, m_block_selected_block);
 				m_block_selected = false;
 				m_block_selected_face = BLOCK_FACE_UNDEFINED;
 
@@ -1548,6 +1870,12 @@ namespace nomic {
 			}
 
 			m_manager_terrain.generator().setup(seed, octaves, amplitude, max);
+
+			nomic::entity::cloud *cloud = (nomic::entity::cloud *) m_entity_object_background.at(ENTITY_OBJECT_BACKGROUND_CLOUD);
+			if(cloud) {
+				cloud->set_seed(seed, octaves, amplitude);
+			}
+
 			m_random_float.setup(seed);
 			m_random_integer.setup(seed);
 
@@ -1582,6 +1910,53 @@ namespace nomic {
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
+		void 
+		manager::set_view_governor(
+			__in bool governor,
+			__in_opt float target
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Governor=%x, Target=%f ms", governor, target);
+
+			m_view_cost = target;
+			m_view_frame = 0;
+			m_view_governor = governor;
+			m_view_governor_target = target;
+
+			TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "View governor=%s (Target=%f ms)", (governor ? "Enabled" : "Disabled"), target);
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		manager::set_view_radius(
+			__in uint32_t radius
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Radius=%u", radius);
+
+			radius = std::max(std::min(radius, (uint32_t) VIEW_RADIUS_MAX), (uint32_t) VIEW_RADIUS_MIN);
+			if(radius != m_view_radius) {
+				m_view_changed = true;
+				m_view_radius = radius;
+				TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "View radius=%u", m_view_radius);
+			}
+
+			if(m_camera) {
+				m_camera->set_view_radius(m_view_radius);
+			}
+
+			if(m_entity_object_background.size() > ENTITY_OBJECT_BACKGROUND_SUN) {
+
+				nomic::entity::sun *sun_ref = (nomic::entity::sun *) m_entity_object_background.at(ENTITY_OBJECT_BACKGROUND_SUN);
+				if(sun_ref) {
+					sun_ref->set_radius(SUN_RADIUS(m_view_radius));
+				}
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
 		void 
 		manager::set_vsync(
 			__in bool vsync
@@ -1771,38 +2146,34 @@ namespace nomic {
 		void 
 		manager::update(void)
 		{
+			uint64_t begin = SDL_GetPerformanceCounter();
+
 			TRACE_ENTRY(LEVEL_VERBOSE);
 
 			nomic::event::input::poll_input();
 			m_camera->update();
-			
-			if(m_camera->chunk_changed()) {
-				nomic::core::thread::notify();
-			}
+			generate_chunks_runtime();
 
 			update_clouds();
 			update_underwater();
 			update_selector();
+			m_water.update(m_manager_terrain);
 			m_manager_entity.update(m_runtime, m_camera);
 
+			m_view_cost_update += (((SDL_GetPerformanceCounter() - begin) * MILLISECONDS_PER_SECOND)
+				/ (float) SDL_GetPerformanceFrequency());
+
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
 		void 
 		manager::update_clouds(void)
 		{
-			uint8_t type;
-			glm::uvec3 block;
-			glm::ivec2 chunk;
-
 			TRACE_ENTRY(LEVEL_VERBOSE);
 
-			block = m_camera->block();
-			chunk = m_camera->chunk();
-
-			type = m_manager_terrain.at(chunk)->block_type(block);
-			if(!nomic::utility::block_decoration(type)) {
-				m_clouds = ((block.y <= (CHUNK_HEIGHT - 1)) && (type == BLOCK_CLOUD));
+			nomic::entity::cloud *cloud = (nomic::entity::cloud *) m_entity_object_background.at(ENTITY_OBJECT_BACKGROUND_CLOUD);
+			if(cloud) {
+				m_clouds = cloud->contains(m_camera->position());
 			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
@@ -1811,158 +2182,20 @@ namespace nomic {
 		void 
 		manager::update_selector(void)
 		{
-			uint8_t type;
-			float distance = 0.f;
-			glm::vec3 position, rotation;
-			bool back = false, bottom = false, front = false, left = false, right = false, top = false;
+			float distance;
+			uint8_t face = BLOCK_FACE_UNDEFINED;
 
 			TRACE_ENTRY(LEVEL_VERBOSE);
 
-			m_block_selected = false;
-			position = m_camera->position();
-			rotation = glm::normalize(m_camera->rotation()) * SELECTOR_DISTANCE_SCALE;
-
-			for(; distance < SELECTOR_DISTANCE_MAX; ++distance) {
-				position += rotation;
-				nomic::utility::position_as_block(position, m_block_selected_chunk, m_block_selected_block);
-
-				type = m_manager_terrain.at(m_block_selected_chunk)->block_type(m_block_selected_block);
-				if(nomic::utility::block_selectable(type)) {
-					int32_t x = m_block_selected_block.x, y = m_block_selected_block.y, z = m_block_selected_block.z;
-
-					if((x + 1) < CHUNK_WIDTH) { // right
-
-						type = m_manager_terrain.at(m_block_selected_chunk)->block_type(glm::uvec3(x + 1, y, z));
-						if(!nomic::utility::block_selectable(type)) {
-							m_block_selected = true;
-							right = true;
-						}
-					} else if(((x + 1) == CHUNK_WIDTH) && m_manager_terrain.contains(glm::ivec2(m_block_selected_chunk.x + 1,
-							m_block_selected_chunk.y))) { // right (boundary)
-
-						type = m_manager_terrain.at(glm::ivec2(
-							m_block_selected_chunk.x + 1, m_block_selected_chunk.y))->block_type(glm::uvec3(0, y, z));
-						if(!nomic::utility::block_selectable(type)) {
-							m_block_selected = true;
-							right = true;
-						}
-					}
-
-					if((x - 1) >= 0) { // left
-
-						type = m_manager_terrain.at(m_block_selected_chunk)->block_type(glm::uvec3(x - 1, y, z));
-						if(!nomic::utility::block_selectable(type)) {
-							m_block_selected = true;
-							left = true;
-						}
-					} else if(((x - 1) < 0) && m_manager_terrain.contains(glm::ivec2(m_block_selected_chunk.x - 1,
-							m_block_selected_chunk.y))) { // left (boundary)
-
-						type = m_manager_terrain.at(glm::ivec2(
-							m_block_selected_chunk.x - 1, m_block_selected_chunk.y))->block_type(glm::uvec3(
-							CHUNK_WIDTH - 1, y, z));
-						if(!nomic::utility::block_selectable(type)) {
-							m_block_selected = true;
-							left = true;
-						}
-					}
-
-					if((y - 1) > 0) { // bottom
-
-						type = m_manager_terrain.at(m_block_selected_chunk)->block_type(glm::uvec3(x, y - 1, z));
-						if(!nomic::utility::block_selectable(type)) {
-							m_block_selected = true;
-							bottom = true;
-						}
-					}
-
-					if((y + 1) < CHUNK_HEIGHT) { // top
-
-						type = m_manager_terrain.at(m_block_selected_chunk)->block_type(glm::uvec3(x, y + 1, z));
-						if(!nomic::utility::block_selectable(type)) {
-							m_block_selected = true;
-							top = true;
-						}
-					}
-
-					if((z + 1) < CHUNK_WIDTH) { // back
-
-						type = m_manager_terrain.at(m_block_selected_chunk)->block_type(glm::uvec3(x, y, z + 1));
-						if(!nomic::utility::block_selectable(type)) {
-							m_block_selected = true;
-							back = true;
-						}
-					} else if(((z + 1) == CHUNK_WIDTH) && m_manager_terrain.contains(glm::ivec2(m_block_selected_chunk.x,
-							m_block_selected_chunk.y + 1))) { // back (boundary)
-
-						type = m_manager_terrain.at(glm::ivec2(
-							m_block_selected_chunk.x, m_block_selected_chunk.y + 1))->block_type(glm::uvec3(x, y, 0));
-						if(!nomic::utility::block_selectable(type)) {
-							m_block_selected = true;
-							back = true;
-						}
-					}
-
-					if((z - 1) >= 0) { // front
-
-						type = m_manager_terrain.at(m_block_selected_chunk)->block_type(glm::uvec3(x, y, z - 1));
-						if(!nomic::utility::block_selectable(type)) {
-							m_block_selected = true;
-							front = true;
-						}
-					} else if(((z - 1) < 0) && m_manager_terrain.contains(glm::ivec2(m_block_selected_chunk.x,
-							m_block_selected_chunk.y - 1))) { // front (boundary)
-
-						type = m_manager_terrain.at(glm::ivec2(
-							m_block_selected_chunk.x, m_block_selected_chunk.y - 1))->block_type(glm::uvec3(
-							x, y, CHUNK_WIDTH - 1));
-						if(!nomic::utility::block_selectable(type)) {
-							m_block_selected = true;
-							front = true;
-						}
-					}
-
-					break;
-				}
-			}
+			m_block_selected = m_manager_terrain.raycast(m_camera->position(), m_camera->rotation(), SELECTOR_DISTANCE_MAX,
+				m_block_selected_chunk, m_block_selected_block, face, distance);
 
 			nomic::entity::selector *selector_ref
 				= (nomic::entity::selector *) m_entity_object_foreground.at(ENTITY_OBJECT_FOREGROUND_SELECTOR);
 			if(selector_ref) {
 
 				if(m_block_selected) {
-					uint8_t face = BLOCK_FACE_UNDEFINED;
-					glm::vec3 position_block = nomic::utility::block_as_position(m_block_selected_chunk, m_block_selected_block),
-						position_block_offset = position;
-
-					selector_ref->position() = position_block;
-					position_block_offset.x = glm::fract(position_block_offset.x);
-					position_block_offset.y = glm::fract(position_block_offset.y);
-					position_block_offset.z = glm::fract(position_block_offset.z);
-
-					if(right && (position_block_offset.x >= (1.f - SELECTOR_DISTANCE_STEP))) {
-						face = BLOCK_FACE_RIGHT;
-					}
-
-					if(left && (position_block_offset.x <= SELECTOR_DISTANCE_STEP)) {
-						face = BLOCK_FACE_LEFT;
-					}
-
-					if(top && (position_block_offset.y >= (1.f - SELECTOR_DISTANCE_STEP))) {
-						face = BLOCK_FACE_TOP;
-					}
-
-					if(bottom && (position_block_offset.y <= SELECTOR_DISTANCE_STEP)) {
-						face = BLOCK_FACE_BOTTOM;
-					}
-
-					if(back && (position_block_offset.z >= (1.f - SELECTOR_DISTANCE_STEP))) {
-						face = BLOCK_FACE_BACK;
-					}
-
-					if(front && (position_block_offset.z <= SELECTOR_DISTANCE_STEP)) {
-						face = BLOCK_FACE_FRONT;
-					}
+					selector_ref->position() = nomic::utility::block_as_position(m_block_selected_chunk, m_block_selected_block);
 
 					if(m_block_selected_face != face) {
 						m_block_selected_face = face;
@@ -1995,5 +2228,52 @@ namespace nomic {
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
+
+		void 
+		manager::update_view(
+			__in float cost
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Cost=%f ms", cost);
+
+			m_view_cost = glm::mix(m_view_cost, cost, VIEW_GOVERNOR_SMOOTHING);
+
+			if(++m_view_frame >= VIEW_GOVERNOR_INTERVAL) {
+				m_view_frame = 0;
+
+				if(m_view_cost > (m_view_governor_target * (1.f + VIEW_GOVERNOR_HYSTERESIS))) {
+
+					if(m_view_radius > VIEW_RADIUS_MIN) {
+						set_view_radius(m_view_radius - 1);
+					}
+				} else if(m_view_cost < (m_view_governor_target * (1.f - VIEW_GOVERNOR_HYSTERESIS))) {
+
+					std::unique_lock<std::mutex> lock(m_chunk_mutex);
+
+					if(m_chunk_queue.empty() && m_chunk_pending.empty() && !m_chunk_inflight && (m_view_radius < VIEW_RADIUS_MAX)) {
+						lock.unlock();
+						set_view_radius(m_view_radius + 1);
+					}
+				}
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		bool 
+		manager::view_governor(void) const
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", m_view_governor);
+			return m_view_governor;
+		}
+
+		uint32_t 
+		manager::view_radius(void) const
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", m_view_radius);
+			return m_view_radius;
+		}
 	}
 }
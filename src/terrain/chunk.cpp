@@ -32,11 +32,19 @@ namespace nomic {
 		};
 
 		enum {
-			SPAWN_POSITION = 0,
-			SPAWN_TIMEOUT,
-			SPAWN_TYPE,
+			LIGHT_POSITION = 0,
+			LIGHT_LEVEL,
 		};
 
+		static const glm::ivec3 LIGHT_NEIGHBOR[] = {
+			{ 1, 0, 0 }, // right
+			{ -1, 0, 0 }, // left
+			{ 0, 1, 0 }, // top
+			{ 0, -1, 0 }, // bottom
+			{ 0, 0, 1 }, // back
+			{ 0, 0, -1 }, // front
+			};
+
 		chunk::chunk(
 			__in_opt const glm::ivec2 &position
 			) :
@@ -54,9 +62,9 @@ namespace nomic {
 			__in const chunk &other
 			) :
 				m_active(other.m_active),
+				m_pending(other.m_pending),
 				m_position(other.m_position),
-				m_queue(other.m_queue),
-				m_spawn(other.m_spawn)
+				m_queue(other.m_queue)
 		{
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%i, %i}", other.m_position.x, other.m_position.y);
 
@@ -80,9 +88,9 @@ namespace nomic {
 
 			if(this != &other) {
 				m_active = other.m_active;
+				m_pending = other.m_pending;
 				m_position = other.m_position;
 				m_queue = other.m_queue;
-				m_spawn = other.m_spawn;
 				copy(other);
 			}
 
@@ -116,8 +124,16 @@ namespace nomic {
 
 			memset(&m_block, BLOCK_AIR, CHUNK_BLOCK_COUNT);
 			memset(&m_block_attributes, BLOCK_ATTRIBUTES_DEFAULT, CHUNK_BLOCK_COUNT);
+			m_column_changed.reset();
 			memset(&m_height, 0, CHUNK_BLOCK_SURFACE_COUNT);
-			m_spawn.clear();
+			memset(&m_light, LIGHT_PACK(LIGHT_LEVEL_MIN, LIGHT_LEVEL_MIN), CHUNK_BLOCK_COUNT);
+			m_light_changed.clear();
+			m_light_valid = false;
+			memset(&m_mask, 0, sizeof(m_mask));
+			memset(&m_mask[CHUNK_MASK_AIR], UINT8_MAX, sizeof(m_mask[CHUNK_MASK_AIR]));
+			memset(&m_mask[CHUNK_MASK_PASSABLE], UINT8_MAX, sizeof(m_mask[CHUNK_MASK_PASSABLE]));
+			memset(&m_mask[CHUNK_MASK_TRANSPARENT], UINT8_MAX, sizeof(m_mask[CHUNK_MASK_TRANSPARENT]));
+			m_pending.clear();
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
@@ -131,7 +147,12 @@ namespace nomic {
 
 			memcpy(&m_block, &other.m_block, CHUNK_BLOCK_COUNT);
 			memcpy(&m_block_attributes, &other.m_block_attributes, CHUNK_BLOCK_COUNT);
+			m_column_changed = other.m_column_changed;
 			memcpy(&m_height, &other.m_height, CHUNK_BLOCK_SURFACE_COUNT);
+			memcpy(&m_light, &other.m_light, CHUNK_BLOCK_COUNT);
+			m_light_changed = other.m_light_changed;
+			m_light_valid = other.m_light_valid;
+			memcpy(&m_mask, &other.m_mask, sizeof(m_mask));
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
@@ -155,6 +176,238 @@ namespace nomic {
 			return result;
 		}
 
+		uint8_t 
+		chunk::light(
+			__in const glm::uvec3 &position
+			) const
+		{
+			uint8_t result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%u, %u, %u}", position.x, position.y, position.z);
+
+			if((position.x >= CHUNK_WIDTH) || (position.y >= CHUNK_HEIGHT) || (position.z >= CHUNK_WIDTH)) {
+				result = LIGHT_SKY_DEFAULT;
+			} else {
+				result = m_light[position.x][position.y][position.z];
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", (uint16_t) result);
+			return result;
+		}
+
+		void 
+		chunk::light_border(
+			__inout std::queue<glm::uvec3> &queue,
+			__in bool sky
+			)
+		{
+			uint32_t border = std::get<SNAPSHOT_LIGHT_BORDER>(m_snapshot);
+			const std::vector<uint8_t> &block = std::get<SNAPSHOT_BLOCK>(m_snapshot),
+				&light = std::get<SNAPSHOT_LIGHT>(m_snapshot);
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Queue[%u]=%p, Sky=%x, Border=%x", queue.size(), &queue, sky, border);
+
+			for(uint32_t face = BLOCK_FACE_MIN; face <= BLOCK_FACE_MAX; ++face) {
+				const glm::ivec3 &offset = LIGHT_NEIGHBOR[face];
+
+				if(!(border & (1 << face))) { // no resident neighbor on this side
+					continue;
+				}
+
+				for(uint32_t iter = 0; iter < CHUNK_WIDTH; ++iter) {
+					glm::ivec3 position_border;
+					glm::uvec3 position(iter, 0, iter);
+
+					if(offset.x) {
+						position.x = ((offset.x > 0) ? (CHUNK_WIDTH - 1) : 0);
+					}
+
+					if(offset.z) {
+						position.z = ((offset.z > 0) ? (CHUNK_WIDTH - 1) : 0);
+					}
+
+					position_border = (glm::ivec3(position) + offset);
+
+					for(position.y = 0; position.y < CHUNK_HEIGHT; ++position.y) {
+						uint8_t attenuation, level;
+
+						// the ring holds the neighbor's committed light; seed from it as if it were our own source
+						level = light[CHUNK_SNAPSHOT_INDEX(position_border.x, position.y, position_border.z)];
+						level = (sky ? LIGHT_SKY(level) : LIGHT_BLOCK(level));
+
+						attenuation = nomic::utility::block_light_attenuation(block[CHUNK_SNAPSHOT_INDEX(position.x, position.y,
+							position.z)]);
+						if((attenuation >= level) || ((level - attenuation) <= light_level(position, sky))) {
+							continue;
+						}
+
+						set_light_level(position, level - attenuation, sky);
+						queue.push(position);
+					}
+				}
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		uint8_t 
+		chunk::light_level(
+			__in const glm::uvec3 &position,
+			__in bool sky
+			) const
+		{
+			uint8_t result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%u, %u, %u}, Sky=%x", position.x, position.y, position.z, sky);
+
+			result = std::get<SNAPSHOT_LIGHT>(m_snapshot)[CHUNK_SNAPSHOT_INDEX(position.x, position.y, position.z)];
+			result = (sky ? LIGHT_SKY(result) : LIGHT_BLOCK(result));
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", (uint16_t) result);
+			return result;
+		}
+
+		void 
+		chunk::light_propagate(
+			__inout std::queue<glm::uvec3> &queue,
+			__in bool sky
+			)
+		{
+			const std::vector<uint8_t> &block = std::get<SNAPSHOT_BLOCK>(m_snapshot);
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Queue[%u]=%p, Sky=%x", queue.size(), &queue, sky);
+
+			while(!queue.empty()) {
+				uint8_t level;
+				glm::uvec3 position = queue.front();
+
+				queue.pop();
+
+				level = light_level(position, sky);
+				if(level <= LIGHT_ATTENUATION_DEFAULT) {
+					continue;
+				}
+
+				for(uint32_t face = BLOCK_FACE_MIN; face <= BLOCK_FACE_MAX; ++face) {
+					glm::uvec3 neighbor;
+					uint8_t attenuation, neighbor_level;
+					glm::ivec3 position_neighbor = (glm::ivec3(position) + LIGHT_NEIGHBOR[face]);
+
+					if((position_neighbor.x < 0) || (position_neighbor.x >= CHUNK_WIDTH)
+							|| (position_neighbor.y < 0) || (position_neighbor.y >= CHUNK_HEIGHT)
+							|| (position_neighbor.z < 0) || (position_neighbor.z >= CHUNK_WIDTH)) {
+						continue;
+					}
+
+					neighbor = glm::uvec3(position_neighbor);
+					attenuation = nomic::utility::block_light_attenuation(block[CHUNK_SNAPSHOT_INDEX(neighbor.x, neighbor.y,
+						neighbor.z)]);
+					if(attenuation >= level) {
+						continue;
+					}
+
+					if(sky && (face == BLOCK_FACE_BOTTOM) && (level == LIGHT_LEVEL_MAX)
+							&& (attenuation == LIGHT_ATTENUATION_DEFAULT)) { // unobstructed sky column
+						neighbor_level = LIGHT_LEVEL_MAX;
+					} else {
+						neighbor_level = (level - attenuation);
+					}
+
+					if(neighbor_level > light_level(neighbor, sky)) {
+						set_light_level(neighbor, neighbor_level, sky);
+						queue.push(neighbor);
+					}
+				}
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		chunk::light_remove(
+			__in const glm::uvec3 &position,
+			__inout std::queue<glm::uvec3> &queue,
+			__in bool sky
+			)
+		{
+			std::queue<std::tuple<glm::uvec3, uint8_t>> removed;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%u, %u, %u}, Queue[%u]=%p, Sky=%x", position.x, position.y, position.z,
+				queue.size(), &queue, sky);
+
+			removed.push(std::make_tuple(position, light_level(position, sky)));
+			set_light_level(position, LIGHT_LEVEL_MIN, sky);
+
+			while(!removed.empty()) {
+				std::tuple<glm::uvec3, uint8_t> entry = removed.front();
+				glm::uvec3 &entry_position = std::get<LIGHT_POSITION>(entry);
+				uint8_t entry_level = std::get<LIGHT_LEVEL>(entry);
+
+				removed.pop();
+
+				for(uint32_t face = BLOCK_FACE_MIN; face <= BLOCK_FACE_MAX; ++face) {
+					glm::uvec3 neighbor;
+					uint8_t neighbor_level;
+					glm::ivec3 position_neighbor = (glm::ivec3(entry_position) + LIGHT_NEIGHBOR[face]);
+
+					if((position_neighbor.x < 0) || (position_neighbor.x >= CHUNK_WIDTH)
+							|| (position_neighbor.y < 0) || (position_neighbor.y >= CHUNK_HEIGHT)
+							|| (position_neighbor.z < 0) || (position_neighbor.z >= CHUNK_WIDTH)) {
+						continue;
+					}
+
+					neighbor = glm::uvec3(position_neighbor);
+
+					neighbor_level = light_level(neighbor, sky);
+					if(neighbor_level == LIGHT_LEVEL_MIN) {
+						continue;
+					}
+
+					if((neighbor_level < entry_level) || (sky && (face == BLOCK_FACE_BOTTOM)
+							&& (entry_level == LIGHT_LEVEL_MAX) && (neighbor_level == LIGHT_LEVEL_MAX))) { // lit by removed cell
+						removed.push(std::make_tuple(neighbor, neighbor_level));
+						set_light_level(neighbor, LIGHT_LEVEL_MIN, sky);
+					} else { // lit by another source
+						queue.push(neighbor);
+					}
+				}
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		bool 
+		chunk::mask(
+			__in uint32_t type,
+			__in const glm::uvec3 &position
+			) const
+		{
+			bool result = false;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Type=%x, Position={%u, %u, %u}", type, position.x, position.y, position.z);
+
+			if((type <= CHUNK_MASK_MAX) && (position.x < CHUNK_WIDTH) && (position.y < CHUNK_HEIGHT) && (position.z < CHUNK_WIDTH)) {
+				result = ((m_mask[type][position.x][position.z][position.y / CHUNK_MASK_WORD_WIDTH]
+					>> (position.y % CHUNK_MASK_WORD_WIDTH)) & 1);
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
+			return result;
+		}
+
+		std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>> 
+		chunk::pending(void)
+		{
+			std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>> result;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			result.swap(m_pending);
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result.size());
+			return result;
+		}
+
 		glm::ivec2 
 		chunk::position(void) const
 		{
@@ -198,34 +451,161 @@ namespace nomic {
 
 			m_block[position.x][position.y][position.z] = type;
 			m_block_attributes[position.x][position.y][position.z] = attributes;
+			m_column_changed.set(CHUNK_COLUMN_INDEX(position.x, position.z));
+			set_mask(position);
+			result = set_height(glm::uvec2(position.x, position.z));
 
-			result = (CHUNK_HEIGHT - 1);
-			while(!nomic::utility::block_selectable(m_block[position.x][result][position.z])) {
+			if(m_light_valid) {
+				m_light_changed.push_back(position);
+			}
 
-				if(!result) {
-					break;
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
+			return (uint8_t) result;
+		}
+
+		void 
+		chunk::set_blocks(
+			__in const std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>> &blocks
+			)
+		{
+			bool column[CHUNK_WIDTH][CHUNK_WIDTH] = {};
+			std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>::const_iterator iter;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Blocks[%u]=%p", blocks.size(), &blocks);
+
+			for(iter = blocks.begin(); iter != blocks.end(); ++iter) {
+				const glm::uvec3 &position = std::get<BLOCK_POSITION>(*iter);
+
+				if((position.x >= CHUNK_WIDTH) || (position.y >= CHUNK_HEIGHT) || (position.z >= CHUNK_WIDTH)) {
+					THROW_NOMIC_TERRAIN_CHUNK_EXCEPTION_FORMAT(NOMIC_TERRAIN_CHUNK_EXCEPTION_POSITION_INVALID,
+						"Position={%u, %u, %u}", position.x, position.y, position.z);
+				}
+
+				m_block[position.x][position.y][position.z] = std::get<BLOCK_TYPE>(*iter);
+				m_block_attributes[position.x][position.y][position.z] = std::get<BLOCK_ATTRIBUTES>(*iter);
+				set_mask(position);
+				column[position.x][position.z] = true;
+			}
+
+			for(uint32_t x = 0; x < CHUNK_WIDTH; ++x) {
+
+				for(uint32_t z = 0; z < CHUNK_WIDTH; ++z) {
+
+					if(column[x][z]) {
+						m_column_changed.set(CHUNK_COLUMN_INDEX(x, z));
+						set_height(glm::uvec2(x, z));
+					}
+				}
+			}
+
+			if(m_light_valid) {
+
+				if((m_light_changed.size() + blocks.size()) > LIGHT_UPDATE_INCREMENTAL_MAX) {
+					m_light_changed.clear();
+					m_light_valid = false;
+				} else {
+
+					for(iter = blocks.begin(); iter != blocks.end(); ++iter) {
+						m_light_changed.push_back(std::get<BLOCK_POSITION>(*iter));
+					}
 				}
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		uint8_t 
+		chunk::set_height(
+			__in const glm::uvec2 &position
+			)
+		{
+			uint8_t result = 0;
+			const uint64_t *selectable = m_mask[CHUNK_MASK_SELECTABLE][position.x][position.y];
 
-				--result;
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%u, %u}", position.x, position.y);
+
+			for(int32_t word = (CHUNK_MASK_WORD_COUNT - 1); word >= 0; --word) {
+
+				if(selectable[word]) {
+					result = ((word * CHUNK_MASK_WORD_WIDTH) + CHUNK_MASK_BIT_HIGHEST(selectable[word]));
+					break;
+				}
 			}
 
-			m_height[position.x][position.z] = result;
+			m_height[position.x][position.y] = result;
 
 			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
-			return (uint8_t) result;
+			return result;
 		}
 
 		void 
-		chunk::set_spawn(
+		chunk::set_light_level(
+			__in const glm::uvec3 &position,
+			__in uint8_t level,
+			__in bool sky
+			)
+		{
+			uint8_t &light = std::get<SNAPSHOT_LIGHT>(m_snapshot)[CHUNK_SNAPSHOT_INDEX(position.x, position.y, position.z)];
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%u, %u, %u}, Level=%u, Sky=%x", position.x, position.y, position.z,
+				(uint16_t) level, sky);
+
+			light = (sky ? LIGHT_PACK(level, LIGHT_BLOCK(light)) : LIGHT_PACK(LIGHT_SKY(light), level));
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		chunk::set_mask(
+			__in const glm::uvec3 &position
+			)
+		{
+			bool state[CHUNK_MASK_COUNT];
+			uint64_t bit = (1ULL << (position.y % CHUNK_MASK_WORD_WIDTH));
+			uint8_t attributes = m_block_attributes[position.x][position.y][position.z],
+				type = m_block[position.x][position.y][position.z];
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%u, %u, %u}", position.x, position.y, position.z);
+
+			state[CHUNK_MASK_AIR] = (type == BLOCK_AIR);
+			state[CHUNK_MASK_CLOUD] = (type == BLOCK_CLOUD);
+			state[CHUNK_MASK_DECORATION] = nomic::utility::block_decoration(type);
+			state[CHUNK_MASK_PASSABLE] = nomic::utility::block_passable(type);
+			state[CHUNK_MASK_SELECTABLE] = nomic::utility::block_selectable(type);
+			state[CHUNK_MASK_TRANSPARENT] = nomic::utility::block_transparent(type);
+			state[CHUNK_MASK_VISIBLE] = ((type != BLOCK_AIR) && !(attributes & BLOCK_ATTRIBUTE_HIDDEN));
+			state[CHUNK_MASK_WATER] = (type == BLOCK_WATER);
+
+			for(uint32_t mask = 0; mask < CHUNK_MASK_COUNT; ++mask) {
+				uint64_t &word = m_mask[mask][position.x][position.z][position.y / CHUNK_MASK_WORD_WIDTH];
+
+				if(state[mask]) {
+					word |= bit;
+				} else {
+					word &= ~bit;
+				}
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		chunk::set_pending(
+			__in const glm::ivec2 &chunk,
 			__in const glm::uvec3 &position,
 			__in uint8_t type,
-			__in_opt uint32_t timeout
+			__in_opt uint8_t attributes
 			)
 		{
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%u, %u, %u}, Type=%x, Timeout=%u", position.x, position.y, position.z,
-				type, timeout);
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Chunk={%i, %i}, Position={%u, %u, %u}, Type=%x, Attributes=%x", chunk.x, chunk.y,
+				position.x, position.y, position.z, type, attributes);
+
+			if((position.x >= CHUNK_WIDTH) || (position.y >= CHUNK_HEIGHT) || (position.z >= CHUNK_WIDTH)) {
+				THROW_NOMIC_TERRAIN_CHUNK_EXCEPTION_FORMAT(NOMIC_TERRAIN_CHUNK_EXCEPTION_POSITION_INVALID,
+					"Position={%u, %u, %u}", position.x, position.y, position.z);
+			}
 
-			m_spawn.push_back(std::make_tuple(position, timeout, type));
+			m_pending[std::make_pair(chunk.x, chunk.y)].push_back(std::make_tuple(position, type, attributes));
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
@@ -242,32 +622,100 @@ namespace nomic {
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
-		std::vector<std::pair<glm::uvec3, uint8_t>> 
-		chunk::spawn(void)
+		void 
+		chunk::snapshot(void)
 		{
-			std::vector<std::pair<glm::uvec3, uint8_t>> result;
-			std::vector<std::vector<std::tuple<glm::uvec3, uint32_t, uint8_t>>::iterator> complete;
+			std::vector<glm::uvec3> &changed = std::get<SNAPSHOT_LIGHT_CHANGED>(m_snapshot);
+			std::vector<uint8_t> &attributes = std::get<SNAPSHOT_ATTRIBUTES>(m_snapshot), &block = std::get<SNAPSHOT_BLOCK>(m_snapshot),
+				&light = std::get<SNAPSHOT_LIGHT>(m_snapshot);
+			std::vector<uint64_t> &mask = std::get<SNAPSHOT_MASK>(m_snapshot);
 
 			TRACE_ENTRY(LEVEL_VERBOSE);
 
-			for(std::vector<std::tuple<glm::uvec3, uint32_t, uint8_t>>::iterator iter = m_spawn.begin(); iter != m_spawn.end();
-					++iter) {
+			// the border ring stays empty here; the owning entity fills it from the adjacent chunks
+			attributes.assign(CHUNK_SNAPSHOT_COUNT, BLOCK_ATTRIBUTES_DEFAULT);
+			block.assign(CHUNK_SNAPSHOT_COUNT, BLOCK_AIR);
+			light.assign(CHUNK_SNAPSHOT_COUNT, LIGHT_SKY_DEFAULT);
+			mask.assign(CHUNK_SNAPSHOT_MASK_COUNT, 0);
 
-				uint32_t &timeout = std::get<SPAWN_TIMEOUT>(*iter);
-				if(!timeout) {
-					complete.push_back(iter);
-					result.push_back(std::make_pair(std::get<SPAWN_POSITION>(*iter), std::get<SPAWN_TYPE>(*iter)));
-				} else {
-					--timeout;
+			for(uint32_t x = 0; x < CHUNK_WIDTH; ++x) {
+
+				for(uint32_t y = 0; y < CHUNK_HEIGHT; ++y) {
+					uint32_t index = CHUNK_SNAPSHOT_INDEX(x, y, 0);
+
+					memcpy(&attributes[index], m_block_attributes[x][y], CHUNK_WIDTH);
+					memcpy(&block[index], m_block[x][y], CHUNK_WIDTH);
+					memcpy(&light[index], m_light[x][y], CHUNK_WIDTH);
 				}
-			}
 
-			for(std::vector<std::vector<std::tuple<glm::uvec3, uint32_t, uint8_t>>::iterator>::iterator iter = complete.begin();
-					iter != complete.end(); ++iter) {
-				m_spawn.erase(*iter);
+				for(uint32_t type = 0; type < CHUNK_MASK_COUNT; ++type) {
+					memcpy(&mask[CHUNK_SNAPSHOT_MASK_INDEX(type, x, 0)], m_mask[type][x],
+						CHUNK_WIDTH * CHUNK_MASK_WORD_COUNT * sizeof(uint64_t));
+				}
 			}
 
+			// edits and snapshots both happen on the main thread, so the change list needs no lock
+			changed.clear();
+			changed.swap(m_light_changed);
+			std::get<SNAPSHOT_LIGHT_VALID>(m_snapshot) = (m_light_valid && (changed.size() <= LIGHT_UPDATE_INCREMENTAL_MAX));
+			m_light_valid = true;
+			std::get<SNAPSHOT_COLUMN_CHANGED>(m_snapshot) = m_column_changed;
+			m_column_changed.reset();
+			std::get<SNAPSHOT_LIGHT_BORDER>(m_snapshot) = 0;
+
 			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		uint32_t 
+		chunk::snapshot_commit(
+			__inout nomic::terrain::chunk_column &column
+			)
+		{
+			uint32_t result = 0;
+			const std::vector<uint8_t> &light = std::get<SNAPSHOT_LIGHT>(m_snapshot);
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Column=%p", &column);
+
+			if(!light.empty()) {
+				column |= std::get<SNAPSHOT_COLUMN_CHANGED>(m_snapshot);
+
+				for(uint32_t x = 0; x < CHUNK_WIDTH; ++x) {
+
+					for(uint32_t y = 0; y < CHUNK_HEIGHT; ++y) {
+						const uint8_t *row = &light[CHUNK_SNAPSHOT_INDEX(x, y, 0)];
+
+						if(memcmp(m_light[x][y], row, CHUNK_WIDTH)) { // flag each border whose light changed
+
+							if(!x) {
+								result |= (1 << BLOCK_FACE_LEFT);
+							} else if(x == (CHUNK_WIDTH - 1)) {
+								result |= (1 << BLOCK_FACE_RIGHT);
+							}
+
+							if(m_light[x][y][0] != row[0]) {
+								result |= (1 << BLOCK_FACE_FRONT);
+							}
+
+							if(m_light[x][y][CHUNK_WIDTH - 1] != row[CHUNK_WIDTH - 1]) {
+								result |= (1 << BLOCK_FACE_BACK);
+							}
+
+							for(uint32_t z = 0; z < CHUNK_WIDTH; ++z) {
+
+								if(m_light[x][y][z] != row[z]) {
+									column.set(CHUNK_COLUMN_INDEX(x, z));
+								}
+							}
+
+							memcpy(m_light[x][y], row, CHUNK_WIDTH);
+						}
+					}
+				}
+			}
+
+			nomic::terrain::chunk_snapshot().swap(m_snapshot);
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
 			return result;
 		}
 
@@ -284,7 +732,8 @@ namespace nomic {
 
 			if(verbose) {
 				result << " Position={" << m_position.x << ", " << m_position.y << "}"
-					<< ", State=" << (m_active ? "Active" : "Inactive");
+					<< ", State=" << (m_active ? "Active" : "Inactive")
+					<< ", Light=" << (m_light_valid ? "Valid" : "Invalid");
 			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
@@ -316,16 +765,95 @@ namespace nomic {
 			TRACE_ENTRY(LEVEL_VERBOSE);
 
 			if(m_active) {
+				std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>> blocks;
+
 				m_active = false;
+				blocks.reserve(m_queue.size());
 
 				while(!m_queue.empty()) {
-					std::tuple<glm::uvec3, uint8_t, uint8_t> &action = m_queue.front();
-					set_block(std::get<BLOCK_POSITION>(action), std::get<BLOCK_TYPE>(action), std::get<BLOCK_ATTRIBUTES>(action));
+					blocks.push_back(m_queue.front());
 					m_queue.pop();
 				}
+
+				set_blocks(blocks);
 			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
+
+		void 
+		chunk::update_light(void)
+		{
+			std::queue<glm::uvec3> queue_block, queue_sky;
+			bool valid = std::get<SNAPSHOT_LIGHT_VALID>(m_snapshot);
+			const std::vector<uint8_t> &block = std::get<SNAPSHOT_BLOCK>(m_snapshot);
+			std::vector<glm::uvec3> &changed = std::get<SNAPSHOT_LIGHT_CHANGED>(m_snapshot);
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			if(!valid) { // full pass
+
+				for(uint32_t x = 0; x < CHUNK_WIDTH; ++x) {
+
+					for(uint32_t y = 0; y < CHUNK_HEIGHT; ++y) {
+						memset(&std::get<SNAPSHOT_LIGHT>(m_snapshot)[CHUNK_SNAPSHOT_INDEX(x, y, 0)],
+							LIGHT_PACK(LIGHT_LEVEL_MIN, LIGHT_LEVEL_MIN), CHUNK_WIDTH);
+					}
+				}
+
+				for(uint32_t z = 0; z < CHUNK_WIDTH; ++z) {
+
+					for(uint32_t x = 0; x < CHUNK_WIDTH; ++x) {
+						glm::uvec3 position(x, CHUNK_HEIGHT - 1, z);
+
+						if(nomic::utility::block_light_attenuation(block[CHUNK_SNAPSHOT_INDEX(x, position.y, z)])
+								== LIGHT_ATTENUATION_DEFAULT) {
+							set_light_level(position, LIGHT_LEVEL_MAX, true);
+							queue_sky.push(position);
+						}
+
+						for(uint32_t y = 0; y < CHUNK_HEIGHT; ++y) {
+							uint8_t level = nomic::utility::block_light(block[CHUNK_SNAPSHOT_INDEX(x, y, z)]);
+
+							if(level > LIGHT_LEVEL_MIN) {
+								position.y = y;
+								set_light_level(position, level, false);
+								queue_block.push(position);
+							}
+						}
+					}
+				}
+			} else { // incremental pass
+
+				for(std::vector<glm::uvec3>::iterator iter = changed.begin(); iter != changed.end(); ++iter) {
+					uint8_t level, type = block[CHUNK_SNAPSHOT_INDEX(iter->x, iter->y, iter->z)];
+
+					light_remove(*iter, queue_sky, true);
+					light_remove(*iter, queue_block, false);
+
+					if((iter->y == (CHUNK_HEIGHT - 1))
+							&& (nomic::utility::block_light_attenuation(type) == LIGHT_ATTENUATION_DEFAULT)) {
+						set_light_level(*iter, LIGHT_LEVEL_MAX, true);
+						queue_sky.push(*iter);
+					}
+
+					level = nomic::utility::block_light(type);
+					if(level > LIGHT_LEVEL_MIN) {
+						set_light_level(*iter, level, false);
+						queue_block.push(*iter);
+					}
+
+					light_propagate(queue_sky, true);
+					light_propagate(queue_block, false);
+				}
+			}
+
+			light_border(queue_sky, true);
+			light_border(queue_block, false);
+			light_propagate(queue_sky, true);
+			light_propagate(queue_block, false);
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Changed[%u]", changed.size());
+		}
 	}
 }
@@ -0,0 +1,279 @@
+/**
+ * Nomic
+ * Copyright (C) 2017 David Jolly
+ *
+ * Nomic is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Nomic is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include "../../include/terrain/collision.h"
+#include "../../include/trace.h"
+#include "./collision_type.h"
+
+namespace nomic {
+
+	namespace terrain {
+
+		static const int32_t COLLISION_AXIS[] = {
+			1, // y
+			0, // x
+			2, // z
+			};
+
+		collision::collision(void) :
+			m_origin(0)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			std::memset(m_solid, 0, sizeof(m_solid));
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		collision::collision(
+			__in const collision &other
+			) :
+				m_origin(other.m_origin)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			std::memcpy(m_solid, other.m_solid, sizeof(m_solid));
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		collision::~collision(void)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		collision &
+		collision::operator=(
+			__in const collision &other
+			)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			if(this != &other) {
+				m_origin = other.m_origin;
+				std::memcpy(m_solid, other.m_solid, sizeof(m_solid));
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%p", this);
+			return *this;
+		}
+
+		glm::vec3 
+		collision::move(
+			__in const glm::vec3 &minimum,
+			__in const glm::vec3 &maximum,
+			__in const glm::vec3 &motion,
+			__inout glm::bvec3 &contact
+			) const
+		{
+			glm::vec3 lower = minimum, result = motion, upper = maximum;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Bounds={%f, %f, %f}-{%f, %f, %f}, Motion={%f, %f, %f}", minimum.x, minimum.y, minimum.z,
+				maximum.x, maximum.y, maximum.z, motion.x, motion.y, motion.z);
+
+			if((maximum.x < minimum.x) || (maximum.y < minimum.y) || (maximum.z < minimum.z)) {
+				THROW_NOMIC_TERRAIN_COLLISION_EXCEPTION_FORMAT(NOMIC_TERRAIN_COLLISION_EXCEPTION_BOUNDS_INVALID,
+					"Bounds={%f, %f, %f}-{%f, %f, %f}", minimum.x, minimum.y, minimum.z, maximum.x, maximum.y, maximum.z);
+			}
+
+			contact = glm::bvec3(false);
+
+			for(uint32_t iter = 0; iter < 3; ++iter) {
+				bool hit = false;
+				int32_t axis = COLLISION_AXIS[iter], axis_first, axis_second, first_begin, first_end, second_begin, second_end,
+					layer, layer_begin, layer_end;
+
+				if(result[axis] == 0.f) {
+					continue;
+				}
+
+				axis_first = ((axis + 1) % 3);
+				axis_second = ((axis + 2) % 3);
+				first_begin = std::floor(lower[axis_first] + COLLISION_EPSILON);
+				first_end = std::floor(upper[axis_first] - COLLISION_EPSILON);
+				second_begin = std::floor(lower[axis_second] + COLLISION_EPSILON);
+				second_end = std::floor(upper[axis_second] - COLLISION_EPSILON);
+
+				if(result[axis] > 0.f) {
+					layer_begin = (std::floor(upper[axis] - COLLISION_EPSILON) + 1);
+					layer_end = std::floor(upper[axis] + result[axis] - COLLISION_EPSILON);
+				} else {
+					layer_begin = (std::floor(lower[axis] + COLLISION_EPSILON) - 1);
+					layer_end = std::floor(lower[axis] + result[axis] + COLLISION_EPSILON);
+				}
+
+				for(layer = layer_begin; !hit && ((result[axis] > 0.f) ? (layer <= layer_end) : (layer >= layer_end));
+						layer += ((result[axis] > 0.f) ? 1 : -1)) {
+
+					for(int32_t first = first_begin; !hit && (first <= first_end); ++first) {
+
+						for(int32_t second = second_begin; !hit && (second <= second_end); ++second) {
+							glm::ivec3 position;
+
+							position[axis] = layer;
+							position[axis_first] = first;
+							position[axis_second] = second;
+							hit = solid(position);
+						}
+					}
+
+					if(hit) {
+						break;
+					}
+				}
+
+				if(hit) {
+
+					if(result[axis] > 0.f) {
+						result[axis] = std::max(0.f, layer - upper[axis]);
+					} else {
+						result[axis] = std::min(0.f, (layer + 1) - lower[axis]);
+					}
+
+					contact[axis] = true;
+				}
+
+				lower[axis] += result[axis];
+				upper[axis] += result[axis];
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result={%f, %f, %f}, Contact={%x, %x, %x}", result.x, result.y, result.z,
+				contact.x, contact.y, contact.z);
+			return result;
+		}
+
+		glm::ivec3 
+		collision::origin(void) const
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result={%i, %i, %i}", m_origin.x, m_origin.y, m_origin.z);
+			return m_origin;
+		}
+
+		void 
+		collision::snapshot(
+			__in nomic::terrain::manager &terrain,
+			__in const glm::vec3 &position
+			)
+		{
+			nomic::entity::chunk *chunk_ref = nullptr;
+			glm::ivec2 chunk_position = glm::ivec2(INT32_MAX, INT32_MAX);
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Terrain=%p, Position={%f, %f, %f}", &terrain, position.x, position.y, position.z);
+
+			if(!terrain.initialized()) {
+				THROW_NOMIC_TERRAIN_COLLISION_EXCEPTION_FORMAT(NOMIC_TERRAIN_COLLISION_EXCEPTION_TERRAIN_INVALID, "Terrain=%p",
+					&terrain);
+			}
+
+			m_origin = (glm::ivec3(std::floor(position.x), std::floor(position.y), std::floor(position.z))
+				- glm::ivec3(COLLISION_RADIUS));
+
+			for(int32_t x = 0; x < COLLISION_WIDTH; ++x) {
+
+				for(int32_t z = 0; z < COLLISION_WIDTH; ++z) {
+					glm::ivec2 chunk;
+					int32_t position_x = (m_origin.x + x), position_z = (m_origin.z + z);
+
+					chunk = glm::ivec2(FLOOR_DIVIDE(position_x, CHUNK_WIDTH), FLOOR_DIVIDE(position_z, CHUNK_WIDTH));
+					if(chunk != chunk_position) {
+						chunk_position = chunk;
+						chunk_ref = (terrain.contains(chunk) ? terrain.at(chunk, false) : nullptr);
+					}
+
+					for(int32_t y = 0; y < COLLISION_WIDTH; ++y) {
+						int32_t position_y = (m_origin.y + y);
+
+						if(position_y < 0) {
+							m_solid[x][y][z] = true;
+						} else if(position_y >= CHUNK_HEIGHT) {
+							m_solid[x][y][z] = false;
+						} else if(!chunk_ref) {
+							m_solid[x][y][z] = true;
+						} else {
+							m_solid[x][y][z] = !chunk_ref->block_mask(CHUNK_MASK_PASSABLE, glm::uvec3(
+								position_x - (chunk.x * CHUNK_WIDTH), position_y, position_z - (chunk.y * CHUNK_WIDTH)));
+						}
+					}
+				}
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		bool 
+		collision::solid(
+			__in const glm::ivec3 &position
+			) const
+		{
+			bool result;
+			glm::ivec3 position_local = (position - m_origin);
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%i, %i, %i}", position.x, position.y, position.z);
+
+			if(position.y < 0) {
+				result = true;
+			} else if(position.y >= CHUNK_HEIGHT) {
+				result = false;
+			} else if((position_local.x < 0) || (position_local.x >= COLLISION_WIDTH)
+					|| (position_local.y < 0) || (position_local.y >= COLLISION_WIDTH)
+					|| (position_local.z < 0) || (position_local.z >= COLLISION_WIDTH)) {
+				result = true;
+			} else {
+				result = m_solid[position_local.x][position_local.y][position_local.z];
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
+			return result;
+		}
+
+		std::string 
+		collision::to_string(
+			__in_opt bool verbose
+			) const
+		{
+			uint32_t count = 0;
+			std::stringstream result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Verbose=%x", verbose);
+
+			result << NOMIC_TERRAIN_COLLISION_HEADER << "(" << SCALAR_AS_HEX(uintptr_t, this) << ")";
+
+			if(verbose) {
+
+				for(int32_t x = 0; x < COLLISION_WIDTH; ++x) {
+
+					for(int32_t y = 0; y < COLLISION_WIDTH; ++y) {
+
+						for(int32_t z = 0; z < COLLISION_WIDTH; ++z) {
+							count += (m_solid[x][y][z] ? 1 : 0);
+						}
+					}
+				}
+
+				result << " Origin={" << m_origin.x << ", " << m_origin.y << ", " << m_origin.z << "}"
+					<< ", Solid=" << count << "/" << (COLLISION_WIDTH * COLLISION_WIDTH * COLLISION_WIDTH);
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+			return result.str();
+		}
+	}
+}
@@ -24,6 +24,16 @@ namespace nomic {
 
 	namespace terrain {
 
+		#define GENERATOR_CHUNK_SEED(_SEED_, _POSITION_) \
+			(((_SEED_) ^ (((uint32_t) (_POSITION_).x) * 73856093) ^ (((uint32_t) (_POSITION_).y) * 19349663)) | 1)
+
+		#define GENERATOR_STRUCTURE_HASH(_SEED_, _X_, _Z_) \
+			((((_SEED_) ^ (((uint32_t) (_X_)) * 83492791) ^ (((uint32_t) (_Z_)) * 2654435761u)) * 2246822519u) >> 16)
+
+		#define GENERATOR_STRUCTURE_SEED 0x6e6f6d69
+
+		#define GENERATOR_STRUCTURE_VARIANTS 16
+
 		generator::generator(
 			__in_opt uint32_t seed,
 			__in_opt uint32_t octaves,
@@ -31,7 +41,6 @@ namespace nomic {
 			__in_opt uint32_t max
 			) :
 				m_max(max),
-				m_noise_cloud(seed + seed, octaves, amplitude),
 				m_noise_terrain(seed, octaves, amplitude),
 				m_random(seed)
 		{
@@ -43,8 +52,9 @@ namespace nomic {
 			__in const generator &other
 			) :
 				m_max(other.m_max),
-				m_noise_cloud(other.m_noise_cloud),
-				m_noise_terrain(other.m_noise_terrain)
+				m_noise_terrain(other.m_noise_terrain),
+				m_random(other.m_random.seed()),
+				m_structure(other.m_structure)
 		{
 			TRACE_ENTRY(LEVEL_VERBOSE);
 			TRACE_EXIT(LEVEL_VERBOSE);
@@ -65,8 +75,9 @@ namespace nomic {
 
 			if(this != &other) {
 				m_max = other.m_max;
-				m_noise_cloud = other.m_noise_cloud;
 				m_noise_terrain = other.m_noise_terrain;
+				m_random.setup(other.m_random.seed());
+				m_structure = other.m_structure;
 			}
 
 			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%p", this);
@@ -229,6 +240,8 @@ namespace nomic {
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%i, %i}, Chunk=%p", position.x, position.y, &chunk);
 
 			chunk.set_position(position);
+			m_random.setup(GENERATOR_CHUNK_SEED(m_noise_terrain.seed(), position));
+			m_structure.clear();
 
 			for(int32_t z = (CHUNK_WIDTH - 1); z >= 0; --z) {
 
@@ -249,10 +262,6 @@ namespace nomic {
 
 						if(!y) { // boundary
 							chunk.set_block(glm::uvec3(x, y, z), BLOCK_BOUNDARY, attributes);
-						} else if(y == BLOCK_HEIGHT_CLOUD) { // cloud
-							chunk_decoration_cloud(glm::uvec3(x, y, z), chunk, y, std::abs(m_noise_cloud.generate(
-								((position.x * CHUNK_WIDTH) + x) / NOISE_SCALE_CLOUD,
-								((position.y * CHUNK_WIDTH) + z) / NOISE_SCALE_CLOUD)));
 						} else if(y > height) { // air
 							chunk.set_block(glm::uvec3(x, y, z), BLOCK_AIR, attributes | BLOCK_ATTRIBUTE_HIDDEN);
 						} else { // other
@@ -265,6 +274,15 @@ namespace nomic {
 
 			//chunk_decoration_ore(chunk); // ore
 
+			for(std::vector<std::pair<glm::uvec3, uint8_t>>::iterator iter = m_structure.begin(); iter != m_structure.end();
+					++iter) { // structure
+				structure_variant(iter->second, GENERATOR_STRUCTURE_HASH(m_noise_terrain.seed(),
+					(position.x * CHUNK_WIDTH) + (int32_t) iter->first.x, (position.y * CHUNK_WIDTH) + (int32_t) iter->first.z)).stamp(
+					iter->first, chunk);
+			}
+
+			m_structure.clear();
+
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
@@ -589,74 +607,6 @@ namespace nomic {
 			return result;
 		}
 
-		bool 
-		generator::chunk_decoration_cloud(
-			__in const glm::uvec3 &position,
-			__in nomic::terrain::chunk &chunk,
-			__inout int32_t &height,
-			__in double scale
-			)
-		{
-			uint32_t iter = 0;
-			bool result = false;
-			float threshold = BLOCK_CLOUD_THRESHOLD;
-			uint8_t attributes = (BLOCK_ATTRIBUTE_STATIC & ~BLOCK_ATTRIBUTE_BREAKABLE);
-
-			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%u, %u, %u}, Height=%u, Chunk=%p, Scale=%f", position.x, position.y, position.z,
-				height, &chunk, scale);
-
-			if(!(position.x % BLOCK_WIDTH_CLOUD) && !(position.z % BLOCK_WIDTH_CLOUD)
-					&& (position.x <= (CHUNK_WIDTH - BLOCK_WIDTH_CLOUD))
-					&& (position.z <= (CHUNK_WIDTH - BLOCK_WIDTH_CLOUD))) {
-				result = true;
-
-				for(; iter < BLOCK_CLOUD_THICKNESS; ++iter, threshold -= BLOCK_CLOUD_THRESHOLD_STEP) {
-
-					if(scale >= threshold) {
-						uint32_t iter_layer = 0;
-
-						for(; iter_layer < (BLOCK_CLOUD_THICKNESS - iter - 1); ++iter_layer) { // cloud
-
-							for(uint32_t offset_z = 0; offset_z < BLOCK_WIDTH_CLOUD; ++offset_z) {
-
-								for(uint32_t offset_x = 0; offset_x < BLOCK_WIDTH_CLOUD; ++offset_x) {
-									chunk.set_block(glm::uvec3(position.x + offset_x, position.y - iter_layer,
-										position.z + offset_z),
-										BLOCK_CLOUD, attributes | BLOCK_ATTRIBUTE_HIDDEN);
-								}
-							}
-						}
-
-						for(uint32_t offset_z = 0; offset_z < BLOCK_WIDTH_CLOUD; ++offset_z) {
-
-							for(uint32_t offset_x = 0; offset_x < BLOCK_WIDTH_CLOUD; ++offset_x) {
-								chunk.set_block(glm::uvec3(position.x + offset_x, position.y - iter_layer,
-									position.z + offset_z), BLOCK_CLOUD, attributes);
-							}
-						}
-
-						height -= iter_layer;
-						break;
-					}
-				}
-
-				if(iter == BLOCK_CLOUD_THICKNESS) { // air
-					result = false;
-
-					for(uint32_t offset_z = 0; offset_z < BLOCK_WIDTH_CLOUD; ++offset_z) {
-
-						for(uint32_t offset_x = 0; offset_x < BLOCK_WIDTH_CLOUD; ++offset_x) {
-							chunk.set_block(glm::uvec3(position.x + offset_x, position.y, position.z + offset_z),
-								BLOCK_AIR, attributes | BLOCK_ATTRIBUTE_HIDDEN);
-						}
-					}
-				}
-			}
-
-			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
-			return result;
-		}
-
 		bool 
 		generator::chunk_decoration_grassland(
 			__in const glm::uvec3 &position,
@@ -707,7 +657,7 @@ namespace nomic {
 					position.z = std::uniform_int_distribution<uint32_t>(0, CHUNK_WIDTH - 1)(m_random.generator());
 				} while(chunk.type(position) != BLOCK_STONE);
 
-				chunk.set_spawn(position, BLOCK_ORE_COAL);
+				chunk.set_block(position, BLOCK_ORE_COAL);
 			}
 
 			count = std::uniform_int_distribution<uint32_t>(BLOCK_ORE_IRON_MIN, BLOCK_ORE_IRON_MAX)(m_random.generator()); // iron
@@ -720,7 +670,7 @@ namespace nomic {
 					position.z = std::uniform_int_distribution<uint32_t>(0, CHUNK_WIDTH - 1)(m_random.generator());
 				} while(chunk.type(position) != BLOCK_STONE);
 
-				chunk.set_spawn(position, BLOCK_ORE_IRON);
+				chunk.set_block(position, BLOCK_ORE_IRON);
 			}
 
 			count = std::uniform_int_distribution<uint32_t>(BLOCK_ORE_GOLD_MIN, BLOCK_ORE_GOLD_MAX)(m_random.generator()); // gold
@@ -733,7 +683,7 @@ namespace nomic {
 					position.z = std::uniform_int_distribution<uint32_t>(0, CHUNK_WIDTH - 1)(m_random.generator());
 				} while(chunk.type(position) != BLOCK_STONE);
 
-				chunk.set_spawn(position, BLOCK_ORE_GOLD);
+				chunk.set_block(position, BLOCK_ORE_GOLD);
 			}
 
 			count = std::uniform_int_distribution<uint32_t>(BLOCK_ORE_DIAMOND_MIN, BLOCK_ORE_DIAMOND_MAX)(m_random.generator()); // diamond
@@ -746,7 +696,7 @@ namespace nomic {
 					position.z = std::uniform_int_distribution<uint32_t>(0, CHUNK_WIDTH - 1)(m_random.generator());
 				} while(chunk.type(position) != BLOCK_STONE);
 
-				chunk.set_spawn(position, BLOCK_ORE_DIAMOND);
+				chunk.set_block(position, BLOCK_ORE_DIAMOND);
 			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
@@ -767,7 +717,7 @@ namespace nomic {
 
 				result = (type == BLOCK_WOOD_OAK);
 				if(result) { // tree
-					chunk.set_spawn(position, BLOCK_WOOD_OAK);
+					m_structure.push_back(std::make_pair(position, BLOCK_WOOD_OAK));
 				}
 			}
 
@@ -790,7 +740,7 @@ namespace nomic {
 
 				result = (type == BLOCK_WOOD_SPRUCE);
 				if(result) { // spruce-tree
-					chunk.set_spawn(position, BLOCK_WOOD_SPRUCE);
+					m_structure.push_back(std::make_pair(position, BLOCK_WOOD_SPRUCE));
 				}
 			}
 
@@ -919,13 +869,224 @@ namespace nomic {
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Seed=%u(%x), Octaves=%u, Amplitude=%g, Max=%u", seed, seed, octaves, amplitude, max);
 
 			m_max = max;
-			m_noise_cloud.setup(seed + seed, octaves, amplitude);
 			m_noise_terrain.setup(seed, octaves, amplitude);
 			m_random.setup(seed);
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
+		std::map<uint8_t, std::vector<nomic::terrain::structure>> 
+		generator::structure_library(void)
+		{
+			std::map<uint8_t, std::vector<nomic::terrain::structure>> result;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			for(uint32_t variant = 0; variant < GENERATOR_STRUCTURE_VARIANTS; ++variant) {
+				nomic::terrain::structure entry;
+				nomic::terrain::generator builder(GENERATOR_STRUCTURE_SEED + variant);
+
+				builder.structure_tree_oak(entry);
+				result[BLOCK_WOOD_OAK].push_back(entry);
+				entry.clear();
+				builder.structure_tree_spruce(entry);
+				result[BLOCK_WOOD_SPRUCE].push_back(entry);
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result.size());
+			return result;
+		}
+
+		void 
+		generator::structure_tree_oak(
+			__inout nomic::terrain::structure &entry
+			)
+		{
+			int32_t offset = 0, radius = BLOCK_TREE_OAK_RADIUS_DEFAULT, start, y;
+			glm::ivec3 back(0, 0, 1), front(0, 0, -1), left(-1, 0, 0), right(1, 0, 0);
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Entry=%p", &entry);
+
+			for(; offset <= BLOCK_TREE_OAK_MAX; ++offset) { // trunk
+
+				if((offset >= BLOCK_TREE_OAK_MIN) && (block_pick(BLOCK_WOOD_OAK, BLOCK_AIR) == BLOCK_AIR)) {
+					break;
+				} else if((offset > BLOCK_TREE_OAK_AVERAGE) && (block_pick(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_AIR)) {
+					break;
+				}
+
+				if((offset >= BLOCK_TREE_OAK_SPLIT_MIN) && (offset < BLOCK_TREE_OAK_AVERAGE)) {
+
+					if(block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_WOOD_OAK) { // right
+						right.y = ((block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_WOOD_OAK) ? -1 : 0);
+						entry.add(glm::ivec3(0, offset, 0) + right, BLOCK_WOOD_OAK);
+						++right.x;
+					}
+
+					if(block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_WOOD_OAK) { // left
+						left.y = ((block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_WOOD_OAK) ? -1 : 0);
+						entry.add(glm::ivec3(0, offset, 0) + left, BLOCK_WOOD_OAK);
+						--left.x;
+					}
+
+					if(block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_WOOD_OAK) { // back
+						back.y = ((block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_WOOD_OAK) ? -1 : 0);
+						entry.add(glm::ivec3(0, offset, 0) + back, BLOCK_WOOD_OAK);
+						++back.z;
+					}
+
+					if(block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_WOOD_OAK) { // front
+						front.y = ((block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_WOOD_OAK) ? -1 : 0);
+						entry.add(glm::ivec3(0, offset, 0) + front, BLOCK_WOOD_OAK);
+						--front.z;
+					}
+				}
+
+				entry.add(glm::ivec3(0, offset, 0), BLOCK_WOOD_OAK);
+			}
+
+			radius = std::max(right.x, radius);
+			radius = std::max(std::abs(left.x), radius);
+			radius = std::max(back.z, radius);
+			radius = std::max(std::abs(front.z), radius);
+			++radius;
+
+			start = BLOCK_TREE_OAK_LEAVES_START;
+			if(block_pick(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_WOOD_OAK) {
+				--start;
+			}
+
+			for(y = start; y <= offset; ++y) { // leaves
+				int32_t layer_radius = radius;
+
+				float delta = ((offset - y) / (float) (offset - start));
+				if(delta <= 0.5f) {
+					layer_radius *= delta;
+				} else {
+					layer_radius *= (1.f - delta);
+				}
+
+				layer_radius += BLOCK_TREE_OAK_RADIUS_DEFAULT;
+
+				for(int32_t z = -radius; z < radius; ++z) {
+
+					for(int32_t x = -radius; x < radius; ++x) {
+
+						if(((x * x) + (z * z)) <= (layer_radius * layer_radius)) {
+							entry.add(glm::ivec3(x, y, z), BLOCK_LEAVES_OAK);
+						}
+					}
+				}
+			}
+
+			if(block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_WOOD_OAK) { // cap
+
+				for(; y < (offset + BLOCK_TREE_OAK_CAP_WIDTH); ++y) {
+
+					for(int32_t z = -BLOCK_TREE_OAK_CAP_RADIUS; z < BLOCK_TREE_OAK_CAP_RADIUS; ++z) {
+
+						for(int32_t x = -BLOCK_TREE_OAK_CAP_RADIUS; x < BLOCK_TREE_OAK_CAP_RADIUS; ++x) {
+							entry.add(glm::ivec3(x, y, z), BLOCK_LEAVES_OAK);
+						}
+					}
+				}
+
+				if(block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_OAK) == BLOCK_WOOD_OAK) {
+					entry.add(glm::ivec3(0, y, 0), BLOCK_LEAVES_OAK);
+				}
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		generator::structure_tree_spruce(
+			__inout nomic::terrain::structure &entry
+			)
+		{
+			int32_t end, offset = 0, radius = BLOCK_TREE_SPRUCE_RADIUS_DEFAULT, start;
+			int32_t layer_radius = 1, layer_radius_previous = 1;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Entry=%p", &entry);
+
+			for(; offset <= BLOCK_TREE_SPRUCE_MAX; ++offset) { // trunk
+
+				if((offset >= BLOCK_TREE_SPRUCE_MIN) && (block_pick(BLOCK_WOOD_SPRUCE, BLOCK_AIR) == BLOCK_AIR)) {
+					break;
+				} else if((offset > BLOCK_TREE_SPRUCE_AVERAGE)
+						&& (block_pick_uniform(BLOCK_AIR, BLOCK_WOOD_SPRUCE) == BLOCK_AIR)) {
+					break;
+				}
+
+				entry.add(glm::ivec3(0, offset, 0), BLOCK_WOOD_SPRUCE);
+			}
+
+			entry.add(glm::ivec3(0, offset, 0), BLOCK_LEAVES_SPRUCE); // leaves
+
+			start = offset;
+			if(block_pick(BLOCK_AIR, BLOCK_WOOD_SPRUCE) == BLOCK_AIR) {
+				--start;
+			}
+
+			end = BLOCK_TREE_SPRUCE_LEAVES_END;
+			if(block_pick(BLOCK_AIR, BLOCK_WOOD_SPRUCE) == BLOCK_WOOD_SPRUCE) {
+				--end;
+			}
+
+			for(int32_t y = start; y >= end; --y) {
+
+				if(!(y % 2)) {
+					layer_radius_previous = layer_radius;
+					layer_radius = ((block_pick(BLOCK_AIR, BLOCK_WOOD_SPRUCE) == BLOCK_AIR) ? 1 : 0);
+
+					if(layer_radius && (block_pick(BLOCK_AIR, BLOCK_WOOD_SPRUCE) == BLOCK_WOOD_SPRUCE)) {
+						layer_radius = (layer_radius_previous + 1);
+					}
+				}
+
+				if(layer_radius) {
+
+					for(int32_t z = -radius; z < radius; ++z) {
+
+						for(int32_t x = -radius; x < radius; ++x) {
+
+							if(((x * x) + (z * z)) <= (layer_radius * layer_radius)) {
+								entry.add(glm::ivec3(x, y, z), BLOCK_LEAVES_SPRUCE);
+							}
+						}
+					}
+				}
+
+				if(!(y % 2)) {
+					layer_radius = layer_radius_previous;
+				} else {
+					++layer_radius;
+				}
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		const nomic::terrain::structure &
+		generator::structure_variant(
+			__in uint8_t type,
+			__in uint32_t variant
+			)
+		{
+			static const std::map<uint8_t, std::vector<nomic::terrain::structure>> library = structure_library();
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Type=%x, Variant=%u", type, variant);
+
+			std::map<uint8_t, std::vector<nomic::terrain::structure>>::const_iterator result = library.find(type);
+			if((result == library.end()) || result->second.empty()) {
+				THROW_NOMIC_TERRAIN_GENERATOR_EXCEPTION_FORMAT(NOMIC_TERRAIN_GENERATOR_EXCEPTION_TYPE_INVALID,
+					"Type=%x", type);
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+			return result->second.at(variant % result->second.size());
+		}
+
 		std::string 
 		generator::to_string(
 			__in_opt bool verbose
@@ -939,7 +1100,6 @@ namespace nomic {
 
 			if(verbose) {
 				result << " Terrain=" << m_noise_terrain.to_string(verbose)
-					<< ", Cloud=" << m_noise_cloud.to_string(verbose)
 					<< ", Max=" << m_max;
 			}
 
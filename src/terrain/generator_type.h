@@ -33,14 +33,17 @@ namespace nomic {
 #endif // NDEBUG
 
 		enum {
-			NOMIC_TERRAIN_GENERATOR_EXCEPTION_RANGE_INVALID = 0,
+			NOMIC_TERRAIN_GENERATOR_EXCEPTION_POSITION_INVALID = 0,
+			NOMIC_TERRAIN_GENERATOR_EXCEPTION_RANGE_INVALID,
+			NOMIC_TERRAIN_GENERATOR_EXCEPTION_TYPE_INVALID,
 		};
 
-		#define NOMIC_TERRAIN_GENERATOR_EXCEPTION_MAX NOMIC_TERRAIN_GENERATOR_EXCEPTION_RANGE_INVALID
+		#define NOMIC_TERRAIN_GENERATOR_EXCEPTION_MAX NOMIC_TERRAIN_GENERATOR_EXCEPTION_TYPE_INVALID
 
 		static const std::string NOMIC_TERRAIN_GENERATOR_EXCEPTION_STR[] = {
 			NOMIC_TERRAIN_GENERATOR_EXCEPTION_HEADER "Invalid position",
 			NOMIC_TERRAIN_GENERATOR_EXCEPTION_HEADER "Invalid range",
+			NOMIC_TERRAIN_GENERATOR_EXCEPTION_HEADER "Invalid structure type",
 			};
 
 		#define NOMIC_TERRAIN_GENERATOR_EXCEPTION_STRING(_TYPE_) \
@@ -16,6 +16,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <limits>
 #include "../../include/terrain/manager.h"
 #include "../../include/trace.h"
 #include "./manager_type.h"
@@ -24,7 +25,43 @@ namespace nomic {
 
 	namespace terrain {
 
-		manager::manager(void)
+		enum {
+			PENDING_POSITION = 0,
+			PENDING_TYPE,
+			PENDING_ATTRIBUTES,
+		};
+
+		enum {
+			REGION_DIMENSIONS = 0,
+			REGION_TYPE,
+			REGION_ATTRIBUTES,
+		};
+
+		#define REGION_INDEX(_DIMENSIONS_, _X_, _Y_, _Z_) \
+			(((((_X_) * (_DIMENSIONS_).y) + (_Y_)) * (_DIMENSIONS_).z) + (_Z_))
+
+		#define EVICT_WINDOW_CONTAINS(_CENTER_, _RADIUS_, _X_, _Z_) \
+			(((_X_) >= ((_CENTER_).x - (_RADIUS_))) && ((_X_) < ((_CENTER_).x + (_RADIUS_))) \
+				&& ((_Z_) >= ((_CENTER_).y - (_RADIUS_))) && ((_Z_) < ((_CENTER_).y + (_RADIUS_))))
+
+		enum {
+			CHUNK_EDGE_RIGHT = 0,
+			CHUNK_EDGE_LEFT,
+			CHUNK_EDGE_BACK,
+			CHUNK_EDGE_FRONT,
+		};
+
+		#define CHUNK_EDGE_COUNT (CHUNK_EDGE_FRONT + 1)
+
+		static const glm::ivec2 CHUNK_EDGE[] = {
+			{ 1, 0 }, // right
+			{ -1, 0 }, // left
+			{ 0, 1 }, // back
+			{ 0, -1 }, // front
+			};
+
+		manager::manager(void) :
+			m_pool(CHUNK_POOL_SLAB_COUNT)
 		{
 			TRACE_ENTRY(LEVEL_VERBOSE);	
 			TRACE_EXIT(LEVEL_VERBOSE);
@@ -56,13 +93,10 @@ namespace nomic {
 				iter = m_chunk.find(std::make_pair(position.x, position.y));
 				if(iter == m_chunk.end()) {
 
-					nomic::entity::chunk *entry = new nomic::entity::chunk(position, m_generator);
-					if(!entry) {
-						THROW_NOMIC_TERRAIN_MANAGER_EXCEPTION_FORMAT(NOMIC_TERRAIN_MANAGER_EXCEPTION_ALLOCATE,
-							"Position={%i, %i}", position.x, position.y);
-					}
+					nomic::entity::chunk *entry = m_pool.allocate(position, m_generator);
 
 					m_chunk.insert(std::make_pair(std::make_pair(position.x, position.y), entry));
+					pending(entry);
 				}
 			}
 
@@ -104,6 +138,83 @@ namespace nomic {
 			return result;
 		}
 
+		uint32_t 
+		manager::evict(
+			__in const glm::ivec2 &center,
+			__in const glm::ivec2 &predicted,
+			__in int32_t radius
+			)
+		{
+			uint32_t result = 0;
+			std::set<std::pair<int32_t, int32_t>> edge;
+			std::set<std::pair<int32_t, int32_t>>::iterator iter_edge;
+			std::map<std::pair<int32_t, int32_t>, nomic::entity::chunk *>::iterator iter;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Center={%i, %i}, Predicted={%i, %i}, Radius=%i", center.x, center.y, predicted.x,
+				predicted.y, radius);
+
+			if(!m_initialized) {
+				THROW_NOMIC_TERRAIN_MANAGER_EXCEPTION(NOMIC_TERRAIN_MANAGER_EXCEPTION_UNINITIALIZED);
+			}
+
+			for(iter = m_chunk.begin(); iter != m_chunk.end();) {
+				nomic::entity::chunk *entry = iter->second;
+				std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>>::iterator iter_applied;
+
+				if(EVICT_WINDOW_CONTAINS(center, radius, iter->first.first, iter->first.second)
+						|| EVICT_WINDOW_CONTAINS(predicted, radius, iter->first.first, iter->first.second)) {
+					++iter;
+					continue;
+				}
+
+				// regeneration rebuilds the terrain; edits and received spill-over are all that must survive
+				std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>> edit = entry->edits();
+				if(!edit.empty()) {
+					m_edit[iter->first].swap(edit);
+				}
+
+				iter_applied = m_pending_applied.find(iter->first);
+				if(iter_applied != m_pending_applied.end()) {
+					std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>> &entry_pending = m_pending[iter->first];
+
+					entry_pending.insert(entry_pending.end(), iter_applied->second.begin(), iter_applied->second.end());
+					m_pending_applied.erase(iter_applied);
+				}
+
+				for(uint32_t direction = 0; direction < CHUNK_EDGE_COUNT; ++direction) {
+					edge.insert(std::make_pair(iter->first.first + CHUNK_EDGE[direction].x,
+						iter->first.second + CHUNK_EDGE[direction].y));
+				}
+
+				entry->teardown();
+				m_pool.release(entry);
+				iter = m_chunk.erase(iter);
+				++result;
+			}
+
+			for(iter_edge = edge.begin(); iter_edge != edge.end(); ++iter_edge) { // unlink survivors from evicted neighbors
+				nomic::entity::chunk *neighbor[CHUNK_EDGE_COUNT];
+
+				iter = m_chunk.find(*iter_edge);
+				if(iter == m_chunk.end()) {
+					continue;
+				}
+
+				for(uint32_t direction = 0; direction < CHUNK_EDGE_COUNT; ++direction) {
+					std::map<std::pair<int32_t, int32_t>, nomic::entity::chunk *>::iterator iter_neighbor = m_chunk.find(
+						std::make_pair(iter_edge->first + CHUNK_EDGE[direction].x, iter_edge->second + CHUNK_EDGE[direction].y));
+
+					neighbor[direction] = ((iter_neighbor != m_chunk.end()) ? iter_neighbor->second : nullptr);
+				}
+
+				iter->second->update(neighbor[CHUNK_EDGE_RIGHT], neighbor[CHUNK_EDGE_LEFT], neighbor[CHUNK_EDGE_BACK],
+					neighbor[CHUNK_EDGE_FRONT]);
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u, Pool=%u/%u", result, (uint32_t) m_pool.used(), (uint32_t) m_pool.capacity());
+			return result;
+		}
+
 		std::map<std::pair<int32_t, int32_t>, nomic::entity::chunk *>::iterator 
 		manager::find(
 			__in const glm::ivec2 &position
@@ -131,6 +242,37 @@ namespace nomic {
 			return m_generator;
 		}
 
+		nomic::entity::chunk *
+		manager::insert(
+			__in const nomic::terrain::chunk &chunk
+			)
+		{
+			nomic::entity::chunk *result;
+			glm::ivec2 position = chunk.position();
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Chunk=%p, Position={%i, %i}", &chunk, position.x, position.y);
+
+			if(!m_initialized) {
+				THROW_NOMIC_TERRAIN_MANAGER_EXCEPTION(NOMIC_TERRAIN_MANAGER_EXCEPTION_UNINITIALIZED);
+			}
+
+			std::map<std::pair<int32_t, int32_t>, nomic::entity::chunk *>::iterator iter = m_chunk.find(
+				std::make_pair(position.x, position.y));
+
+			if(iter == m_chunk.end()) {
+
+				result = m_pool.allocate(chunk);
+
+				m_chunk.insert(std::make_pair(std::make_pair(position.x, position.y), result));
+				pending(result);
+			} else {
+				result = iter->second;
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%p", result);
+			return result;
+		}
+
 		bool 
 		manager::on_initialize(void)
 		{
@@ -156,18 +298,643 @@ namespace nomic {
 					++iter) {
 
 				if(iter->second) {
-					delete iter->second;
+					iter->second->teardown();
+				}
+			}
+
+			for(std::map<std::pair<int32_t, int32_t>, nomic::entity::chunk *>::iterator iter = m_chunk.begin(); iter != m_chunk.end();
+					++iter) {
+
+				if(iter->second) {
+					m_pool.release(iter->second);
 					iter->second = nullptr;
 				}
 			}
 
 			m_chunk.clear();
+			m_edit.clear();
+			m_pending.clear();
+			m_pending_applied.clear();
+			m_pool.clear();
+			m_spilled.clear();
 
 			TRACE_MESSAGE(LEVEL_INFORMATION, "Terrain manager uninitialized.");
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
+		void 
+		manager::pending(
+			__in nomic::entity::chunk *chunk
+			)
+		{
+			glm::ivec2 position;
+			std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>> entry;
+			std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>>::iterator iter;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Chunk=%p", chunk);
+
+			position = chunk->position();
+
+			// a regenerated chunk already delivered its spill-over the first time it was created
+			if(m_spilled.insert(std::make_pair(position.x, position.y)).second) {
+
+				entry = chunk->pending();
+				for(iter = entry.begin(); iter != entry.end(); ++iter) { // outgoing
+
+					std::map<std::pair<int32_t, int32_t>, nomic::entity::chunk *>::iterator target = m_chunk.find(iter->first);
+					if(target != m_chunk.end()) {
+						pending_write(target->second, iter->second);
+					} else {
+						std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>> &entry_pending = m_pending[iter->first];
+						entry_pending.insert(entry_pending.end(), iter->second.begin(), iter->second.end());
+					}
+				}
+			}
+
+			iter = m_pending.find(std::make_pair(position.x, position.y));
+			if(iter != m_pending.end()) { // incoming
+				pending_write(chunk, iter->second);
+				m_pending.erase(iter);
+			}
+
+			iter = m_edit.find(std::make_pair(position.x, position.y));
+			if(iter != m_edit.end()) { // edits saved at eviction override whatever was regenerated
+				chunk->set_blocks(iter->second);
+				m_edit.erase(iter);
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		manager::pending_write(
+			__in nomic::entity::chunk *chunk,
+			__in const std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>> &blocks
+			)
+		{
+			glm::ivec2 position_chunk = chunk->position();
+			std::vector<bool> written(CHUNK_BLOCK_COUNT, false);
+			std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>> write;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Chunk=%p, Blocks[%u]=%p", chunk, blocks.size(), &blocks);
+
+			write.reserve(blocks.size());
+
+			for(std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>::const_iterator iter = blocks.begin(); iter != blocks.end();
+					++iter) {
+				const glm::uvec3 &position = std::get<PENDING_POSITION>(*iter);
+				uint32_t index = CHUNK_BLOCK_INDEX(position.x, position.y, position.z);
+
+				// same rule as structure::stamp: spill-over never replaces terrain or another structure, and the first write wins
+				if((index < CHUNK_BLOCK_COUNT) && !written[index]
+						&& !nomic::utility::block_selectable(chunk->block_type(position))) {
+					written[index] = true;
+					write.push_back(*iter);
+				}
+			}
+
+			chunk->set_blocks(write, false);
+
+			// kept so an evicted chunk gets its spill-over back when it is regenerated
+			std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>> &applied = m_pending_applied[std::make_pair(position_chunk.x,
+				position_chunk.y)];
+			applied.insert(applied.end(), blocks.begin(), blocks.end());
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Write[%u]", write.size());
+		}
+
+		const nomic::core::pool<nomic::entity::chunk> &
+		manager::pool(void) const
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u/%u, Slab[%u]", m_pool.used(), m_pool.capacity(), m_pool.slabs());
+			return m_pool;
+		}
+
+		bool 
+		manager::raycast(
+			__in const glm::vec3 &origin,
+			__in const glm::vec3 &direction,
+			__in float range,
+			__inout glm::ivec2 &chunk,
+			__inout glm::uvec3 &block,
+			__inout uint8_t &face,
+			__inout float &distance,
+			__in_opt bool (*predicate)(uint8_t)
+			)
+		{
+			glm::ivec3 step, voxel;
+			bool result = false;
+			glm::vec3 delta, next, ray;
+			nomic::entity::chunk *chunk_ref = nullptr;
+			glm::ivec2 chunk_position = glm::ivec2(INT32_MAX, INT32_MAX);
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Origin={%f, %f, %f}, Direction={%f, %f, %f}, Range=%f, Predicate=%p", origin.x, origin.y,
+				origin.z, direction.x, direction.y, direction.z, range, predicate);
+
+			if(!m_initialized) {
+				THROW_NOMIC_TERRAIN_MANAGER_EXCEPTION(NOMIC_TERRAIN_MANAGER_EXCEPTION_UNINITIALIZED);
+			}
+
+			face = BLOCK_FACE_UNDEFINED;
+			distance = 0.f;
+
+			if(predicate && (glm::length(direction) > 0.f)) {
+				ray = glm::normalize(direction);
+				voxel = glm::ivec3(std::floor(origin.x), std::floor(origin.y), std::floor(origin.z));
+
+				for(int32_t axis = 0; axis < 3; ++axis) {
+
+					if(ray[axis] > 0.f) {
+						step[axis] = 1;
+						delta[axis] = (1.f / ray[axis]);
+						next[axis] = ((voxel[axis] + 1 - origin[axis]) * delta[axis]);
+					} else if(ray[axis] < 0.f) {
+						step[axis] = -1;
+						delta[axis] = (-1.f / ray[axis]);
+						next[axis] = ((origin[axis] - voxel[axis]) * delta[axis]);
+					} else {
+						step[axis] = 0;
+						delta[axis] = std::numeric_limits<float>::infinity();
+						next[axis] = std::numeric_limits<float>::infinity();
+					}
+				}
+
+				for(;;) {
+					int32_t axis = 0;
+
+					if(next.y < next[axis]) {
+						axis = 1;
+					}
+
+					if(next.z < next[axis]) {
+						axis = 2;
+					}
+
+					distance = next[axis];
+					if(distance > range) {
+						break;
+					}
+
+					voxel[axis] += step[axis];
+					next[axis] += delta[axis];
+
+					switch(axis) {
+						case 0:
+							face = ((step.x > 0) ? BLOCK_FACE_LEFT : BLOCK_FACE_RIGHT);
+							break;
+						case 1:
+							face = ((step.y > 0) ? BLOCK_FACE_BOTTOM : BLOCK_FACE_TOP);
+							break;
+						default:
+							face = ((step.z > 0) ? BLOCK_FACE_FRONT : BLOCK_FACE_BACK);
+							break;
+					}
+
+					if((voxel.y < 0) || (voxel.y >= CHUNK_HEIGHT)) {
+
+						if(((voxel.y < 0) && (step.y <= 0)) || ((voxel.y >= CHUNK_HEIGHT) && (step.y >= 0))) {
+							break;
+						}
+
+						continue;
+					}
+
+					chunk = glm::ivec2(FLOOR_DIVIDE(voxel.x, CHUNK_WIDTH), FLOOR_DIVIDE(voxel.z, CHUNK_WIDTH));
+					if(chunk != chunk_position) {
+
+						std::map<std::pair<int32_t, int32_t>, nomic::entity::chunk *>::iterator iter = m_chunk.find(
+							std::make_pair(chunk.x, chunk.y));
+
+						if(iter == m_chunk.end()) {
+							break;
+						}
+
+						chunk_position = chunk;
+						chunk_ref = iter->second;
+					}
+
+					block = glm::uvec3(voxel.x - (chunk.x * CHUNK_WIDTH), voxel.y, voxel.z - (chunk.y * CHUNK_WIDTH));
+					if(chunk_ref && ((predicate == nomic::utility::block_selectable) ? chunk_ref->block_mask(CHUNK_MASK_SELECTABLE,
+							block) : predicate(chunk_ref->block_type(block)))) {
+						result = true;
+						break;
+					}
+				}
+			}
+
+			if(!result) {
+				face = BLOCK_FACE_UNDEFINED;
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x, Chunk={%i, %i}, Block={%u, %u, %u}, Face=%x, Distance=%f", result,
+				chunk.x, chunk.y, block.x, block.y, block.z, face, distance);
+			return result;
+		}
+
+		nomic::entity::chunk *
+		manager::region_block(
+			__in const glm::ivec3 &position,
+			__inout glm::uvec3 &block
+			)
+		{
+			glm::ivec2 chunk;
+			nomic::entity::chunk *result = nullptr;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%i, %i, %i}", position.x, position.y, position.z);
+
+			if((position.y >= 0) && (position.y < CHUNK_HEIGHT)) {
+				chunk = glm::ivec2(FLOOR_DIVIDE(position.x, CHUNK_WIDTH), FLOOR_DIVIDE(position.z, CHUNK_WIDTH));
+
+				std::map<std::pair<int32_t, int32_t>, nomic::entity::chunk *>::iterator iter = m_chunk.find(
+					std::make_pair(chunk.x, chunk.y));
+
+				if(iter != m_chunk.end()) {
+					block = glm::uvec3(position.x - (chunk.x * CHUNK_WIDTH), position.y, position.z - (chunk.y * CHUNK_WIDTH));
+					result = iter->second;
+				}
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%p", result);
+			return result;
+		}
+
+		void 
+		manager::region_bound(
+			__inout glm::ivec3 &lower,
+			__inout glm::ivec3 &upper
+			) const
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Lower={%i, %i, %i}, Upper={%i, %i, %i}", lower.x, lower.y, lower.z, upper.x, upper.y,
+				upper.z);
+
+			if(((upper.x - lower.x) >= REGION_EXTENT_MAX) || ((upper.y - lower.y) >= REGION_EXTENT_MAX)
+					|| ((upper.z - lower.z) >= REGION_EXTENT_MAX)) {
+				THROW_NOMIC_TERRAIN_MANAGER_EXCEPTION_FORMAT(NOMIC_TERRAIN_MANAGER_EXCEPTION_REGION_INVALID,
+					"Lower={%i, %i, %i}, Upper={%i, %i, %i}, Maximum=%u", lower.x, lower.y, lower.z, upper.x, upper.y, upper.z,
+					REGION_EXTENT_MAX);
+			}
+
+			// cells above or below the world hold nothing to edit
+			lower.y = std::max(lower.y, 0);
+			upper.y = std::max(std::min(upper.y, CHUNK_HEIGHT - 1), lower.y - 1);
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Lower={%i, %i, %i}, Upper={%i, %i, %i}", lower.x, lower.y, lower.z, upper.x, upper.y,
+				upper.z);
+		}
+
+		nomic::terrain::region 
+		manager::region_copy(
+			__in const glm::ivec3 &minimum,
+			__in const glm::ivec3 &maximum
+			)
+		{
+			glm::uvec3 block;
+			nomic::terrain::region result;
+			glm::ivec3 lower = glm::min(minimum, maximum), upper = glm::max(minimum, maximum);
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Minimum={%i, %i, %i}, Maximum={%i, %i, %i}", minimum.x, minimum.y, minimum.z,
+				maximum.x, maximum.y, maximum.z);
+
+			if(!m_initialized) {
+				THROW_NOMIC_TERRAIN_MANAGER_EXCEPTION(NOMIC_TERRAIN_MANAGER_EXCEPTION_UNINITIALIZED);
+			}
+
+			region_bound(lower, upper);
+
+			glm::uvec3 &dimensions = std::get<REGION_DIMENSIONS>(result);
+			dimensions = glm::uvec3((upper - lower) + glm::ivec3(1, 1, 1));
+
+			std::vector<uint8_t> &type = std::get<REGION_TYPE>(result);
+			type.resize(dimensions.x * dimensions.y * dimensions.z, BLOCK_AIR);
+
+			std::vector<uint8_t> &attributes = std::get<REGION_ATTRIBUTES>(result);
+			attributes.resize(type.size(), BLOCK_ATTRIBUTES_DEFAULT);
+
+			for(uint32_t x = 0; x < dimensions.x; ++x) {
+
+				for(uint32_t z = 0; z < dimensions.z; ++z) {
+
+					for(uint32_t y = 0; y < dimensions.y; ++y) {
+
+						nomic::entity::chunk *chunk = region_block(lower + glm::ivec3(x, y, z), block);
+						if(chunk) {
+							uint32_t index = REGION_INDEX(dimensions, x, y, z);
+
+							type.at(index) = chunk->block_type(block);
+							attributes.at(index) = chunk->block_attributes(block);
+						}
+					}
+				}
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result={%u, %u, %u}", dimensions.x, dimensions.y, dimensions.z);
+			return result;
+		}
+
+		uint32_t 
+		manager::region_fill(
+			__in const glm::ivec3 &minimum,
+			__in const glm::ivec3 &maximum,
+			__in uint8_t type,
+			__in_opt uint8_t attributes,
+			__inout_opt std::vector<std::pair<glm::ivec2, glm::uvec3>> *boundary
+			)
+		{
+			uint32_t result;
+			glm::ivec3 lower = glm::min(minimum, maximum), upper = glm::max(minimum, maximum);
+			std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>> write;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Minimum={%i, %i, %i}, Maximum={%i, %i, %i}, Type=%x, Attributes=%x, Boundary=%p",
+				minimum.x, minimum.y, minimum.z, maximum.x, maximum.y, maximum.z, type, attributes, boundary);
+
+			if(!m_initialized) {
+				THROW_NOMIC_TERRAIN_MANAGER_EXCEPTION(NOMIC_TERRAIN_MANAGER_EXCEPTION_UNINITIALIZED);
+			}
+
+			region_bound(lower, upper);
+
+			for(int32_t x = lower.x; x <= upper.x; ++x) {
+
+				for(int32_t z = lower.z; z <= upper.z; ++z) {
+
+					for(int32_t y = lower.y; y <= upper.y; ++y) {
+						bool edge = ((x == lower.x) || (x == upper.x) || (y == lower.y) || (y == upper.y)
+							|| (z == lower.z) || (z == upper.z));
+
+						region_insert(write, glm::ivec3(x, y, z), type, attributes, edge ? boundary : nullptr);
+					}
+				}
+			}
+
+			result = region_write(write);
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
+			return result;
+		}
+
+		void 
+		manager::region_insert(
+			__inout std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>> &write,
+			__in const glm::ivec3 &position,
+			__in uint8_t type,
+			__in uint8_t attributes,
+			__inout_opt std::vector<std::pair<glm::ivec2, glm::uvec3>> *boundary
+			)
+		{
+			glm::uvec3 block;
+			nomic::entity::chunk *chunk = nullptr;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Write[%u]=%p, Position={%i, %i, %i}, Type=%x, Attributes=%x, Boundary=%p", write.size(),
+				&write, position.x, position.y, position.z, type, attributes, boundary);
+
+			chunk = region_block(position, block);
+			if(chunk && (chunk->block_type(block) != BLOCK_BOUNDARY)) {
+				glm::ivec2 chunk_position = chunk->position();
+
+				write[std::make_pair(chunk_position.x, chunk_position.y)].push_back(std::make_tuple(block, type, attributes));
+
+				if(boundary) {
+					boundary->push_back(std::make_pair(chunk_position, block));
+				}
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		uint32_t 
+		manager::region_paste(
+			__in const glm::ivec3 &origin,
+			__in const nomic::terrain::region &region,
+			__inout_opt std::vector<std::pair<glm::ivec2, glm::uvec3>> *boundary
+			)
+		{
+			uint32_t result;
+			glm::ivec3 lower, upper;
+			std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>> write;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Origin={%i, %i, %i}, Region=%p, Boundary=%p", origin.x, origin.y, origin.z, &region,
+				boundary);
+
+			if(!m_initialized) {
+				THROW_NOMIC_TERRAIN_MANAGER_EXCEPTION(NOMIC_TERRAIN_MANAGER_EXCEPTION_UNINITIALIZED);
+			}
+
+			const glm::uvec3 &dimensions = std::get<REGION_DIMENSIONS>(region);
+			const std::vector<uint8_t> &type = std::get<REGION_TYPE>(region);
+			const std::vector<uint8_t> &attributes = std::get<REGION_ATTRIBUTES>(region);
+
+			if((type.size() != (dimensions.x * dimensions.y * dimensions.z)) || (attributes.size() != type.size())) {
+				THROW_NOMIC_TERRAIN_MANAGER_EXCEPTION_FORMAT(NOMIC_TERRAIN_MANAGER_EXCEPTION_REGION_INVALID,
+					"Dimensions={%u, %u, %u}, Type[%u], Attributes[%u]", dimensions.x, dimensions.y, dimensions.z,
+					type.size(), attributes.size());
+			}
+
+			lower = origin;
+			upper = (origin + glm::ivec3(dimensions) - glm::ivec3(1, 1, 1));
+			region_bound(lower, upper);
+
+			for(int32_t x = lower.x; x <= upper.x; ++x) {
+
+				for(int32_t z = lower.z; z <= upper.z; ++z) {
+
+					for(int32_t y = lower.y; y <= upper.y; ++y) {
+						bool edge = ((x == lower.x) || (x == upper.x) || (y == lower.y) || (y == upper.y)
+							|| (z == lower.z) || (z == upper.z));
+						uint32_t index = REGION_INDEX(dimensions, x - origin.x, y - origin.y, z - origin.z);
+
+						region_insert(write, glm::ivec3(x, y, z), type.at(index), attributes.at(index), edge ? boundary : nullptr);
+					}
+				}
+			}
+
+			result = region_write(write);
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
+			return result;
+		}
+
+		uint32_t 
+		manager::region_replace(
+			__in const glm::ivec3 &minimum,
+			__in const glm::ivec3 &maximum,
+			__in uint8_t type_from,
+			__in uint8_t type,
+			__in_opt uint8_t attributes,
+			__inout_opt std::vector<std::pair<glm::ivec2, glm::uvec3>> *boundary
+			)
+		{
+			uint32_t result;
+			glm::uvec3 block;
+			glm::ivec3 lower = glm::min(minimum, maximum), upper = glm::max(minimum, maximum);
+			std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>> write;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Minimum={%i, %i, %i}, Maximum={%i, %i, %i}, Type=%x->%x, Attributes=%x, Boundary=%p",
+				minimum.x, minimum.y, minimum.z, maximum.x, maximum.y, maximum.z, type_from, type, attributes, boundary);
+
+			if(!m_initialized) {
+				THROW_NOMIC_TERRAIN_MANAGER_EXCEPTION(NOMIC_TERRAIN_MANAGER_EXCEPTION_UNINITIALIZED);
+			}
+
+			region_bound(lower, upper);
+
+			for(int32_t x = lower.x; x <= upper.x; ++x) {
+
+				for(int32_t z = lower.z; z <= upper.z; ++z) {
+
+					for(int32_t y = lower.y; y <= upper.y; ++y) {
+						glm::ivec3 position(x, y, z);
+
+						nomic::entity::chunk *chunk = region_block(position, block);
+						if(chunk && (chunk->block_type(block) == type_from)) { // replaced cells may border untouched ones anywhere
+							region_insert(write, position, type, attributes, boundary);
+						}
+					}
+				}
+			}
+
+			result = region_write(write);
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
+			return result;
+		}
+
+		uint32_t 
+		manager::region_sphere(
+			__in const glm::ivec3 &center,
+			__in uint32_t radius,
+			__in uint8_t type,
+			__in_opt uint8_t attributes,
+			__inout_opt std::vector<std::pair<glm::ivec2, glm::uvec3>> *boundary
+			)
+		{
+			uint32_t result;
+			int32_t extent = radius, extent_squared = (extent * extent);
+			std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>> write;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Center={%i, %i, %i}, Radius=%u, Type=%x, Attributes=%x, Boundary=%p", center.x,
+				center.y, center.z, radius, type, attributes, boundary);
+
+			if(!m_initialized) {
+				THROW_NOMIC_TERRAIN_MANAGER_EXCEPTION(NOMIC_TERRAIN_MANAGER_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(radius > (REGION_EXTENT_MAX / 2)) {
+				THROW_NOMIC_TERRAIN_MANAGER_EXCEPTION_FORMAT(NOMIC_TERRAIN_MANAGER_EXCEPTION_REGION_INVALID,
+					"Radius=%u, Maximum=%u", radius, REGION_EXTENT_MAX / 2);
+			}
+
+			for(int32_t x = -extent; x <= extent; ++x) {
+
+				for(int32_t z = -extent; z <= extent; ++z) {
+
+					for(int32_t y = -extent; y <= extent; ++y) {
+
+						int32_t distance = ((x * x) + (y * y) + (z * z));
+
+						if(distance <= extent_squared) {
+							bool edge = (((std::abs(x) + 1) * (std::abs(x) + 1)) + (y * y) + (z * z) > extent_squared)
+								|| ((x * x) + ((std::abs(y) + 1) * (std::abs(y) + 1)) + (z * z) > extent_squared)
+								|| ((x * x) + (y * y) + ((std::abs(z) + 1) * (std::abs(z) + 1)) > extent_squared);
+
+							region_insert(write, center + glm::ivec3(x, y, z), type, attributes, edge ? boundary : nullptr);
+						}
+					}
+				}
+			}
+
+			result = region_write(write);
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
+			return result;
+		}
+
+		uint32_t 
+		manager::region_write(
+			__in const std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>> &write
+			)
+		{
+			uint32_t result = 0;
+			std::set<std::pair<int32_t, int32_t>> edge;
+			std::set<std::pair<int32_t, int32_t>>::iterator iter_edge;
+			std::map<std::pair<int32_t, int32_t>, nomic::entity::chunk *>::iterator iter_chunk;
+			std::map<std::pair<int32_t, int32_t>, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>>::const_iterator iter;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Write[%u]=%p", write.size(), &write);
+
+			for(iter = write.begin(); iter != write.end(); ++iter) {
+
+				iter_chunk = m_chunk.find(iter->first);
+				if(iter_chunk == m_chunk.end()) {
+					continue;
+				}
+
+				for(std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>::const_iterator block = iter->second.begin();
+						block != iter->second.end(); ++block) {
+					const glm::uvec3 &position = std::get<PENDING_POSITION>(*block);
+
+					if(!position.x) { // left
+						edge.insert(std::make_pair(iter->first.first - 1, iter->first.second));
+					} else if(position.x == (CHUNK_WIDTH - 1)) { // right
+						edge.insert(std::make_pair(iter->first.first + 1, iter->first.second));
+					}
+
+					if(!position.z) { // front
+						edge.insert(std::make_pair(iter->first.first, iter->first.second - 1));
+					} else if(position.z == (CHUNK_WIDTH - 1)) { // back
+						edge.insert(std::make_pair(iter->first.first, iter->first.second + 1));
+					}
+				}
+
+				iter_chunk->second->set_blocks(iter->second);
+				result += iter->second.size();
+			}
+
+			for(iter_edge = edge.begin(); iter_edge != edge.end(); ++iter_edge) {
+
+				if(write.find(*iter_edge) != write.end()) {
+					continue;
+				}
+
+				iter_chunk = m_chunk.find(*iter_edge);
+				if(iter_chunk != m_chunk.end()) {
+					iter_chunk->second->update();
+				}
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u, Edge[%u]", result, edge.size());
+			return result;
+		}
+
+		void 
+		manager::set_pending(
+			__in const glm::ivec2 &chunk,
+			__in const glm::uvec3 &position,
+			__in uint8_t type,
+			__in_opt uint8_t attributes
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Chunk={%i, %i}, Position={%u, %u, %u}, Type=%x, Attributes=%x", chunk.x, chunk.y,
+				position.x, position.y, position.z, type, attributes);
+
+			if(!m_initialized) {
+				THROW_NOMIC_TERRAIN_MANAGER_EXCEPTION(NOMIC_TERRAIN_MANAGER_EXCEPTION_UNINITIALIZED);
+			}
+
+			std::map<std::pair<int32_t, int32_t>, nomic::entity::chunk *>::iterator iter = m_chunk.find(
+				std::make_pair(chunk.x, chunk.y));
+
+			if(iter != m_chunk.end()) {
+				pending_write(iter->second, std::vector<std::tuple<glm::uvec3, uint8_t, uint8_t>>(1,
+					std::make_tuple(position, type, attributes)));
+			} else {
+				m_pending[std::make_pair(chunk.x, chunk.y)].push_back(std::make_tuple(position, type, attributes));
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
 		std::string 
 		manager::to_string(
 			__in_opt bool verbose
@@ -184,6 +951,8 @@ namespace nomic {
 
 				if(m_initialized) {
 					result << ", Chunk[" << m_chunk.size() << "]"
+						<< ", Pending[" << m_pending.size() << "]"
+						<< ", Pool=" << m_pool.to_string(verbose)
 						<< ", Generator=" << m_generator.to_string(verbose);
 				}
 			}
@@ -35,6 +35,7 @@ namespace nomic {
 		enum {
 			NOMIC_TERRAIN_MANAGER_EXCEPTION_ALLOCATE = 0,
 			NOMIC_TERRAIN_MANAGER_EXCEPTION_NOT_FOUND,
+			NOMIC_TERRAIN_MANAGER_EXCEPTION_REGION_INVALID,
 			NOMIC_TERRAIN_MANAGER_EXCEPTION_UNINITIALIZED,
 		};
 
@@ -43,6 +44,7 @@ namespace nomic {
 		static const std::string NOMIC_TERRAIN_MANAGER_EXCEPTION_STR[] = {
 			NOMIC_TERRAIN_MANAGER_EXCEPTION_HEADER "Failed to allocate chunk",
 			NOMIC_TERRAIN_MANAGER_EXCEPTION_HEADER "Chunk does not exist",
+			NOMIC_TERRAIN_MANAGER_EXCEPTION_HEADER "Invalid region",
 			NOMIC_TERRAIN_MANAGER_EXCEPTION_HEADER "Terrain manager in uninitialized",
 			};
 
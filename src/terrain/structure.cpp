@@ -0,0 +1,221 @@
+/**
+ * Nomic
+ * Copyright (C) 2017 David Jolly
+ *
+ * Nomic is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Nomic is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/terrain/structure.h"
+#include "../../include/trace.h"
+#include "./structure_type.h"
+
+namespace nomic {
+
+	namespace terrain {
+
+		enum {
+			STRUCTURE_OFFSET = 0,
+			STRUCTURE_TYPE,
+			STRUCTURE_ATTRIBUTES,
+		};
+
+		structure::structure(void) :
+			m_maximum(0),
+			m_minimum(0)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		structure::structure(
+			__in const structure &other
+			) :
+				m_block(other.m_block),
+				m_maximum(other.m_maximum),
+				m_minimum(other.m_minimum)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		structure::~structure(void)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		structure &
+		structure::operator=(
+			__in const structure &other
+			)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			if(this != &other) {
+				m_block = other.m_block;
+				m_maximum = other.m_maximum;
+				m_minimum = other.m_minimum;
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%p", this);
+			return *this;
+		}
+
+		void 
+		structure::add(
+			__in const glm::ivec3 &offset,
+			__in uint8_t type,
+			__in_opt uint8_t attributes
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Offset={%i, %i, %i}, Type=%x, Attributes=%x", offset.x, offset.y, offset.z,
+				type, attributes);
+
+			if(m_block.empty()) {
+				m_maximum = offset;
+				m_minimum = offset;
+			} else {
+				m_maximum = glm::max(m_maximum, offset);
+				m_minimum = glm::min(m_minimum, offset);
+			}
+
+			m_block.push_back(std::make_tuple(offset, type, attributes));
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		structure::clear(void)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			m_block.clear();
+			m_maximum = glm::ivec3(0);
+			m_minimum = glm::ivec3(0);
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		bool 
+		structure::empty(void) const
+		{
+			bool result;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			result = m_block.empty();
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
+			return result;
+		}
+
+		glm::ivec3 
+		structure::maximum(void) const
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result={%i, %i, %i}", m_maximum.x, m_maximum.y, m_maximum.z);
+			return m_maximum;
+		}
+
+		glm::ivec3 
+		structure::minimum(void) const
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result={%i, %i, %i}", m_minimum.x, m_minimum.y, m_minimum.z);
+			return m_minimum;
+		}
+
+		size_t 
+		structure::size(void) const
+		{
+			size_t result;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			result = m_block.size();
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
+			return result;
+		}
+
+		void 
+		structure::stamp(
+			__in const glm::uvec3 &position,
+			__inout nomic::terrain::chunk &chunk
+			) const
+		{
+			bool contained;
+			glm::ivec2 position_chunk;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Position={%u, %u, %u}, Chunk=%p", position.x, position.y, position.z, &chunk);
+
+			if((position.x >= CHUNK_WIDTH) || (position.y >= CHUNK_HEIGHT) || (position.z >= CHUNK_WIDTH)) {
+				THROW_NOMIC_TERRAIN_STRUCTURE_EXCEPTION_FORMAT(NOMIC_TERRAIN_STRUCTURE_EXCEPTION_POSITION_INVALID,
+					"Position={%u, %u, %u}", position.x, position.y, position.z);
+			}
+
+			position_chunk = chunk.position();
+			contained = (((int32_t) position.x + m_minimum.x) >= 0) && (((int32_t) position.x + m_maximum.x) < CHUNK_WIDTH)
+				&& (((int32_t) position.z + m_minimum.z) >= 0) && (((int32_t) position.z + m_maximum.z) < CHUNK_WIDTH);
+
+			for(std::vector<std::tuple<glm::ivec3, uint8_t, uint8_t>>::const_iterator iter = m_block.begin();
+					iter != m_block.end(); ++iter) {
+				glm::ivec3 position_block = (glm::ivec3(position) + std::get<STRUCTURE_OFFSET>(*iter));
+
+				if((position_block.y < 0) || (position_block.y >= CHUNK_HEIGHT)) {
+					continue;
+				}
+
+				if(contained || ((position_block.x >= 0) && (position_block.x < CHUNK_WIDTH)
+						&& (position_block.z >= 0) && (position_block.z < CHUNK_WIDTH))) {
+
+					if(!nomic::utility::block_selectable(chunk.type(glm::uvec3(position_block)))) {
+						chunk.set_block(glm::uvec3(position_block), std::get<STRUCTURE_TYPE>(*iter),
+							std::get<STRUCTURE_ATTRIBUTES>(*iter));
+					}
+				} else { // pending
+					glm::ivec2 offset = glm::ivec2(FLOOR_DIVIDE(position_block.x, CHUNK_WIDTH),
+						FLOOR_DIVIDE(position_block.z, CHUNK_WIDTH));
+
+					chunk.set_pending(position_chunk + offset, glm::uvec3(position_block.x - (offset.x * CHUNK_WIDTH),
+						position_block.y, position_block.z - (offset.y * CHUNK_WIDTH)), std::get<STRUCTURE_TYPE>(*iter),
+						std::get<STRUCTURE_ATTRIBUTES>(*iter));
+				}
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		std::string 
+		structure::to_string(
+			__in_opt bool verbose
+			) const
+		{
+			std::stringstream result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Verbose=%x", verbose);
+
+			result << NOMIC_TERRAIN_STRUCTURE_HEADER << "(" << SCALAR_AS_HEX(uintptr_t, this) << ")";
+
+			if(verbose) {
+				result << " Block[" << m_block.size() << "]"
+					<< ", Bounds={" << m_minimum.x << ", " << m_minimum.y << ", " << m_minimum.z << "}-{"
+						<< m_maximum.x << ", " << m_maximum.y << ", " << m_maximum.z << "}";
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+			return result.str();
+		}
+	}
+}
@@ -0,0 +1,447 @@
+/**
+ * Nomic
+ * Copyright (C) 2017 David Jolly
+ *
+ * Nomic is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Nomic is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/terrain/water.h"
+#include "../../include/trace.h"
+#include "./water_type.h"
+
+namespace nomic {
+
+	namespace terrain {
+
+		#define WATER_CELL(_CHUNK_, _BLOCK_) \
+			std::make_pair(std::make_pair((_CHUNK_).x, (_CHUNK_).y), \
+				((((_BLOCK_).x * CHUNK_HEIGHT) + (_BLOCK_).y) * CHUNK_WIDTH) + (_BLOCK_).z)
+
+		enum {
+			WRITE_CHUNK = 0,
+			WRITE_BLOCK,
+			WRITE_TYPE,
+			WRITE_ATTRIBUTES,
+		};
+
+		static const glm::ivec3 WATER_NEIGHBOR[] = {
+			{ 1, 0, 0 }, // right
+			{ -1, 0, 0 }, // left
+			{ 0, 1, 0 }, // top
+			{ 0, -1, 0 }, // bottom
+			{ 0, 0, 1 }, // back
+			{ 0, 0, -1 }, // front
+			};
+
+		static const uint32_t WATER_SPREAD[] = {
+			BLOCK_FACE_RIGHT,
+			BLOCK_FACE_LEFT,
+			BLOCK_FACE_BACK,
+			BLOCK_FACE_FRONT,
+			};
+
+		water::water(void) :
+			m_tick(0)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		water::water(
+			__in const water &other
+			) :
+				m_active(other.m_active),
+				m_active_cell(other.m_active_cell),
+				m_tick(other.m_tick),
+				m_write(other.m_write)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		water::~water(void)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		water &
+		water::operator=(
+			__in const water &other
+			)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			if(this != &other) {
+				m_active = other.m_active;
+				m_active_cell = other.m_active_cell;
+				m_tick = other.m_tick;
+				m_write = other.m_write;
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%p", this);
+			return *this;
+		}
+
+		void 
+		water::activate(
+			__in const glm::ivec2 &chunk,
+			__in const glm::uvec3 &block
+			)
+		{
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Chunk={%i, %i}, Block={%u, %u, %u}", chunk.x, chunk.y, block.x, block.y, block.z);
+
+			if((block.x >= CHUNK_WIDTH) || (block.y >= CHUNK_HEIGHT) || (block.z >= CHUNK_WIDTH)) {
+				THROW_NOMIC_TERRAIN_WATER_EXCEPTION_FORMAT(NOMIC_TERRAIN_WATER_EXCEPTION_POSITION_INVALID,
+					"Block={%u, %u, %u}", block.x, block.y, block.z);
+			}
+
+			if(m_active_cell.insert(WATER_CELL(chunk, block)).second) {
+				m_active.push(std::make_pair(chunk, block));
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		water::clear(void)
+		{
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			m_active = std::queue<std::pair<glm::ivec2, glm::uvec3>>();
+			m_active_cell.clear();
+			m_tick = 0;
+			m_write.clear();
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		uint32_t 
+		water::count(void) const
+		{
+			uint32_t result;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			result = m_active.size();
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
+			return result;
+		}
+
+		void 
+		water::flush(
+			__in nomic::terrain::manager &terrain
+			)
+		{
+			std::set<std::pair<int32_t, int32_t>> edge;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Terrain=%p, Write[%u]", &terrain, m_write.size());
+
+			for(std::map<water_cell, std::tuple<glm::ivec2, glm::uvec3, uint8_t, uint8_t>>::iterator iter = m_write.begin();
+					iter != m_write.end(); ++iter) {
+				glm::ivec2 &chunk = std::get<WRITE_CHUNK>(iter->second);
+				glm::uvec3 &block = std::get<WRITE_BLOCK>(iter->second);
+
+				if(!terrain.contains(chunk)) {
+					continue;
+				}
+
+				terrain.at(chunk, false)->set_block(block, std::get<WRITE_TYPE>(iter->second),
+					std::get<WRITE_ATTRIBUTES>(iter->second), true);
+				activate(chunk, block);
+
+				if(block.x == (CHUNK_WIDTH - 1)) { // right
+					edge.insert(std::make_pair(chunk.x + 1, chunk.y));
+				} else if(!block.x) { // left
+					edge.insert(std::make_pair(chunk.x - 1, chunk.y));
+				}
+
+				if(block.z == (CHUNK_WIDTH - 1)) { // back
+					edge.insert(std::make_pair(chunk.x, chunk.y + 1));
+				} else if(!block.z) { // front
+					edge.insert(std::make_pair(chunk.x, chunk.y - 1));
+				}
+			}
+
+			for(std::set<std::pair<int32_t, int32_t>>::iterator iter = edge.begin(); iter != edge.end(); ++iter) {
+				glm::ivec2 position = glm::ivec2(iter->first, iter->second);
+
+				if(terrain.contains(position)) {
+					terrain.at(position, false)->update();
+				}
+			}
+
+			m_write.clear();
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		nomic::entity::chunk *
+		water::neighbor(
+			__in nomic::terrain::manager &terrain,
+			__in const glm::ivec2 &chunk,
+			__in const glm::uvec3 &block,
+			__in uint32_t face,
+			__inout glm::ivec2 &chunk_neighbor,
+			__inout glm::uvec3 &block_neighbor
+			)
+		{
+			nomic::entity::chunk *result = nullptr;
+			glm::ivec3 position = (glm::ivec3(block) + WATER_NEIGHBOR[face]);
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Terrain=%p, Chunk={%i, %i}, Block={%u, %u, %u}, Face=%x", &terrain, chunk.x, chunk.y,
+				block.x, block.y, block.z, face);
+
+			if((position.y >= 0) && (position.y < CHUNK_HEIGHT)) {
+				chunk_neighbor = chunk;
+
+				if(position.x >= CHUNK_WIDTH) { // right
+					position.x -= CHUNK_WIDTH;
+					++chunk_neighbor.x;
+				} else if(position.x < 0) { // left
+					position.x += CHUNK_WIDTH;
+					--chunk_neighbor.x;
+				}
+
+				if(position.z >= CHUNK_WIDTH) { // back
+					position.z -= CHUNK_WIDTH;
+					++chunk_neighbor.y;
+				} else if(position.z < 0) { // front
+					position.z += CHUNK_WIDTH;
+					--chunk_neighbor.y;
+				}
+
+				block_neighbor = glm::uvec3(position);
+
+				if(terrain.contains(chunk_neighbor)) {
+					result = terrain.at(chunk_neighbor, false);
+				}
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%p", result);
+			return result;
+		}
+
+		uint32_t 
+		water::sources(
+			__in nomic::terrain::manager &terrain,
+			__in const glm::ivec2 &chunk,
+			__in const glm::uvec3 &block
+			)
+		{
+			uint32_t result = 0;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Terrain=%p, Chunk={%i, %i}, Block={%u, %u, %u}", &terrain, chunk.x, chunk.y,
+				block.x, block.y, block.z);
+
+			for(uint32_t iter = 0; iter < (sizeof(WATER_SPREAD) / sizeof(WATER_SPREAD[0])); ++iter) {
+				glm::ivec2 chunk_neighbor;
+				glm::uvec3 block_neighbor;
+
+				nomic::entity::chunk *entry = neighbor(terrain, chunk, block, WATER_SPREAD[iter], chunk_neighbor, block_neighbor);
+				if(entry && (entry->block_type(block_neighbor) == BLOCK_WATER)
+						&& (WATER_LEVEL(entry->block_attributes(block_neighbor)) == WATER_LEVEL_SOURCE)) {
+					++result;
+				}
+			}
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
+			return result;
+		}
+
+		void 
+		water::step(
+			__in nomic::terrain::manager &terrain,
+			__in const glm::ivec2 &chunk,
+			__in const glm::uvec3 &block
+			)
+		{
+			uint8_t level, type_below = BLOCK_BOUNDARY;
+			glm::ivec2 chunk_neighbor;
+			glm::uvec3 block_neighbor;
+			nomic::entity::chunk *entry, *entry_neighbor;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Terrain=%p, Chunk={%i, %i}, Block={%u, %u, %u}", &terrain, chunk.x, chunk.y,
+				block.x, block.y, block.z);
+
+			if(!terrain.contains(chunk)) {
+				TRACE_EXIT(LEVEL_VERBOSE);
+				return;
+			}
+
+			entry = terrain.at(chunk, false);
+			if(entry->block_type(block) != BLOCK_WATER) { // wake adjacent water
+
+				for(uint32_t face = BLOCK_FACE_MIN; face <= BLOCK_FACE_MAX; ++face) {
+
+					entry_neighbor = neighbor(terrain, chunk, block, face, chunk_neighbor, block_neighbor);
+					if(entry_neighbor && (entry_neighbor->block_type(block_neighbor) == BLOCK_WATER)) {
+						activate(chunk_neighbor, block_neighbor);
+					}
+				}
+
+				TRACE_EXIT(LEVEL_VERBOSE);
+				return;
+			}
+
+			level = WATER_LEVEL(entry->block_attributes(block));
+			if(level != WATER_LEVEL_SOURCE) { // flowing water must be fed from above or from a lower level
+				uint8_t level_support = (WATER_LEVEL_MAX + 1);
+
+				entry_neighbor = neighbor(terrain, chunk, block, BLOCK_FACE_TOP, chunk_neighbor, block_neighbor);
+				if(entry_neighbor && (entry_neighbor->block_type(block_neighbor) == BLOCK_WATER)) {
+					level_support = WATER_LEVEL_FALLING;
+				} else {
+
+					for(uint32_t iter = 0; iter < (sizeof(WATER_SPREAD) / sizeof(WATER_SPREAD[0])); ++iter) {
+
+						entry_neighbor = neighbor(terrain, chunk, block, WATER_SPREAD[iter], chunk_neighbor, block_neighbor);
+						if(entry_neighbor && (entry_neighbor->block_type(block_neighbor) == BLOCK_WATER)) {
+							uint8_t level_neighbor = WATER_LEVEL(entry_neighbor->block_attributes(block_neighbor));
+
+							if((level_neighbor < level) && ((level_neighbor + 1) < level_support)) {
+								level_support = (level_neighbor + 1);
+							}
+						}
+					}
+				}
+
+				if(level_support > WATER_LEVEL_MAX) { // unsupported
+					write(chunk, block, BLOCK_AIR, BLOCK_ATTRIBUTES_DEFAULT);
+					TRACE_EXIT(LEVEL_VERBOSE);
+					return;
+				} else if(level_support != level) {
+					level = level_support;
+					write(chunk, block, BLOCK_WATER, WATER_LEVEL_ATTRIBUTES(WATER_ATTRIBUTES, level));
+				}
+			}
+
+			entry_neighbor = neighbor(terrain, chunk, block, BLOCK_FACE_BOTTOM, chunk_neighbor, block_neighbor);
+			if(entry_neighbor) { // fall
+				type_below = entry_neighbor->block_type(block_neighbor);
+
+				if(type_below == BLOCK_AIR) {
+					write(chunk_neighbor, block_neighbor, BLOCK_WATER, WATER_LEVEL_ATTRIBUTES(WATER_ATTRIBUTES,
+						WATER_LEVEL_FALLING));
+					TRACE_EXIT(LEVEL_VERBOSE);
+					return;
+				}
+			}
+
+			if((level < WATER_LEVEL_MAX) && ((level == WATER_LEVEL_SOURCE) || (type_below != BLOCK_WATER))) { // spread
+
+				for(uint32_t iter = 0; iter < (sizeof(WATER_SPREAD) / sizeof(WATER_SPREAD[0])); ++iter) {
+					uint8_t type_neighbor;
+
+					entry_neighbor = neighbor(terrain, chunk, block, WATER_SPREAD[iter], chunk_neighbor, block_neighbor);
+					if(!entry_neighbor) {
+						continue;
+					}
+
+					type_neighbor = entry_neighbor->block_type(block_neighbor);
+					if(type_neighbor == BLOCK_AIR) {
+						uint8_t level_neighbor = (level + 1);
+
+						if(sources(terrain, chunk_neighbor, block_neighbor) >= WATER_SOURCE_MIN) {
+							level_neighbor = WATER_LEVEL_SOURCE;
+						}
+
+						write(chunk_neighbor, block_neighbor, BLOCK_WATER, WATER_LEVEL_ATTRIBUTES(WATER_ATTRIBUTES,
+							level_neighbor));
+					} else if((type_neighbor == BLOCK_WATER)
+							&& (WATER_LEVEL(entry_neighbor->block_attributes(block_neighbor)) > (level + 1))) {
+						write(chunk_neighbor, block_neighbor, BLOCK_WATER, WATER_LEVEL_ATTRIBUTES(WATER_ATTRIBUTES,
+							level + 1));
+					}
+				}
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		std::string 
+		water::to_string(
+			__in_opt bool verbose
+			) const
+		{
+			std::stringstream result;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Verbose=%x", verbose);
+
+			result << NOMIC_TERRAIN_WATER_HEADER << "(" << SCALAR_AS_HEX(uintptr_t, this) << ")";
+
+			if(verbose) {
+				result << " Active[" << m_active.size() << "]"
+					<< ", Write[" << m_write.size() << "]"
+					<< ", Tick=" << m_tick;
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+			return result.str();
+		}
+
+		void 
+		water::update(
+			__in nomic::terrain::manager &terrain
+			)
+		{
+			uint32_t count;
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Terrain=%p", &terrain);
+
+			if(!terrain.initialized()) {
+				THROW_NOMIC_TERRAIN_WATER_EXCEPTION(NOMIC_TERRAIN_WATER_EXCEPTION_TERRAIN_INVALID);
+			}
+
+			if(!m_active.empty() && !(++m_tick % WATER_UPDATE_INTERVAL)) {
+
+				count = std::min((uint32_t) m_active.size(), (uint32_t) WATER_UPDATE_BUDGET);
+				while(count--) {
+					std::pair<glm::ivec2, glm::uvec3> cell = m_active.front();
+
+					m_active.pop();
+					m_active_cell.erase(WATER_CELL(cell.first, cell.second));
+					step(terrain, cell.first, cell.second);
+				}
+
+				flush(terrain);
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+
+		void 
+		water::write(
+			__in const glm::ivec2 &chunk,
+			__in const glm::uvec3 &block,
+			__in uint8_t type,
+			__in uint8_t attributes
+			)
+		{
+			water_cell cell = WATER_CELL(chunk, block);
+
+			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Chunk={%i, %i}, Block={%u, %u, %u}, Type=%x, Attributes=%x", chunk.x, chunk.y,
+				block.x, block.y, block.z, type, attributes);
+
+			std::map<water_cell, std::tuple<glm::ivec2, glm::uvec3, uint8_t, uint8_t>>::iterator iter = m_write.find(cell);
+			if((iter == m_write.end()) || (std::get<WRITE_TYPE>(iter->second) != BLOCK_WATER)
+					|| ((type == BLOCK_WATER) && (WATER_LEVEL(attributes) < WATER_LEVEL(std::get<WRITE_ATTRIBUTES>(iter->second))))) {
+				m_write[cell] = std::make_tuple(chunk, block, type, attributes);
+			}
+
+			TRACE_EXIT(LEVEL_VERBOSE);
+		}
+	}
+}
@@ -23,6 +23,8 @@
 
 namespace nomic {
 
+	#define HASH_PRIME 0x100000001b3ULL
+
 	#define TIMESTAMP_FORMAT "%Y-%m-%d %H:%M:%S"
 	#define TIMESTAMP_LENGTH 64
 
@@ -43,36 +45,6 @@ namespace nomic {
 		return result;
 	}
 
-	bool 
-	utility::block_decoration(
-		__in uint8_t type
-		)
-	{
-		bool result = false;
-
-		switch(type) {
-			case BLOCK_CORAL_BLUE:
-			case BLOCK_CORAL_BROWN:
-			case BLOCK_CORAL_ORANGE:
-			case BLOCK_CORAL_PINK:
-			case BLOCK_CORAL_PURPLE:
-			case BLOCK_FLOWER_RED:
-			case BLOCK_FLOWER_YELLOW:
-			case BLOCK_GRASS_SHORT:
-			case BLOCK_GRASS_TALL:
-			case BLOCK_SEAGRASS_GREEN:
-			case BLOCK_SEAGRASS_BROWN:
-			case BLOCK_SHRUB:
-			case BLOCK_SUGAR_CANE:
-				result = true;
-				break;
-			default:
-				break;
-		}
-
-		return result;
-	}
-
 	uint8_t 
 	utility::block_face_type(
 		__in uint8_t type,
@@ -82,130 +54,21 @@ namespace nomic {
 	{
 		uint8_t result = BLOCK_AIR;
 
-		switch(type) {
-			case BLOCK_AIR:
-			case BLOCK_BOUNDARY:
-			case BLOCK_BRICK:
-			case BLOCK_CLAY:
-			case BLOCK_CLOUD:
-			case BLOCK_COBBLESTONE:
-			case BLOCK_COBBLESTONE_MOSSY:
-			case BLOCK_CORAL_BLUE:
-			case BLOCK_CORAL_BROWN:
-			case BLOCK_CORAL_ORANGE:
-			case BLOCK_CORAL_PINK:
-			case BLOCK_CORAL_PURPLE:
-			case BLOCK_DIRT:
-			case BLOCK_FLOWER_RED:
-			case BLOCK_FLOWER_YELLOW:
-			case BLOCK_GLASS:
-			case BLOCK_GRASS_SHORT:
-			case BLOCK_GRASS_TALL:
-			case BLOCK_GRAVEL:
-			case BLOCK_LEAVES_OAK:
-			case BLOCK_LEAVES_SPRUCE:
-			case BLOCK_OBSIDIAN:
-			case BLOCK_ORE_GOLD:
-			case BLOCK_ORE_IRON:
-			case BLOCK_ORE_COAL:
-			case BLOCK_ORE_DIAMOND:
-			case BLOCK_PLANK_OAK:
-			case BLOCK_PLANK_SPRUCE:
-			case BLOCK_SAND:
-			case BLOCK_SEAGRASS_GREEN:
-			case BLOCK_SEAGRASS_BROWN:
-			case BLOCK_SHRUB:
-			case BLOCK_STONE:
-			case BLOCK_SUGAR_CANE:
-			case BLOCK_WATER:
-				result = type;
-				break;
-			case BLOCK_CACTUS:
-
-				switch(face) {
-					case BLOCK_FACE_BACK:
-					case BLOCK_FACE_FRONT:
-					case BLOCK_FACE_LEFT:
-					case BLOCK_FACE_RIGHT:
-						result = BLOCK_CACTUS_SIDE;
-						break;
-					case BLOCK_FACE_BOTTOM:
-						result = BLOCK_CACTUS_BOTTOM;
-						break;
-					case BLOCK_FACE_TOP:
-						result = BLOCK_CACTUS;
-						break;
-					default:
-						THROW_NOMIC_UTILITY_EXCEPTION_FORMAT(NOMIC_UTILITY_EXCEPTION_FACE_INVALID, "Face=%x", face);
-				}
-				break;
-			case BLOCK_GRASS:
-
-				switch(face) {
-					case BLOCK_FACE_BACK:
-					case BLOCK_FACE_FRONT:
-					case BLOCK_FACE_LEFT:
-					case BLOCK_FACE_RIGHT:
-						result = BLOCK_DIRT_GRASS_SIDE;
-						break;
-					case BLOCK_FACE_BOTTOM:
-						result = BLOCK_DIRT;
-						break;
-					case BLOCK_FACE_TOP:
-						result = BLOCK_GRASS;
-						break;
-					default:
-						THROW_NOMIC_UTILITY_EXCEPTION_FORMAT(NOMIC_UTILITY_EXCEPTION_FACE_INVALID, "Face=%x", face);
-				}
-				break;
-			case BLOCK_SANDSTONE:
-
-				switch(face) {
-					case BLOCK_FACE_BACK:
-					case BLOCK_FACE_FRONT:
-					case BLOCK_FACE_LEFT:
-					case BLOCK_FACE_RIGHT:
-						result = BLOCK_SANDSTONE_SIDE;
-						break;
-					case BLOCK_FACE_BOTTOM:
-					case BLOCK_FACE_TOP:
-						result = BLOCK_SANDSTONE;
-						break;
-					default:
-						THROW_NOMIC_UTILITY_EXCEPTION_FORMAT(NOMIC_UTILITY_EXCEPTION_FACE_INVALID, "Face=%x", face);
-				}
-				break;
-			case BLOCK_SNOW:
-
-				switch(face) {
-					case BLOCK_FACE_BACK:
-					case BLOCK_FACE_FRONT:
-					case BLOCK_FACE_LEFT:
-					case BLOCK_FACE_RIGHT:
-						result = BLOCK_STONE_SNOW_SIDE;
-						break;
-					case BLOCK_FACE_BOTTOM:
-						result = BLOCK_STONE;
-						break;
-					case BLOCK_FACE_TOP:
-						result = BLOCK_SNOW;
-						break;
-					default:
-						THROW_NOMIC_UTILITY_EXCEPTION_FORMAT(NOMIC_UTILITY_EXCEPTION_FACE_INVALID, "Face=%x", face);
-				}
-				break;
-			case BLOCK_WOOD_OAK:
-				attributes |= BLOCK_ATTRIBUTE_ROTATABLE;
-				result = nomic::utility::block_face_type_rotated(face, attributes, BLOCK_WOOD_OAK, BLOCK_WOOD_OAK,
-					BLOCK_WOOD_OAK_SIDE);
-				break;
-			case BLOCK_WOOD_SPRUCE:
-				attributes |= BLOCK_ATTRIBUTE_ROTATABLE;
-				result = nomic::utility::block_face_type_rotated(face, attributes, BLOCK_WOOD_SPRUCE, BLOCK_WOOD_SPRUCE,
-					BLOCK_WOOD_SPRUCE_SIDE);
-				break;
-			default:
-				THROW_NOMIC_UTILITY_EXCEPTION_FORMAT(NOMIC_UTILITY_EXCEPTION_TYPE_INVALID, "Type=%x", type);
+		if((type > BLOCK_MAX) || (BLOCK_FLAG[type] & BLOCK_FLAG_TEXTURE)) {
+			THROW_NOMIC_UTILITY_EXCEPTION_FORMAT(NOMIC_UTILITY_EXCEPTION_TYPE_INVALID, "Type=%x", type);
+		}
+
+		if(face > BLOCK_FACE_MAX) {
+			THROW_NOMIC_UTILITY_EXCEPTION_FORMAT(NOMIC_UTILITY_EXCEPTION_FACE_INVALID, "Face=%x", face);
+		}
+
+		if(BLOCK_FLAG[type] & BLOCK_FLAG_ROTATABLE) {
+			attributes |= BLOCK_ATTRIBUTE_ROTATABLE;
+			result = nomic::utility::block_face_type_rotated(face, attributes,
+				BLOCK_FACE_TEXTURE[type][BLOCK_FACE_TOP], BLOCK_FACE_TEXTURE[type][BLOCK_FACE_BOTTOM],
+				BLOCK_FACE_TEXTURE[type][BLOCK_FACE_RIGHT]);
+		} else {
+			result = BLOCK_FACE_TEXTURE[type][face];
 		}
 
 		return result;
@@ -294,114 +157,6 @@ namespace nomic {
 		return result;
 	}
 
-	bool 
-	utility::block_passable(
-		__in uint8_t type
-		)
-	{
-		bool result = false;
-
-		switch(type) {
-			case BLOCK_AIR:
-			case BLOCK_CLOUD:
-			case BLOCK_CORAL_BLUE:
-			case BLOCK_CORAL_BROWN:
-			case BLOCK_CORAL_ORANGE:
-			case BLOCK_CORAL_PINK:
-			case BLOCK_CORAL_PURPLE:
-			case BLOCK_FLOWER_RED:
-			case BLOCK_FLOWER_YELLOW:
-			case BLOCK_GRASS_SHORT:
-			case BLOCK_GRASS_TALL:
-			case BLOCK_SEAGRASS_GREEN:
-			case BLOCK_SEAGRASS_BROWN:
-			case BLOCK_SHRUB:
-			case BLOCK_SUGAR_CANE:
-			case BLOCK_WATER:
-				result = true;
-				break;
-			default:
-				break;
-		}
-
-		return result;
-	}
-
-	bool 
-	utility::block_selectable(
-		__in uint8_t type
-		)
-	{
-		bool result = true;
-
-		switch(type) {
-			case BLOCK_AIR:
-			case BLOCK_CLOUD:
-			case BLOCK_WATER:
-				result = false;
-				break;
-			default:
-				break;
-		}
-
-		return result;
-	}
-
-	bool 
-	utility::block_small(
-		__in uint8_t type
-		)
-	{
-		bool result = false;
-
-		switch(type) {
-			case BLOCK_CACTUS:
-				result = true;
-				break;
-			default:
-				break;
-		}
-
-		return result;
-	}
-
-	bool 
-	utility::block_transparent(
-		__in uint8_t type
-		)
-	{
-		bool result = false;
-
-		switch(type) {
-			case BLOCK_AIR:
-			case BLOCK_CACTUS:
-			case BLOCK_CLOUD:
-			case BLOCK_CORAL_BLUE:
-			case BLOCK_CORAL_BROWN:
-			case BLOCK_CORAL_ORANGE:
-			case BLOCK_CORAL_PINK:
-			case BLOCK_CORAL_PURPLE:
-			case BLOCK_FLOWER_RED:
-			case BLOCK_FLOWER_YELLOW:
-			case BLOCK_GLASS:
-			case BLOCK_GRASS_SHORT:
-			case BLOCK_GRASS_TALL:
-			case BLOCK_LEAVES_OAK:
-			case BLOCK_LEAVES_SPRUCE:
-			case BLOCK_SEAGRASS_GREEN:
-			case BLOCK_SEAGRASS_BROWN:
-			case BLOCK_SHRUB:
-			case BLOCK_SUGAR_CANE:
-			case BLOCK_WATER:
-				result = true;
-				break;
-			default:
-				break;
-		}
-
-		return result;
-	}
-
 	std::string 
 	utility::format_as_string(
 		__in const char *format,
@@ -432,6 +187,23 @@ namespace nomic {
 		return result;
 	}
 
+	uint64_t 
+	utility::hash(
+		__in const void *data,
+		__in size_t length,
+		__in_opt uint64_t seed
+		)
+	{
+		uint64_t result = seed;
+
+		for(size_t iter = 0; iter < length; ++iter) {
+			result ^= ((const uint8_t *) data)[iter];
+			result *= HASH_PRIME;
+		}
+
+		return result;
+	}
+
 	void 
 	utility::position_as_block(
 		__in const glm::vec3 &position,
@@ -16,6 +16,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <functional>
+#include <thread>
 #include "../../include/uuid/manager.h"
 #include "../../include/trace.h"
 #include "./manager_type.h"
@@ -24,10 +26,19 @@ namespace nomic {
 
 	namespace uuid {
 
-		manager::manager(void) :
-			m_id_next(UID_INVALID + 1)
+		#define UID_GENERATION(_ID_) (((_ID_) >> (UID_INDEX_BITS + UID_SHARD_BITS)) & UID_GENERATION_MASK)
+		#define UID_INDEX(_ID_) ((_ID_) & UID_INDEX_MASK)
+		#define UID_MAKE(_GENERATION_, _SHARD_, _INDEX_) \
+			((((_GENERATION_) & UID_GENERATION_MASK) << (UID_INDEX_BITS + UID_SHARD_BITS)) \
+				| (((_SHARD_) & UID_SHARD_MASK) << UID_INDEX_BITS) | ((_INDEX_) & UID_INDEX_MASK))
+		#define UID_SHARD(_ID_) (((_ID_) >> UID_INDEX_BITS) & UID_SHARD_MASK)
+
+		manager::manager(void)
 		{
 			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			clear();
+
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
 
@@ -42,9 +53,10 @@ namespace nomic {
 		{
 			TRACE_ENTRY(LEVEL_VERBOSE);
 
-			m_id.clear();
-			m_id_next = (UID_INVALID + 1);
-			m_id_surplus.clear();
+			for(uint32_t iter = 0; iter < UID_SHARD_COUNT; ++iter) {
+				m_free[iter] = UID_SLOT_NONE;
+				m_slot[iter].clear();
+			}
 
 			TRACE_EXIT(LEVEL_VERBOSE);
 		}
@@ -54,12 +66,10 @@ namespace nomic {
 			__in uint32_t id
 			)
 		{
-			bool result;
+			bool result = false;
 
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Id=%x", id);
 
-			std::lock_guard<std::mutex> lock(m_mutex);
-
 			if(!m_initialized) {
 				THROW_NOMIC_UUID_MANAGER_EXCEPTION(NOMIC_UUID_MANAGER_EXCEPTION_UNINITIALIZED);
 			}
@@ -68,7 +78,14 @@ namespace nomic {
 				THROW_NOMIC_UUID_MANAGER_EXCEPTION_FORMAT(NOMIC_UUID_MANAGER_EXCEPTION_INVALID, "Id=%x", id);
 			}
 
-			result = (m_id.find(id) != m_id.end());
+			std::lock_guard<std::mutex> lock(m_mutex[UID_SHARD(id)]);
+
+			std::vector<nomic::uuid::uid_slot> &slot = m_slot[UID_SHARD(id)];
+			if(UID_INDEX(id) < slot.size()) {
+				nomic::uuid::uid_slot &entry = slot.at(UID_INDEX(id));
+				result = ((std::get<UID_SLOT_GENERATION>(entry) == UID_GENERATION(id))
+					&& (std::get<UID_SLOT_REFERENCE>(entry) >= REFERENCE_INIT));
+			}
 
 			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
 			return result;
@@ -83,44 +100,47 @@ namespace nomic {
 
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Id=%x", id);
 
-			std::lock_guard<std::mutex> lock(m_mutex);
-
 			if(!m_initialized) {
 				THROW_NOMIC_UUID_MANAGER_EXCEPTION(NOMIC_UUID_MANAGER_EXCEPTION_UNINITIALIZED);
 			}
 
-			std::map<uint32_t, size_t>::iterator iter = find(id);
-			if(iter->second <= REFERENCE_INIT) {
+			std::lock_guard<std::mutex> lock(m_mutex[UID_SHARD(id)]);
 
-				if(m_id_surplus.find(iter->first) != m_id_surplus.end()) {
-					THROW_NOMIC_UUID_MANAGER_EXCEPTION_FORMAT(NOMIC_UUID_MANAGER_EXCEPTION_DUPLICATE, "Id=%x", iter->first);
-				}
+			nomic::uuid::uid_slot &entry = find(id);
+			if(std::get<UID_SLOT_REFERENCE>(entry) <= REFERENCE_INIT) {
+				uint32_t generation = ((std::get<UID_SLOT_GENERATION>(entry) + 1) & UID_GENERATION_MASK);
 
-				m_id_surplus.insert(iter->first);
-				m_id.erase(iter);
+				std::get<UID_SLOT_GENERATION>(entry) = ((generation != UID_INVALID) ? generation : UID_GENERATION_INIT);
+				std::get<UID_SLOT_NEXT>(entry) = m_free[UID_SHARD(id)];
+				std::get<UID_SLOT_REFERENCE>(entry) = 0;
+				m_free[UID_SHARD(id)] = UID_INDEX(id);
 			} else {
-				result = --iter->second;
+				result = --std::get<UID_SLOT_REFERENCE>(entry);
 			}
 
 			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
 			return result;
 		}
 
-		std::map<uint32_t, size_t>::iterator 
+		nomic::uuid::uid_slot &
 		manager::find(
 			__in uint32_t id
 			)
 		{
-			std::map<uint32_t, size_t>::iterator result;
-
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Id=%x", id);
 
 			if(id == UID_INVALID) {
 				THROW_NOMIC_UUID_MANAGER_EXCEPTION_FORMAT(NOMIC_UUID_MANAGER_EXCEPTION_INVALID, "Id=%x", id);
 			}
 
-			result = m_id.find(id);
-			if(result == m_id.end()) {
+			std::vector<nomic::uuid::uid_slot> &slot = m_slot[UID_SHARD(id)];
+			if(UID_INDEX(id) >= slot.size()) {
+				THROW_NOMIC_UUID_MANAGER_EXCEPTION_FORMAT(NOMIC_UUID_MANAGER_EXCEPTION_NOT_FOUND, "Id=%x", id);
+			}
+
+			nomic::uuid::uid_slot &result = slot.at(UID_INDEX(id));
+			if((std::get<UID_SLOT_GENERATION>(result) != UID_GENERATION(id))
+					|| (std::get<UID_SLOT_REFERENCE>(result) < REFERENCE_INIT)) {
 				THROW_NOMIC_UUID_MANAGER_EXCEPTION_FORMAT(NOMIC_UUID_MANAGER_EXCEPTION_NOT_FOUND, "Id=%x", id);
 			}
 
@@ -131,35 +151,48 @@ namespace nomic {
 		uint32_t 
 		manager::generate(void)
 		{
-			uint32_t result = UID_INVALID;
+			uint32_t origin, result = UID_INVALID;
 
 			TRACE_ENTRY(LEVEL_VERBOSE);
 
-			std::lock_guard<std::mutex> lock(m_mutex);
-
 			if(!m_initialized) {
 				THROW_NOMIC_UUID_MANAGER_EXCEPTION(NOMIC_UUID_MANAGER_EXCEPTION_UNINITIALIZED);
 			}
 
-			if(!m_id_surplus.empty()) {
-				std::set<uint32_t>::iterator iter = m_id_surplus.begin();
-				result = *iter;
-				m_id_surplus.erase(iter);
-			} else if(m_id_next != UID_INVALID) {
-				result = m_id_next++;
-			} else {
-				THROW_NOMIC_UUID_MANAGER_EXCEPTION(NOMIC_UUID_MANAGER_EXCEPTION_FULL);
-			}
+			origin = shard();
 
-			if(result == UID_INVALID) {
-				THROW_NOMIC_UUID_MANAGER_EXCEPTION_FORMAT(NOMIC_UUID_MANAGER_EXCEPTION_INVALID, "Id=%x", result);
-			}
+			for(uint32_t offset = 0; offset < UID_SHARD_COUNT; ++offset) {
+				uint32_t index, current = ((origin + offset) & UID_SHARD_MASK);
+
+				std::lock_guard<std::mutex> lock(m_mutex[current]);
 
-			if(m_id.find(result) != m_id.end()) {
-				THROW_NOMIC_UUID_MANAGER_EXCEPTION_FORMAT(NOMIC_UUID_MANAGER_EXCEPTION_DUPLICATE, "Id=%x", result);
+				std::vector<nomic::uuid::uid_slot> &slot = m_slot[current];
+				if(m_free[current] != UID_SLOT_NONE) {
+					index = m_free[current];
+
+					nomic::uuid::uid_slot &entry = slot.at(index);
+					if(std::get<UID_SLOT_REFERENCE>(entry) != 0) {
+						THROW_NOMIC_UUID_MANAGER_EXCEPTION_FORMAT(NOMIC_UUID_MANAGER_EXCEPTION_DUPLICATE, "Id=%x",
+							UID_MAKE(std::get<UID_SLOT_GENERATION>(entry), current, index));
+					}
+
+					m_free[current] = std::get<UID_SLOT_NEXT>(entry);
+					std::get<UID_SLOT_NEXT>(entry) = UID_SLOT_NONE;
+					std::get<UID_SLOT_REFERENCE>(entry) = REFERENCE_INIT;
+				} else if(slot.size() <= UID_INDEX_MASK) {
+					index = slot.size();
+					slot.push_back(std::make_tuple(UID_GENERATION_INIT, REFERENCE_INIT, UID_SLOT_NONE));
+				} else {
+					continue;
+				}
+
+				result = UID_MAKE(std::get<UID_SLOT_GENERATION>(slot.at(index)), current, index);
+				break;
 			}
 
-			m_id.insert(std::make_pair(result, REFERENCE_INIT));
+			if(result == UID_INVALID) {
+				THROW_NOMIC_UUID_MANAGER_EXCEPTION(NOMIC_UUID_MANAGER_EXCEPTION_FULL);
+			}
 
 			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%x", result);
 			return result;
@@ -174,13 +207,13 @@ namespace nomic {
 
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Id=%x", id);
 
-			std::lock_guard<std::mutex> lock(m_mutex);
-
 			if(!m_initialized) {
 				THROW_NOMIC_UUID_MANAGER_EXCEPTION(NOMIC_UUID_MANAGER_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = ++find(id)->second;
+			std::lock_guard<std::mutex> lock(m_mutex[UID_SHARD(id)]);
+
+			result = ++std::get<UID_SLOT_REFERENCE>(find(id));
 
 			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
 			return result;
@@ -223,13 +256,26 @@ namespace nomic {
 
 			TRACE_ENTRY_FORMAT(LEVEL_VERBOSE, "Id=%x", id);
 
-			std::lock_guard<std::mutex> lock(m_mutex);
-
 			if(!m_initialized) {
 				THROW_NOMIC_UUID_MANAGER_EXCEPTION(NOMIC_UUID_MANAGER_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = find(id)->second;
+			std::lock_guard<std::mutex> lock(m_mutex[UID_SHARD(id)]);
+
+			result = std::get<UID_SLOT_REFERENCE>(find(id));
+
+			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
+			return result;
+		}
+
+		uint32_t 
+		manager::shard(void) const
+		{
+			uint32_t result;
+
+			TRACE_ENTRY(LEVEL_VERBOSE);
+
+			result = (std::hash<std::thread::id>()(std::this_thread::get_id()) & UID_SHARD_MASK);
 
 			TRACE_EXIT_FORMAT(LEVEL_VERBOSE, "Result=%u", result);
 			return result;
@@ -250,42 +296,45 @@ namespace nomic {
 				result << " Base=" << SINGLETON_CLASS(nomic::uuid::manager)::to_string(verbose);
 
 				if(m_initialized) {
-					result << ", Id[" << m_id.size() << "]";
-
-					if(!m_id.empty()) {
-						result << "={";
+					result << ", Shard[" << UID_SHARD_COUNT << "]={";
 
-						for(std::map<uint32_t, size_t>::const_iterator iter = m_id.begin(); iter != m_id.end(); ++iter) {
+					for(uint32_t shard = 0; shard < UID_SHARD_COUNT; ++shard) {
+						size_t count = 0;
 
-							if(iter != m_id.begin()) {
-								result << ", ";
-							}
-
-							result << "(" << SCALAR_AS_HEX(uint32_t, iter->first) << ", Reference=" << iter->second << ")";
+						if(shard) {
+							result << ", ";
 						}
 
-						result << "}";
-					}
+						result << "{Slot[" << m_slot[shard].size() << "]";
+
+						for(uint32_t index = 0; index < m_slot[shard].size(); ++index) {
+							const nomic::uuid::uid_slot &entry = m_slot[shard].at(index);
 
-					result << ", Surplus[" << m_id_surplus.size() << "]";
+							if(std::get<UID_SLOT_REFERENCE>(entry) < REFERENCE_INIT) {
+								continue;
+							}
 
-					if(!m_id_surplus.empty()) {
-						result << "={";
+							result << (count++ ? ", " : "={") << "("
+								<< SCALAR_AS_HEX(uint32_t, UID_MAKE(std::get<UID_SLOT_GENERATION>(entry), shard, index))
+								<< ", Reference=" << std::get<UID_SLOT_REFERENCE>(entry) << ")";
+						}
 
-						for(std::set<uint32_t>::const_iterator iter = m_id_surplus.begin(); iter != m_id_surplus.end();
-								++iter) {
+						if(count) {
+							result << "}";
+						}
 
-							if(iter != m_id_surplus.begin()) {
-								result << ", ";
-							}
+						result << ", Free=";
 
-							result << SCALAR_AS_HEX(uint32_t, *iter);
+						if(m_free[shard] != UID_SLOT_NONE) {
+							result << m_free[shard];
+						} else {
+							result << STRING_EMPTY;
 						}
 
 						result << "}";
 					}
 
-					result << ", Next=" << SCALAR_AS_HEX(uint32_t, m_id_next);
+					result << "}";
 				}
 			}
 